@@ -15,21 +15,45 @@
  *          @ref init_mlx90614_module function in order to enable all the other functions to work properly. In
  *          addition, this initialization function is the means with which the implementer will designate to the
  *          @ref mlx90614 the I2C of the MCU/MPU that this module will use in Polling Mode to execute the main function.
+ *          Nonetheless, the temperature readings can also be requested asynchronously via the DMA or Interrupt Mode of
+ *          that I2C (e.g., see @ref get_mlx90614_object1_temperature_async ), so that the CPU is free while the
+ *          corresponding I2C transaction takes place.
+ *@details In addition, the @ref mlx90614 also provides a Handle-based version of all of its functions (i.e., those
+ *          receiving a @ref MLX90614_Handle ), which allows the implementer to communicate with several MLX90614 Devices
+ *          that may be wired to one or several I2C Peripherals of the MCU/MPU, without having to reconfigure the
+ *          @ref mlx90614 each time that it is desired to communicate with a different MLX90614 Device. For this, each
+ *          MLX90614 Device will require its own @ref MLX90614_Handle , which has to be initialized via the
+ *          @ref init_mlx90614_handle function. On the other hand, the functions that do not receive a
+ *          @ref MLX90614_Handle (e.g., @ref get_mlx90614_object1_temperature ) simply work with the Module Handle of the
+ *          @ref mlx90614 , which is the one initialized via the @ref init_mlx90614_module function.
  *
- * @note    Functions to change the "ConfigRegister1" Register will not be provided since the MLX90614 Datasheet states
- *          that this registered must not be tampered with and that the reason that this Register is writable is due to
- *          factory calibration relevant purposes. It is also stated there that this Register is meant to be changed
+ * @note    Functions to change the IIR, FIR and Gain fields of the "ConfigRegister1" Register are provided (e.g., see
+ *          @ref set_mlx90614_handle_iir ) so that the noise of the MLX90614 Device can be traded against its settling
+ *          time. However, the rest of the bits of that Register will never be changed by the @ref mlx90614 since the
+ *          MLX90614 Datasheet states that they are factory calibration relevant and that they are meant to be changed
  *          only via special tools provided by Melexis for whenever your particular MLX90614 Device requires to be
  *          calibrated.
  * @note    Similarly, the Max, Min and Range Temperature values that can be changed in the EEPROM of the MLX90614 are
- *          meant for the PWM Mode according to the MLX90614 datasheet. Therefore, because this library provides a means
- *          of communication with the MLX90614 Device via the I2C Protocol, it is unnecessary to provide functions for
- *          editing those EEPROM values.
+ *          meant for the PWM Mode according to the MLX90614 datasheet. Therefore, they are only read by this library
+ *          (see @ref get_mlx90614_handle_pwm_range ) so that the PWM output can be decoded via a @ref MLX90614_PWM ,
+ *          but no functions for editing those EEPROM values are provided.
+ * @note    The Emissivity stored in the EEPROM of the MLX90614 Device can be changed via the
+ *          @ref set_mlx90614_handle_emissivity function. However, in order to switch between target materials on the
+ *          fly without spending EEPROM write cycles, a software compensation of the Emissivity is also provided (see
+ *          @ref set_mlx90614_handle_emissivity_compensation ).
+ * @note    In order to choose the configuration of each product from data, a dedicated benchmark firmware can enable
+ *          @ref MLX90614_ENABLE_BENCHMARK and call the @ref run_mlx90614_benchmark function, which reports via a UART
+ *          what each way of reading the MLX90614 Device costs at the SMBus clocks of 10kHz, 50kHz and 100kHz.
  * @note    Another thing to highlight is that this @ref mlx90614 has included the "stm32f1xx_hal.h" header file
  *          to be able to use the I2C in this module. However, this header file is specifically meant for the STM32F1
  *          series devices. If yours is from a different type, then you will have to substitute the right one here for
  *          your particular STMicroelectronics device. However, if you cant figure out what the name of that header file
  *          is, then simply substitute that line of code from this @ref mlx90614 by: #include "main.h"
+ *          Alternatively, the HAL header file to be included can be given via the \c MLX90614_HAL_HEADER macro
+ *          from the compiler flags, which also allows compiling this @ref mlx90614 on a host computer against a
+ *          mock of the HAL functions that it uses (i.e., @ref HAL_I2C_Mem_Read , @ref HAL_I2C_Master_Transmit ,
+ *          @ref HAL_I2C_IsDeviceReady , @ref HAL_Delay , @ref HAL_GetTick and, if the Asynchronous functions are
+ *          used, their DMA or Interrupt counterparts).
  *
  * @details <b><u>Code Example for reading the Object1, Object2 and Ambient Temperatures Device via the @ref mlx90614
  *          :</u></b>
@@ -352,12 +376,23 @@
 #ifndef MLX90614_IR_THERMOMETER_H_
 #define MLX90614_IR_THERMOMETER_H_
 
+#ifdef MLX90614_HAL_HEADER
+#include MLX90614_HAL_HEADER // Allows building the @ref mlx90614 against a different HAL header file (e.g., a host-side mock of the HAL) without editing this file, by defining this macro via the compiler flags (e.g., -DMLX90614_HAL_HEADER='"mock_hal.h"').
+#else
 #include "stm32f1xx_hal.h" // This is the HAL Driver Library for the STM32F1 series devices. If yours is from a different type, then you will have to substitute the right one here for your particular STMicroelectronics device. However, if you cant figure out what the name of that header file is, then simply substitute this line of code by: #include "main.h"
+#endif
 #include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <stddef.h> // This library contains the alias: size_t.
+#include "mlx90614_ir_thermometer_driver_config.h" // This header file contains all the compile-time configuration options of the @ref mlx90614 .
 
-#define MLX90614_I2C_TIMEOUT                (100)     /**< @brief Time in milliseconds that our MCU/MPU will wait for the MLX90614 Infra Red Thermometer device to respond to an I2C transaction between them. */
-#define MLX90614_ERASE_OR_WRITE_CELL_TIME   (1000)    /**< @brief Time in milliseconds that our MCU/MPU will wait for the MLX90614 Infra Red Thermometer device for either Erasing or Writing Cells in its EEPROM. @note  This is only used whenever erasing and writing a new Slave Address into the MLX90614 EEPROM. @note  Have in consideration that the MLX90614 Datasheet states that either erasing or writing EEPROM cells typically takes 5ms. However, they do not tell what is the maximum expected wait time for this. Therefore, in order to be very safe, a very larger time was assigned, but feel free to change it according to your needs as long as you have this information in mind. */
-#define IS_MLX90614_READY_NUMBER_OF_TRIALS	(1)       /**< @brief Number of attempts to be made whenever checking if the MLX90614 Infra Red Thermometer is ready for I2C communication. */
+#define MLX90614_SCAN_BITMAP_WORDS          (4)       /**< @brief Number of 32-bit words required by a @ref MLX90614_Scan_Result to hold one bit per each of the 128 slave addresses of the I2C Protocol. */
+#define MLX90614_EEPROM_SHADOW_SIZE         (5)       /**< @brief Number of EEPROM words of the MLX90614 Infra Red Thermometer that each @ref MLX90614_Handle can hold in its EEPROM Shadow (see @ref set_mlx90614_handle_eeprom_shadow ), which are those used by the @ref mlx90614 (i.e., the "ConfigRegister1" Register, the Slave Address, the \f$T_{O,MAX}\f$ and \f$T_{O,MIN}\f$ registers of the PWM output and the Emissivity). */
+#define MLX90614_NUMBER_OF_CHANNELS         (3)       /**< @brief Number of temperature channels that can be read from a MLX90614 Infra Red Thermometer (i.e., Ambient, Object1 and Object2 Temperatures). */
+#define MLX90614_HANDLE_I2C_BUFFER_SIZE     (3)       /**< @brief Size in bytes of the buffer used by each @ref MLX90614_Handle to receive the Raw Data of its Asynchronous temperature readings, which includes the PEC byte (see @ref set_mlx90614_handle_pec_check ). */
+#define MLX90614_SCHEDULER_ALL_CHANNELS    (0xFF)    /**< @brief Value that, if given to a @ref MLX90614_Scheduler as its channel, makes it read all the temperature channels on every period via @ref get_mlx90614_handle_all_temperatures_async . */
+#define MLX90614_LOG_HEADER_SIZE           (9)       /**< @brief Size in bytes of the header with which every Sample Log of a @ref MLX90614_Log_Writer starts. */
+#define MLX90614_LOG_MAX_RECORD_SIZE       (10)      /**< @brief Maximum number of bytes that a single @ref MLX90614_Sample can take in a Sample Log, including the count and CRC bytes of the block that it may open and close (see @ref MLX90614_Log_Writer ). */
+#define MLX90614_RTOS_WAIT_FOREVER         (0xFFFFFFFFU) /**< @brief Timeout value that the @ref MLX90614_RTOS_Port hooks must interpret as an indefinite wait (e.g., by translating it into \c portMAX_DELAY in FreeRTOS or into \c osWaitForever in CMSIS-RTOS2). */
 
 /**@brief	MLX90614 Infra Red Thermometer Driver Exception codes.
  *
@@ -386,21 +421,778 @@ typedef enum
     MLX90614_Temp_F = 2     //!< MLX90614 Infra Red Thermometer values read in Fahrenheit.
 } MLX90614_Temp_t;
 
+/**@brief	MLX90614 Infra Red Thermometer temperature channels definitions.
+ *
+ * @note    The values of these definitions are the offsets of the RAM addresses of each channel with respect to the RAM
+ *          address of the Ambient Temperature, which is why they are also used to index the arrays of the
+ *          @ref MLX90614_Sample structure.
+ */
+typedef enum
+{
+    MLX90614_Ch_Ta      = 0U,   //!< MLX90614 Infra Red Thermometer Ambient Temperature channel.
+    MLX90614_Ch_Tobj1   = 1U,   //!< MLX90614 Infra Red Thermometer Object1 Temperature channel.
+    MLX90614_Ch_Tobj2   = 2U    //!< MLX90614 Infra Red Thermometer Object2 Temperature channel.
+} MLX90614_Channel_t;
+
+/**@brief	MLX90614 Infra Red Thermometer Sample Structure definition, which holds the readings of all the temperature
+ *          channels of a MLX90614 Device.
+ *
+ * @note    Both arrays are indexed with the @ref MLX90614_Channel_t definitions (e.g., \c raw[MLX90614_Ch_Tobj1] ).
+ */
+typedef struct
+{
+    uint16_t raw[MLX90614_NUMBER_OF_CHANNELS];              /**< @brief Raw Values read from the MLX90614 Device for each temperature channel. */
+    float temperature[MLX90614_NUMBER_OF_CHANNELS];         /**< @brief Temperature values of each channel, converted into the units of the Temperature Type with which they were requested. */
+} MLX90614_Sample;
+
+/**@brief	MLX90614 Infra Red Thermometer Asynchronous temperature reading states definitions.
+ *
+ * @details These definitions stand for the states in which an Asynchronous temperature reading request of the
+ *          @ref mlx90614 can be at (see @ref get_mlx90614_object1_temperature_async for an example of such requests).
+ */
+typedef enum
+{
+    MLX90614_ASYNC_IDLE = 0U,   //!< No Asynchronous temperature reading has been requested or the result of the last one has already been collected.
+    MLX90614_ASYNC_BUSY = 1U,   //!< An Asynchronous temperature reading is currently being transferred via the I2C Peripheral.
+    MLX90614_ASYNC_CPLT = 2U,   //!< The requested Asynchronous temperature reading has successfully completed and its converted value is ready to be collected.
+    MLX90614_ASYNC_ERR  = 3U    //!< The requested Asynchronous temperature reading has concluded with an error.
+} MLX90614_Async_State;
+
+/**@brief	MLX90614 IIR Filter settings definition, whose values are those of the IIR field (i.e., bits 2:0) of the
+ *          "ConfigRegister1" Register of the MLX90614 Device according to its Datasheet.
+ *
+ * @details The percentage of each setting stands for the weight that each new measurement has in the output of the
+ *          IIR Filter, such that a lower percentage gives a lower noise at the cost of a longer settling time.
+ */
+typedef enum
+{
+    MLX90614_IIR_50     = 0U,   //!< IIR Filter with \f$a_{1}=0.5\f$ and \f$b_{1}=0.5\f$ .
+    MLX90614_IIR_25     = 1U,   //!< IIR Filter with \f$a_{1}=0.25\f$ and \f$b_{1}=0.75\f$ .
+    MLX90614_IIR_17     = 2U,   //!< IIR Filter with \f$a_{1}=0.166(6)\f$ and \f$b_{1}=0.83(3)\f$ .
+    MLX90614_IIR_13     = 3U,   //!< IIR Filter with \f$a_{1}=0.125\f$ and \f$b_{1}=0.875\f$ .
+    MLX90614_IIR_100    = 4U,   //!< IIR Filter with \f$a_{1}=1\f$ and \f$b_{1}=0\f$ (i.e., the IIR Filter is bypassed).
+    MLX90614_IIR_80     = 5U,   //!< IIR Filter with \f$a_{1}=0.8\f$ and \f$b_{1}=0.2\f$ .
+    MLX90614_IIR_67     = 6U,   //!< IIR Filter with \f$a_{1}=0.666\f$ and \f$b_{1}=0.333\f$ .
+    MLX90614_IIR_57     = 7U    //!< IIR Filter with \f$a_{1}=0.571\f$ and \f$b_{1}=0.428\f$ .
+} MLX90614_IIR_t;
+
+/**@brief	MLX90614 FIR Filter settings definition, whose values are those of the FIR field (i.e., bits 10:8) of the
+ *          "ConfigRegister1" Register of the MLX90614 Device according to its Datasheet.
+ *
+ * @note    The values \c 0 up to \c 3 of the FIR field are not recommended by the MLX90614 Datasheet and, therefore,
+ *          they are not supported by the @ref mlx90614 .
+ */
+typedef enum
+{
+    MLX90614_FIR_128    = 4U,   //!< FIR Filter of \f$N=128\f$ .
+    MLX90614_FIR_256    = 5U,   //!< FIR Filter of \f$N=256\f$ .
+    MLX90614_FIR_512    = 6U,   //!< FIR Filter of \f$N=512\f$ .
+    MLX90614_FIR_1024   = 7U    //!< FIR Filter of \f$N=1024\f$ .
+} MLX90614_FIR_t;
+
+/**@brief	MLX90614 Amplifier Gain settings definition, whose values are those of the Gain field (i.e., bits 13:11) of
+ *          the "ConfigRegister1" Register of the MLX90614 Device according to its Datasheet.
+ */
+typedef enum
+{
+    MLX90614_GAIN_1     = 0U,   //!< Amplifier Gain of 1 (i.e., the Amplifier is bypassed).
+    MLX90614_GAIN_3     = 1U,   //!< Amplifier Gain of 3.
+    MLX90614_GAIN_6     = 2U,   //!< Amplifier Gain of 6.
+    MLX90614_GAIN_12_5  = 3U,   //!< Amplifier Gain of 12.5.
+    MLX90614_GAIN_25    = 4U,   //!< Amplifier Gain of 25.
+    MLX90614_GAIN_50    = 5U,   //!< Amplifier Gain of 50.
+    MLX90614_GAIN_100   = 6U    //!< Amplifier Gain of 100.
+} MLX90614_Gain_t;
+
+#if (MLX90614_ENABLE_STATS)
+/**@brief	MLX90614 instrumented operations definition, which are used to index the
+ *          @ref MLX90614_Stats::cycles member.
+ */
+typedef enum
+{
+    MLX90614_STATS_OP_GET_AMBIENT           = 0U,   //!< Blocking getters of the Ambient Temperature (either float or integer ones).
+    MLX90614_STATS_OP_GET_OBJECT1           = 1U,   //!< Blocking getters of the Object1 Temperature (either float or integer ones).
+    MLX90614_STATS_OP_GET_OBJECT2           = 2U,   //!< Blocking getters of the Object2 Temperature (either float or integer ones).
+    MLX90614_STATS_OP_GET_ALL               = 3U,   //!< Blocking getters of all the temperature channels.
+    MLX90614_STATS_OP_HAL_MEM_READ          = 4U,   //!< Every @ref HAL_I2C_Mem_Read transaction.
+    MLX90614_STATS_OP_HAL_MEM_READ_ASYNC    = 5U,   //!< Every request of an Asynchronous transaction (i.e., either @ref HAL_I2C_Mem_Read_DMA or @ref HAL_I2C_Mem_Read_IT ), which does not include the time of the transfer itself.
+    MLX90614_STATS_OP_HAL_MASTER_TRANSMIT   = 6U,   //!< Every @ref HAL_I2C_Master_Transmit transaction.
+    MLX90614_STATS_OP_HAL_IS_DEVICE_READY   = 7U,   //!< Every @ref HAL_I2C_IsDeviceReady probe.
+    MLX90614_STATS_NUMBER_OF_OPS            = 8U    //!< Number of instrumented operations.
+} MLX90614_Stats_Op;
+
+/**@brief	MLX90614 Cycle Statistics Structure definition, which holds the CPU cycles (see
+ *          @ref MLX90614_CYCLE_COUNTER ) that an instrumented operation has taken so far.
+ *
+ * @note    The average number of cycles is given by \f$total/count\f$ .
+ */
+typedef struct
+{
+    uint32_t count; /**< @brief Number of times that the operation has been executed. */
+    uint32_t min;   /**< @brief Minimum number of cycles that the operation has taken, which is only valid if \p count is not zero. */
+    uint32_t max;   /**< @brief Maximum number of cycles that the operation has taken. */
+    uint64_t total; /**< @brief Sum of the number of cycles that the operation has taken. */
+} MLX90614_Cycle_Stats;
+
+/**@brief	MLX90614 Statistics Structure definition, which holds all the execution statistics recorded by the
+ *          @ref mlx90614 whenever @ref MLX90614_ENABLE_STATS is enabled.
+ */
+typedef struct
+{
+    MLX90614_Cycle_Stats cycles[MLX90614_STATS_NUMBER_OF_OPS]; /**< @brief Cycle Statistics of each instrumented operation, indexed by @ref MLX90614_Stats_Op . */
+    uint32_t hal_busy;      /**< @brief Number of HAL transactions that have concluded with @ref HAL_BUSY . */
+    uint32_t hal_timeout;   /**< @brief Number of HAL transactions that have concluded with @ref HAL_TIMEOUT . */
+    uint32_t hal_error;     /**< @brief Number of HAL transactions that have concluded with @ref HAL_ERROR . */
+    uint32_t error_flags;   /**< @brief Number of temperature Raw Values that were received with the Error Flag of the MLX90614 Device raised (i.e., greater than \c 0x7FFF ). */
+    uint32_t pec_errors;    /**< @brief Number of readings whose PEC validation failed. */
+    uint32_t bus_recoveries;/**< @brief Number of times that a stuck I2C bus has been recovered via @ref recover_mlx90614_i2c_bus . */
+    uint32_t cache_hits;    /**< @brief Number of temperature readings that have been served from the Freshness Cache of a @ref MLX90614_Handle without any I2C transaction (see @ref set_mlx90614_handle_freshness_window ). */
+} MLX90614_Stats;
+#endif
+
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+/**@brief	MLX90614 EEPROM Write stages definition, in the order in which they are executed by the
+ *          @ref pump_mlx90614_eeprom_write function.
+ */
+typedef enum
+{
+    MLX90614_EEPROM_STAGE_READ          = 0U,   //!< The current value of the EEPROM cell is to be read so that its bits that are not of interest are kept.
+    MLX90614_EEPROM_STAGE_ERASE         = 1U,   //!< The EEPROM cell is to be erased.
+    MLX90614_EEPROM_STAGE_ERASE_WAIT    = 2U,   //!< The EEPROM cell is being erased.
+    MLX90614_EEPROM_STAGE_WRITE         = 3U,   //!< The new value is to be written into the EEPROM cell.
+    MLX90614_EEPROM_STAGE_WRITE_WAIT    = 4U,   //!< The new value is being written into the EEPROM cell.
+    MLX90614_EEPROM_STAGE_DONE          = 5U    //!< The EEPROM Write has concluded.
+} MLX90614_EEPROM_Stage;
+#endif
+
+#if (MLX90614_ENABLE_SCAN)
+/**@brief	MLX90614 Scan Result Structure definition, which holds all the slave addresses that responded during a scan
+ *          of an I2C bus made via the @ref scan_mlx90614_bus function.
+ *
+ * @note    A @ref MLX90614_Scan_Result declared as a static or global variable starts zeroed and, therefore, invalid,
+ *          so the first call to @ref scan_mlx90614_bus will always scan the I2C bus.
+ */
+typedef struct
+{
+    uint32_t bitmap[MLX90614_SCAN_BITMAP_WORDS];    /**< @brief Bitmap of the slave addresses that responded, where the bit \f$n \% 32\f$ of the word \f$n / 32\f$ is set if the slave address \f$n\f$ responded. */
+    uint8_t count;                                  /**< @brief Number of slave addresses that responded. */
+    uint8_t is_valid;                               /**< @brief Flag indicating whether this Scan Result holds a completed scan ( \c 1 ) or not ( \c 0 ). */
+} MLX90614_Scan_Result;
+#endif
+
+/**@brief	MLX90614 Filter types definition (see @ref MLX90614_Filter ).
+ */
+typedef enum
+{
+    MLX90614_FILTER_NONE    = 0U,   //!< The samples are given back without being filtered.
+    MLX90614_FILTER_EMA     = 1U,   //!< Exponential Moving Average Filter, where each new sample has a weight of \f$1/2^{shift}\f$ in the output.
+    MLX90614_FILTER_BOXCAR  = 2U,   //!< Boxcar Filter, which gives back the average of the last \f$N\f$ samples.
+    MLX90614_FILTER_MEDIAN  = 3U    //!< Median Filter, which gives back the median of the last \f$N\f$ samples and that is meant for rejecting spikes.
+} MLX90614_Filter_Type;
+
+/**@brief	MLX90614 Filter Structure definition, which filters a stream of temperature Raw Values of a single
+ *          temperature channel by using only integer arithmetic.
+ *
+ * @details A Filter can be attached to each temperature channel of a @ref MLX90614_Handle (see
+ *          @ref set_mlx90614_handle_filter ), in which case every Raw Value read from that channel, either via the
+ *          blocking or the Asynchronous functions (and, therefore, via a @ref MLX90614_Scheduler ), is filtered before
+ *          it is converted or pushed into a @ref MLX90614_Ring_Buffer . Alternatively, a Filter can be used on its own
+ *          via the @ref update_mlx90614_filter function.
+ *
+ * @note    The members of this structure are managed by the @ref mlx90614 and they must not be modified directly by
+ *          the implementer. Instead, use the @ref init_mlx90614_filter function.
+ */
+typedef struct
+{
+    MLX90614_Filter_Type type;                  /**< @brief Type of this Filter. */
+    uint8_t length;                             /**< @brief Shift of the Exponential Moving Average Filter, or \f$N\f$ of the Boxcar and Median Filters. */
+    uint8_t count;                              /**< @brief Number of samples that have been given to this Filter, saturated at its \f$N\f$ . */
+    uint8_t index;                              /**< @brief Index of the window of this Filter into which its next sample will be stored. */
+    uint32_t accumulator;                       /**< @brief State of the Exponential Moving Average Filter, scaled by \f$2^{shift}\f$ , or the sum of the window of the Boxcar Filter. */
+    uint16_t window[MLX90614_FILTER_MAX_WINDOW];/**< @brief Last samples given to the Boxcar or Median Filters. */
+} MLX90614_Filter;
+
+/**@brief	MLX90614 Ring Buffer Entry definition, which holds a single temperature Raw Value that was read from a
+ *          MLX90614 Device.
+ */
+typedef struct
+{
+    uint32_t timestamp;     /**< @brief Value of @ref MLX90614_TIMESTAMP at the moment in which the Raw Value was received. */
+    uint16_t raw;           /**< @brief Temperature Raw Value read, whose Error Flag is guaranteed to be cleared. */
+    uint8_t channel;        /**< @brief @ref MLX90614_Channel_t of the temperature channel from which the Raw Value was read. */
+    uint8_t slave_address;  /**< @brief Slave address of the MLX90614 Device from which the Raw Value was read. */
+} MLX90614_Ring_Entry;
+
+/**@brief	MLX90614 Ring Buffer definition, which is a lock-free Single-Producer/Single-Consumer queue of
+ *          @ref MLX90614_Ring_Entry with a capacity of @ref MLX90614_RING_BUFFER_CAPACITY entries.
+ *
+ * @details The producer is the Interrupt context of the I2C Peripheral (i.e., the
+ *          @ref mlx90614_i2c_mem_rx_cplt_callback function), which pushes into the Ring Buffer attached to a
+ *          @ref MLX90614_Handle (see @ref set_mlx90614_handle_ring_buffer ) every Raw Value that it successfully
+ *          receives, whereas the consumer is the application, which drains it in batches via the
+ *          @ref pop_mlx90614_ring_buffer function.
+ *
+ * @note    The storage of the Ring Buffer is allocated together with this structure. Therefore, it is meant to be
+ *          declared as a static or global variable by the implementer.
+ * @note    Only a single producer and a single consumer may access a Ring Buffer at a time. If several Handles are to
+ *          push into the same Ring Buffer, then they must all use the same I2C Interrupt priority level.
+ */
+typedef struct
+{
+    MLX90614_Ring_Entry entries[MLX90614_RING_BUFFER_CAPACITY]; /**< @brief Storage of the Ring Buffer. */
+    volatile uint32_t head;     /**< @brief Free-running count of the entries pushed so far, which is only written by the producer. */
+    volatile uint32_t tail;     /**< @brief Free-running count of the entries popped so far, which is only written by the consumer. */
+    volatile uint32_t dropped;  /**< @brief Number of entries that could not be pushed because the Ring Buffer was full. */
+} MLX90614_Ring_Buffer;
+
+/**@brief	MLX90614 Log Writer Structure definition, which serializes @ref MLX90614_Sample records into a compact
+ *          binary Sample Log held in a buffer given by the implementer (e.g., to be then sent over a UART or stored in
+ *          an external Flash memory).
+ *
+ * @details A Sample Log starts with a header of @ref MLX90614_LOG_HEADER_SIZE bytes, which holds, in this order, the
+ *          \c 0x4D magic byte, the version of the format (i.e., \c 1 ), the slave address of the MLX90614 Device, its
+ *          @ref MLX90614_Temp_t , the start tick as a little endian \c uint32_t and a CRC-8 of all the previous bytes.
+ * @details The header is followed by blocks of samples, where each block holds:<br><br>
+ *          * A count byte with the number of samples of the block.<br>
+ *          * A keyframe, which is the first sample of the block with its three Raw Values as little endian
+ *            \c uint16_t .<br>
+ *          * The rest of the samples of the block, each with the difference of its three Raw Values against the
+ *            previous sample, zig-zag encoded into a base-128 varint (i.e., a single byte per Raw Value that changed
+ *            by less than \f$\pm 64\f$ units).<br>
+ *          * A CRC-8 of all the previous bytes of the block.<br><br>
+ *          The CRC-8 is the same one that the MLX90614 Device uses for its SMBus PEC byte (i.e., with the
+ *          \f$x^{8}+x^{2}+x+1\f$ polynomial), so that it is calculated with the same @ref MLX90614_PEC_IMPLEMENTATION .
+ * @details Each block holds up to the keyframe interval of the Log Writer, so that a Sample Log can be decoded from
+ *          any block on and so that a corrupted block only loses its own samples. A Sample Log can be decoded with the
+ *          @ref decode_mlx90614_log function, which uses no HAL function at all.
+ *
+ * @note    The members of this structure are managed by the @ref mlx90614 and they must not be modified directly by
+ *          the implementer. Instead, use the @ref init_mlx90614_log_writer function and the other Log Writer functions
+ *          of the @ref mlx90614 .
+ */
+typedef struct
+{
+    uint8_t *p_buffer;                                  /**< @brief Pointer to the buffer into which the Sample Log is written. */
+    size_t capacity;                                    /**< @brief Size in bytes of \ref p_buffer . */
+    size_t length;                                      /**< @brief Number of bytes of the Sample Log that have been written into \ref p_buffer . */
+    size_t block_start;                                 /**< @brief Index of \ref p_buffer at which the count byte of the current block is. */
+    uint8_t keyframe_interval;                          /**< @brief Maximum number of samples that each block of the Sample Log can hold. */
+    uint8_t block_count;                                /**< @brief Number of samples of the current block, or \c 0 if no block is open. */
+    uint16_t previous_raw[MLX90614_NUMBER_OF_CHANNELS]; /**< @brief Raw Values of the last sample written, against which the next one is delta encoded. */
+} MLX90614_Log_Writer;
+
+/**@brief	MLX90614 Log Header Structure definition, which holds the header of a Sample Log decoded via the
+ *          @ref decode_mlx90614_log function.
+ */
+typedef struct
+{
+    uint8_t slave_address;              /**< @brief Slave address of the MLX90614 Device from which the samples were read. */
+    MLX90614_Temp_t temperature_type;   /**< @brief Temperature Type into which the samples are converted. */
+    uint32_t start_tick;                /**< @brief Tick given whenever the Sample Log was started. */
+} MLX90614_Log_Header;
+
+/**@brief	MLX90614 Retry Policy Structure definition, which defines how the blocking I2C transactions of a
+ *          @ref MLX90614_Handle are timed out and retried.
+ *
+ * @details Every blocking I2C transaction (i.e., every reading, every write command and every slave address probe)
+ *          that fails, either because the MLX90614 Device did not respond, because the HAL reported an error or
+ *          because its PEC validation failed, is retried up to \p retries times. Before retry \f$n\f$ (starting
+ *          from \f$n=0\f$ ), \f$\min(backoff \cdot 2^{n}, max\_backoff)\f$ milliseconds are waited, so that a
+ *          device that is momentarily busy is not hammered. This way, the worst-case time that a single operation can
+ *          take is bounded by \f$(retries+1) \cdot timeout\f$ plus the sum of its backoffs.
+ *
+ * @note    The Asynchronous temperature readings are not retried, since their outcome is reported by their callbacks.
+ */
+typedef struct
+{
+    uint32_t timeout_ms;        /**< @brief Time in milliseconds that each I2C transaction waits for the MLX90614 Device to respond. */
+    uint8_t retries;            /**< @brief Number of times that a failed I2C transaction is retried. */
+    uint32_t backoff_ms;        /**< @brief Time in milliseconds waited before the first retry, which is doubled on every subsequent retry. A value of \c 0 retries right away. */
+    uint32_t max_backoff_ms;    /**< @brief Maximum time in milliseconds waited before any retry. */
+    uint8_t is_fail_fast;       /**< @brief Flag indicating whether every I2C transaction is attempted only once, regardless of the other members, with no backoff at all ( \c 1 ) or not ( \c 0 ), which is meant for latency-critical loops. */
+} MLX90614_Retry_Policy;
+
+/**@brief	MLX90614 Bus Recovery Structure definition, which holds the GPIO pins of an I2C Peripheral so that the
+ *          @ref mlx90614 can drive them manually to release an I2C bus that has been locked up by a slave device
+ *          (see @ref recover_mlx90614_i2c_bus ).
+ */
+typedef struct
+{
+    GPIO_TypeDef *scl_port; /**< @brief GPIO Port of the SCL pin of the I2C Peripheral. */
+    uint16_t scl_pin;       /**< @brief GPIO Pin of the SCL pin of the I2C Peripheral (e.g., @ref GPIO_PIN_6 ). */
+    GPIO_TypeDef *sda_port; /**< @brief GPIO Port of the SDA pin of the I2C Peripheral. */
+    uint16_t sda_pin;       /**< @brief GPIO Pin of the SDA pin of the I2C Peripheral (e.g., @ref GPIO_PIN_7 ). */
+} MLX90614_Bus_Recovery;
+
+typedef struct MLX90614_Handle MLX90614_Handle; /**< @brief Forward declaration of the @ref MLX90614_Handle type so that it can be used by the @ref MLX90614_Async_Callback type. */
+
+/**@brief	Function pointer type of the callbacks that will be called by the @ref mlx90614 to notify the application
+ *          that a requested Asynchronous temperature reading has concluded.
+ *
+ * @note    <b>The callback will be called from the Interrupt context</b> of the I2C Peripheral being used (i.e., from
+ *          the @ref mlx90614_i2c_mem_rx_cplt_callback or @ref mlx90614_i2c_error_callback functions). Therefore, keep
+ *          its code as short as possible.
+ *
+ * @param[in] hmlx      Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the temperature was
+ *                      requested.
+ * @param status        @ref MLX90614_EC_OK if the temperature was successfully read and converted. Otherwise, the
+ *                      corresponding @ref MLX90614_Status Exception Code of the error that took place.
+ * @param temperature   Temperature value read, already converted into the units of the currently configured
+ *                      Temperature Type in the \p hmlx param. This value is only valid if \p status equals
+ *                      @ref MLX90614_EC_OK .
+ */
+typedef void (*MLX90614_Async_Callback)(MLX90614_Handle *hmlx, MLX90614_Status status, float temperature);
+
+/**@brief	Function pointer type of the callbacks that will be called by the @ref mlx90614 to notify the application
+ *          that a requested Asynchronous reading of all the temperature channels has concluded.
+ *
+ * @note    <b>The callback will be called from the Interrupt context</b> of the I2C Peripheral being used. Therefore,
+ *          keep its code as short as possible.
+ *
+ * @param[in] hmlx      Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the temperatures were
+ *                      requested.
+ * @param status        @ref MLX90614_EC_OK if all the temperatures were successfully read and converted. Otherwise,
+ *                      the corresponding @ref MLX90614_Status Exception Code of the error that took place.
+ * @param[in] sample    Pointer to the @ref MLX90614_Sample that was given when requesting the reading, whose values
+ *                      are only valid if \p status equals @ref MLX90614_EC_OK .
+ */
+typedef void (*MLX90614_Sample_Callback)(MLX90614_Handle *hmlx, MLX90614_Status status, MLX90614_Sample *sample);
+
+/**@brief	MLX90614 Event flags definition, which are raised by a @ref MLX90614_Event_Detector and that can be
+ *          combined with a bitwise OR.
+ */
+typedef enum
+{
+    MLX90614_EVENT_NONE         = 0x00U,    //!< No meaningful change has been detected.
+    MLX90614_EVENT_DELTA        = 0x01U,    //!< The Raw Value has moved away from the last reported one by at least the delta of the Event Detector.
+    MLX90614_EVENT_ABOVE_HIGH   = 0x02U,    //!< The Raw Value has risen above the high threshold of the Event Detector.
+    MLX90614_EVENT_BELOW_LOW    = 0x04U,    //!< The Raw Value has fallen below the low threshold of the Event Detector.
+    MLX90614_EVENT_IN_RANGE     = 0x08U     //!< The Raw Value has come back within the thresholds of the Event Detector by at least its hysteresis, or it is the first one evaluated and it is within them.
+} MLX90614_Event_t;
+
+/**@brief	Function pointer type of the callbacks that will be called by a @ref MLX90614_Event_Detector whenever it
+ *          detects a meaningful change in the Raw Values of a MLX90614 Device.
+ *
+ * @note    Whenever the @ref MLX90614_Event_Detector is attached to a @ref MLX90614_Handle (see
+ *          @ref set_mlx90614_handle_event_detector ), <b>the callback will be called from the Interrupt context</b> of
+ *          the I2C Peripheral being used. Therefore, keep its code as short as possible.
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the Raw Value was read.
+ * @param channel   @ref MLX90614_Channel_t of the temperature channel from which the Raw Value was read.
+ * @param events    Bitwise OR of the @ref MLX90614_Event_t flags that were raised.
+ * @param raw       Raw Value that raised the given \p events .
+ */
+typedef void (*MLX90614_Event_Callback)(MLX90614_Handle *hmlx, MLX90614_Channel_t channel, uint8_t events, uint16_t raw);
+
+/**@brief	MLX90614 Event Detector Structure definition, which compares each new Raw Value of a MLX90614 Device
+ *          against absolute thresholds and against the last reported Raw Value, so that the application is only
+ *          notified whenever something changes meaningfully.
+ *
+ * @details All the comparisons are made in Raw Value units (i.e., \f$50\f$ units per Kelvin), so that no float
+ *          arithmetic is required at all. A Raw Value is reported whenever it crosses either threshold, whenever it
+ *          comes back within them by at least the hysteresis or whenever it has moved away from the last reported
+ *          Raw Value of its channel by at least the delta. Any other Raw Value is suppressed.
+ *
+ * @note    The members of this structure are managed by the @ref mlx90614 and they must not be modified directly by
+ *          the implementer. Instead, use the @ref init_mlx90614_event_detector function.
+ */
+typedef struct
+{
+    uint16_t low_raw;                                   /**< @brief Low threshold, as a Raw Value, below which @ref MLX90614_EVENT_BELOW_LOW is raised. */
+    uint16_t high_raw;                                  /**< @brief High threshold, as a Raw Value, above which @ref MLX90614_EVENT_ABOVE_HIGH is raised. */
+    uint16_t hysteresis_raw;                            /**< @brief Raw Value units by which a Raw Value must come back within the thresholds for @ref MLX90614_EVENT_IN_RANGE to be raised. */
+    uint16_t delta_raw;                                 /**< @brief Raw Value units by which a Raw Value must move away from the last reported one for @ref MLX90614_EVENT_DELTA to be raised, or \c 0 if this is disabled. */
+    uint8_t channel_mask;                               /**< @brief Bitmask of the temperature channels evaluated by this Event Detector, where bit \f$n\f$ stands for the @ref MLX90614_Channel_t \f$n\f$ . */
+    uint8_t zone[MLX90614_NUMBER_OF_CHANNELS];          /**< @brief Last reported @ref MLX90614_Event_t zone flag of each temperature channel, or @ref MLX90614_EVENT_NONE if none has been reported yet. */
+    uint16_t reference_raw[MLX90614_NUMBER_OF_CHANNELS];/**< @brief Last reported Raw Value of each temperature channel. */
+    MLX90614_Event_Callback p_callback;                 /**< @brief Pointer to the function that will be called whenever an event is raised, or \c NULL if none was requested. */
+    uint32_t raised;                                    /**< @brief Number of Raw Values that have raised at least one event. */
+    uint32_t suppressed;                                /**< @brief Number of Raw Values that have been suppressed for not raising any event. */
+} MLX90614_Event_Detector;
+
+/**@brief	MLX90614 Infra Red Thermometer Handle Structure definition.
+ *
+ * @details Each MLX90614 Device with which it is desired to communicate requires its own @ref MLX90614_Handle , which
+ *          holds all the configurations and states that the @ref mlx90614 requires to communicate with that Device.
+ *
+ * @note    The members of this structure are managed by the @ref mlx90614 and they must not be modified directly by
+ *          the implementer. Instead, use the @ref init_mlx90614_handle function and the other Handle-based functions
+ *          of the @ref mlx90614 .
+ */
+struct MLX90614_Handle
+{
+    I2C_HandleTypeDef *hi2c;                                        /**< @brief Pointer to the I2C Handle Structure of the I2C that is used to communicate with the MLX90614 Device of this Handle. */
+    uint8_t slave_address;                                          /**< @brief Slave address of the MLX90614 Device of this Handle. */
+    uint8_t slave_address_one_bit_left_shifted;                     /**< @brief Slave address of the MLX90614 Device of this Handle, but shifted to the left by one bit. */
+    MLX90614_Temp_t temperature_type;                               /**< @brief Temperature Type with which this Handle will be responding whenever it is requested to give a temperature value. */
+    float (*p_get_converted_temperature)(uint16_t raw_temp);        /**< @brief Pointer to the function that converts a Raw Value into a temperature value of the Temperature Type of this Handle. */
+    volatile MLX90614_Async_State async_state;                      /**< @brief State of the last Asynchronous temperature reading requested with this Handle. */
+    MLX90614_Status async_status;                                   /**< @brief @ref MLX90614_Status Exception Code with which the last Asynchronous temperature reading of this Handle has concluded. */
+    float async_temperature;                                        /**< @brief Converted temperature value of the last successfully concluded Asynchronous temperature reading of this Handle. */
+    MLX90614_Async_Callback p_async_callback;                       /**< @brief Pointer to the function that will be called whenever the Asynchronous temperature reading in process of this Handle concludes, or \c NULL if none was requested. */
+    uint16_t async_raw;                                             /**< @brief Raw Value of the last successfully concluded Asynchronous temperature reading of a single channel of this Handle. */
+    uint8_t async_i2cdata[MLX90614_HANDLE_I2C_BUFFER_SIZE];         /**< @brief Buffer towards which the I2C Peripheral will write, in either DMA or Interrupt Mode, the Raw Data given back by the MLX90614 Device during an Asynchronous temperature reading of this Handle. */
+    MLX90614_Sample *p_async_sample;                                /**< @brief Pointer to the @ref MLX90614_Sample being filled by the Asynchronous reading of all the temperature channels in process of this Handle, or \c NULL if the Asynchronous reading in process is of a single channel. */
+    MLX90614_Sample_Callback p_async_sample_callback;               /**< @brief Pointer to the function that will be called whenever the Asynchronous reading of all the temperature channels in process of this Handle concludes, or \c NULL if none was requested. */
+    MLX90614_Channel_t async_channel;                               /**< @brief Temperature channel currently being read by the Asynchronous reading in process of this Handle. */
+    uint8_t is_pec_check_enabled;                                   /**< @brief Flag indicating whether the PEC byte sent by the MLX90614 Device of this Handle will be read and validated on every reading ( \c 1 ) or not ( \c 0 ). */
+    uint16_t eeprom_shadow[MLX90614_EEPROM_SHADOW_SIZE];            /**< @brief EEPROM Shadow of this Handle, which holds a copy of the EEPROM words used by the @ref mlx90614 . */
+    uint8_t eeprom_shadow_valid;                                    /**< @brief Bitmask indicating which words of the EEPROM Shadow of this Handle currently hold a valid copy, where bit \f$n\f$ stands for the word \f$n\f$ . */
+    uint8_t is_eeprom_shadow_enabled;                               /**< @brief Flag indicating whether the EEPROM Shadow of this Handle is used ( \c 1 ) or not ( \c 0 ). */
+    MLX90614_Filter *p_filter[MLX90614_NUMBER_OF_CHANNELS];         /**< @brief Pointers to the @ref MLX90614_Filter attached to each temperature channel of this Handle, indexed by @ref MLX90614_Channel_t , where a \c NULL value means that the corresponding channel is not filtered. */
+    MLX90614_Ring_Buffer *p_ring_buffer;                            /**< @brief Pointer to the @ref MLX90614_Ring_Buffer into which every Raw Value successfully received by the Asynchronous readings of this Handle will be pushed, or \c NULL if none is attached. */
+    MLX90614_Retry_Policy retry_policy;                             /**< @brief @ref MLX90614_Retry_Policy of the blocking I2C transactions of this Handle. */
+    const MLX90614_Bus_Recovery *p_bus_recovery;                    /**< @brief Pointer to the @ref MLX90614_Bus_Recovery pins with which the I2C bus of this Handle will be recovered whenever it is found to be stuck, or \c NULL if this is disabled. */
+    uint32_t freshness_window;                                      /**< @brief Time, in units of @ref MLX90614_TIMESTAMP , during which a Raw Value received by this Handle is served again from its Freshness Cache instead of being read again, or \c 0 if the Freshness Cache is disabled. */
+    uint32_t cache_timestamp[MLX90614_NUMBER_OF_CHANNELS];          /**< @brief Value of @ref MLX90614_TIMESTAMP at the moment in which the cached Raw Value of each temperature channel was received. */
+    uint16_t cache_raw[MLX90614_NUMBER_OF_CHANNELS];                /**< @brief Last Raw Value received by this Handle for each temperature channel, after having been filtered. */
+    volatile uint8_t cache_valid;                                   /**< @brief Bitmask indicating which temperature channels of the Freshness Cache of this Handle hold a Raw Value, where bit \f$n\f$ stands for the @ref MLX90614_Channel_t \f$n\f$ . */
+    uint32_t emissivity_coefficient;                                /**< @brief Emissivity compensation coefficient of this Handle in Q16 fixed-point (i.e., the Emissivity of the MLX90614 Device divided by the one of the target, multiplied by \f$2^{16}\f$ ), or \c 0 if the Emissivity compensation is disabled (see @ref set_mlx90614_handle_emissivity_compensation ). */
+    MLX90614_Event_Detector *p_event_detector;                      /**< @brief Pointer to the @ref MLX90614_Event_Detector that will evaluate every Raw Value successfully received by the Asynchronous readings of this Handle, or \c NULL if none is attached. */
+    uint8_t address_validation;                                     /**< @brief Slave Address Validation with which each new slave address of this Handle is accepted (see @ref set_mlx90614_handle_address_validation ). */
+    uint8_t is_slave_address_verified;                              /**< @brief Flag indicating whether a MLX90614 Device has already been confirmed to respond under the current slave address of this Handle ( \c 1 ) or not yet ( \c 0 ). */
+#if (MLX90614_ENABLE_SCAN)
+    const MLX90614_Scan_Result *p_address_scan;                     /**< @brief Pointer to the @ref MLX90614_Scan_Result against which the new slave addresses of this Handle are validated whenever its Slave Address Validation is @ref MLX90614_ADDRESS_VALIDATION_SCAN . */
+#endif
+};
+
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+/**@brief	MLX90614 EEPROM Write Structure definition, which is a non-blocking state machine that erases and writes
+ *          an EEPROM cell of a MLX90614 Device in stages (see @ref MLX90614_EEPROM_Stage ).
+ *
+ * @details An EEPROM Write is started with either the @ref start_mlx90614_handle_eeprom_write or the
+ *          @ref start_mlx90614_handle_device_slave_address_write functions and it is then advanced by repeatedly
+ *          calling the @ref pump_mlx90614_eeprom_write function (e.g., from the main loop of the application or from
+ *          a timer), which never blocks for more than a single I2C transaction.
+ *
+ * @note    The members of this structure are managed by the @ref mlx90614 and they must not be modified directly by
+ *          the implementer.
+ */
+typedef struct
+{
+    MLX90614_Handle *hmlx;          /**< @brief Pointer to the @ref MLX90614_Handle of the MLX90614 Device whose EEPROM is being written. */
+    uint8_t command;                /**< @brief EEPROM address being written, already combined with the EEPROM Access Command. */
+    uint16_t mask;                  /**< @brief Bit mask of the bits of the EEPROM cell that are being changed. */
+    uint16_t value;                 /**< @brief New value of the bits of interest and, once the EEPROM cell has been read, the whole value that will be written into it. */
+    uint8_t is_verify_enabled;      /**< @brief Flag indicating whether the EEPROM cell will be read back after being erased and after being written ( \c 1 ) or if @ref MLX90614_ERASE_OR_WRITE_CELL_TIME milliseconds will simply be waited instead ( \c 0 ). */
+    MLX90614_EEPROM_Stage stage;    /**< @brief Current stage of this EEPROM Write. */
+    uint32_t stage_tick;            /**< @brief Value of @ref HAL_GetTick at the moment in which the current erase or write process was requested. */
+    MLX90614_Status status;         /**< @brief @ref MLX90614_Status Exception Code with which this EEPROM Write has concluded, which is only valid once its stage is @ref MLX90614_EEPROM_STAGE_DONE . */
+} MLX90614_EEPROM_Write;
+#endif
+
+/**@brief	MLX90614 Scheduler Structure definition, which periodically requests Asynchronous readings to the
+ *          MLX90614 Device of a @ref MLX90614_Handle from the Interrupt context of a Hardware Timer.
+ *
+ * @details The implementer has to configure a Hardware Timer to interrupt with a fixed period (e.g., every
+ *          millisecond) and to call, from its Interrupt (e.g., from @ref HAL_TIM_PeriodElapsedCallback ), the
+ *          @ref mlx90614_scheduler_tick_handler function. This way, the Scheduler will request a new Asynchronous
+ *          reading every time its sampling period elapses, whose Raw Values will be pushed into the
+ *          @ref MLX90614_Ring_Buffer attached to the @ref MLX90614_Handle (see @ref set_mlx90614_handle_ring_buffer ).
+ *
+ * @note    The members of this structure are managed by the @ref mlx90614 and they must not be modified directly by
+ *          the implementer. Instead, use the @ref init_mlx90614_scheduler function and the other Scheduler functions
+ *          of the @ref mlx90614 .
+ */
+typedef struct
+{
+    MLX90614_Handle *hmlx;              /**< @brief Pointer to the @ref MLX90614_Handle whose MLX90614 Device will be periodically read by this Scheduler. */
+    uint8_t channel;                    /**< @brief @ref MLX90614_Channel_t of the temperature channel that will be read by this Scheduler, or @ref MLX90614_SCHEDULER_ALL_CHANNELS if all of them will be read. */
+    uint32_t period_ticks;              /**< @brief Sampling period of this Scheduler in ticks of its Hardware Timer. */
+    volatile uint32_t countdown;        /**< @brief Number of ticks that are left before this Scheduler requests its next reading. */
+    volatile uint8_t is_running;        /**< @brief Flag indicating whether this Scheduler is currently requesting readings ( \c 1 ) or not ( \c 0 ). */
+    volatile uint32_t issued;           /**< @brief Number of readings that have been successfully requested by this Scheduler. */
+    volatile uint32_t missed;           /**< @brief Number of readings that this Scheduler could not request because either the previous one of its Handle was still in process or because of an I2C error. */
+    MLX90614_Sample sample;             /**< @brief @ref MLX90614_Sample used by this Scheduler whenever it reads all the temperature channels. */
+} MLX90614_Scheduler;
+
+/**@brief	MLX90614 Duty Cycle stages definition, in the order in which they are executed by the
+ *          @ref pump_mlx90614_duty_cycle function on every sampling period.
+ */
+typedef enum
+{
+    MLX90614_DUTY_CYCLE_STAGE_STOPPED   = 0U,   //!< The Duty Cycle is stopped and the MLX90614 Device is awake.
+    MLX90614_DUTY_CYCLE_STAGE_SLEEPING  = 1U,   //!< The MLX90614 Device is in its Sleep Mode until the time to wake it up arrives.
+    MLX90614_DUTY_CYCLE_STAGE_WAKING    = 2U,   //!< The wake up pulse is being given to the MLX90614 Device (see @ref MLX90614_WAKE_PULSE_TIME ).
+    MLX90614_DUTY_CYCLE_STAGE_SETTLING  = 3U    //!< The MLX90614 Device is awake and its IIR and FIR Filters are settling until the time of the next sample arrives.
+} MLX90614_Duty_Cycle_Stage;
+
+/**@brief	MLX90614 Duty Cycle Structure definition, which is a non-blocking state machine that keeps a MLX90614
+ *          Device in its Sleep Mode between samples and wakes it up just in time for each of them (see
+ *          @ref MLX90614_Duty_Cycle_Stage ).
+ *
+ * @details On every sampling period, the MLX90614 Device is woken up early enough for its IIR and FIR Filters to
+ *          settle (see @ref get_mlx90614_settling_time ), then all of its temperature channels are read at once via
+ *          @ref get_mlx90614_handle_all_temperatures and it is immediately put back into its Sleep Mode. The Duty
+ *          Cycle is advanced by repeatedly calling the @ref pump_mlx90614_duty_cycle function (e.g., from the main
+ *          loop of the application, every time the MCU/MPU wakes up from its own low power mode).
+ *
+ * @note    This is meant for sampling periods of several seconds or more (e.g., battery powered nodes), whereas the
+ *          @ref MLX90614_Scheduler is meant for continuous sampling.
+ * @note    The members of this structure are managed by the @ref mlx90614 and they must not be modified directly by
+ *          the implementer. Instead, use the @ref init_mlx90614_duty_cycle function and the other Duty Cycle
+ *          functions of the @ref mlx90614 .
+ */
+typedef struct
+{
+    MLX90614_Handle *hmlx;                  /**< @brief Pointer to the @ref MLX90614_Handle whose MLX90614 Device is duty cycled. */
+    const MLX90614_Bus_Recovery *p_pins;    /**< @brief Pointer to the @ref MLX90614_Bus_Recovery pins of the I2C Peripheral of the Handle, through which SCL is held low during the Sleep Mode and the wake up pulse is given. */
+    uint32_t sampling_period_ms;            /**< @brief Period in milliseconds between the samples of this Duty Cycle. */
+    uint32_t lead_time_ms;                  /**< @brief Time in milliseconds that the MLX90614 Device is kept awake before each sample so that its IIR and FIR Filters settle. */
+    MLX90614_Duty_Cycle_Stage stage;        /**< @brief Current stage of this Duty Cycle. */
+    uint32_t stage_tick;                    /**< @brief Value of @ref HAL_GetTick at the moment in which the wake up pulse was started. */
+    uint32_t next_sample_tick;              /**< @brief Value of @ref HAL_GetTick at which the next sample will be taken. */
+    MLX90614_Sample sample;                 /**< @brief @ref MLX90614_Sample that holds the last sample taken by this Duty Cycle. */
+    MLX90614_Sample_Callback p_callback;    /**< @brief Function that will be called with every sample taken by this Duty Cycle, or \c NULL if none. */
+    uint32_t completed;                     /**< @brief Number of samples that have been successfully taken. */
+    uint32_t failed;                        /**< @brief Number of samples that could not be taken. */
+} MLX90614_Duty_Cycle;
+
+/**@brief	MLX90614 Bus Lane Structure definition, which holds the MLX90614 Devices wired to one of the I2C
+ *          Peripherals of a @ref MLX90614_Multi_Bus .
+ *
+ * @note    The members of this structure are managed by the @ref mlx90614 and they must not be modified directly by
+ *          the implementer. Instead, use the @ref add_mlx90614_multi_bus_lane function.
+ */
+typedef struct
+{
+    MLX90614_Handle *const *p_handles;  /**< @brief Pointer to the array of the @ref MLX90614_Handle of the MLX90614 Devices of this Lane, which all share the same I2C Peripheral. */
+    MLX90614_Sample *p_samples;         /**< @brief Pointer to the array of @ref MLX90614_Sample of this Lane, where the sample \f$n\f$ holds the last reading of the MLX90614 Device of the Handle \f$n\f$ . */
+    uint8_t count;                      /**< @brief Number of @ref MLX90614_Handle of this Lane. */
+    uint8_t next;                       /**< @brief Index of the @ref MLX90614_Handle of this Lane that is either being read or that will be read next. */
+    uint8_t is_issued;                  /**< @brief Flag indicating whether the reading of the Handle \ref next of this Lane is in process ( \c 1 ) or not ( \c 0 ). */
+    uint32_t valid_mask;                /**< @brief Bitmask indicating which samples of this Lane hold the result of a successful reading, where bit \f$n\f$ stands for the sample \f$n\f$ . */
+    uint32_t sweeps;                    /**< @brief Number of times that all the MLX90614 Devices of this Lane have been read. */
+} MLX90614_Bus_Lane;
+
+/**@brief	MLX90614 Multi Bus Structure definition, which concurrently reads MLX90614 Devices wired to different I2C
+ *          Peripherals of the MCU/MPU.
+ *
+ * @details The MLX90614 Devices of each I2C Peripheral are added as a @ref MLX90614_Bus_Lane via the
+ *          @ref add_mlx90614_multi_bus_lane function. Then, every call to the @ref pump_mlx90614_multi_bus function
+ *          (e.g., from the main loop of the application or from a timer) collects the readings that have concluded
+ *          and immediately requests, via @ref get_mlx90614_handle_all_temperatures_async , the reading of the next
+ *          MLX90614 Device of each Lane in a round-robin fashion. In this way, the I2C Peripherals transfer in
+ *          parallel and the aggregate throughput grows with the number of Lanes.
+ *
+ * @note    The members of this structure are managed by the @ref mlx90614 and they must not be modified directly by
+ *          the implementer. Instead, use the @ref init_mlx90614_multi_bus function and the other Multi Bus functions
+ *          of the @ref mlx90614 .
+ */
+typedef struct
+{
+    MLX90614_Bus_Lane lane[MLX90614_MAX_NUMBER_OF_ASYNC_I2C];   /**< @brief Lanes of this Multi Bus, where only the first \ref lane_count of them are used. */
+    uint8_t lane_count;                                         /**< @brief Number of Lanes added to this Multi Bus. */
+    MLX90614_Sample_Callback p_callback;                        /**< @brief Pointer to the function that will be called, from within @ref pump_mlx90614_multi_bus , for every reading of this Multi Bus that either concludes or could not be requested, or \c NULL if none was requested. */
+    uint32_t completed;                                         /**< @brief Number of readings of this Multi Bus that have concluded successfully. */
+    uint32_t failed;                                            /**< @brief Number of readings of this Multi Bus that have either failed or that could not be requested. */
+    uint8_t is_single_sweep;                                    /**< @brief Flag indicating whether each Lane of this Multi Bus stops requesting readings once it has read all of its MLX90614 Devices once ( \c 1 ), which is used by @ref aggregate_mlx90614_handles , or whether it keeps reading them in a round-robin fashion ( \c 0 ). */
+} MLX90614_Multi_Bus;
+
+/**@brief	MLX90614 Aggregate Structure definition, which holds the statistics of the readings of the same
+ *          temperature channel of several redundant MLX90614 Devices (see @ref aggregate_mlx90614_handles ).
+ *
+ * @note    All the statistics are Raw Values, which can be converted into temperature values in the same way as
+ *          the Raw Values of any single MLX90614 Device (e.g., @ref MLX90614_CENTI_KELVIN_PER_RAW_UNIT hundredths of
+ *          Kelvin per unit, where a deviation has no offset).
+ */
+typedef struct
+{
+    uint16_t mean_raw;              /**< @brief Mean of the valid Raw Values, rounded to the nearest integer. */
+    uint16_t median_raw;            /**< @brief Median of the valid Raw Values, where the mean of the two middle ones, rounded down, is taken whenever there is an even number of them. */
+    uint16_t max_deviation_raw;     /**< @brief Largest absolute difference between any of the valid Raw Values and their median. */
+    uint8_t valid_count;            /**< @brief Number of MLX90614 Devices whose Raw Values were valid and, therefore, included in these statistics. */
+    uint32_t valid_mask;            /**< @brief Bitmask indicating which MLX90614 Devices were included in these statistics, where bit \f$n\f$ stands for the Handle \f$n\f$ given to @ref aggregate_mlx90614_handles . */
+} MLX90614_Aggregate;
+
+#ifdef HAL_TIM_MODULE_ENABLED
+/**@brief	MLX90614 PWM Reader Structure definition, which reads the temperature that a MLX90614 Device outputs
+ *          through its PWM output (i.e., through its SDA pin once its PWM mode has been enabled in its EEPROM) via the
+ *          Input Capture of an STM32 Hardware Timer, without any I2C transaction at all.
+ *
+ * @details The implementer has to configure the Hardware Timer (e.g., via the STM32CubeMX) in "PWM Input" mode on
+ *          the pin wired to the PWM output of the MLX90614 Device, which is made of two of its channels capturing the
+ *          same input, where one of them captures the rising edges (i.e., the period) and the other one captures the
+ *          falling edges (i.e., the high time), plus the "Reset Mode" of its Slave Mode Controller triggered by that
+ *          same input. This way, the Hardware Timer keeps the period and high time of the latest PWM cycle in its
+ *          Capture/Compare registers from then on, without any Interrupt or DMA transfer at all, so that the
+ *          temperature can be read at any time with no CPU load other than the conversion itself.<br><br>
+ *          According to the MLX90614 Datasheet, the output of the PWM mode of a MLX90614 Device is given by
+ *          \f$T_{OUT} = \frac{2 t_{2}}{T}(T_{O,MAX} - T_{O,MIN}) + T_{O,MIN}\f$ , where \f$T\f$ stands for the period
+ *          of the PWM, \f$t_{2}\f$ stands for the high time minus the start mark of \f$t_{1} = \frac{T}{8}\f$ and where
+ *          \f$T_{O,MAX}\f$ and \f$T_{O,MIN}\f$ are stored in the EEPROM of the MLX90614 Device (see
+ *          @ref get_mlx90614_handle_pwm_range ). This result is given as a Raw Value, so that it goes through the same
+ *          @ref MLX90614_Filter and conversions to @ref MLX90614_Temp_t units as the I2C readings.
+ *
+ * @note    The Hardware Timer must be clocked so that a whole PWM period fits in its counter (e.g., with a 1MHz
+ *          counter clock for the 1.024ms PWM period of the factory default settings).
+ * @note    The members of this structure are managed by the @ref mlx90614 and they must not be modified directly by
+ *          the implementer. Instead, use the @ref init_mlx90614_pwm function and the other PWM Reader functions of
+ *          the @ref mlx90614 .
+ */
+typedef struct
+{
+    TIM_HandleTypeDef *htim;                                /**< @brief Pointer to the Hardware Timer Handle whose Input Capture measures the PWM output of the MLX90614 Device. */
+    uint32_t period_channel;                                /**< @brief Channel of the Hardware Timer that captures the period of the PWM (e.g., @ref TIM_CHANNEL_1 ). */
+    uint32_t high_channel;                                  /**< @brief Channel of the Hardware Timer that captures the high time of the PWM (e.g., @ref TIM_CHANNEL_2 ). */
+    uint16_t to_max;                                        /**< @brief \f$T_{O,MAX}\f$ of the PWM output in hundredths of Kelvin, as stored in the EEPROM of the MLX90614 Device. */
+    uint16_t to_min;                                        /**< @brief \f$T_{O,MIN}\f$ of the PWM output in hundredths of Kelvin, as stored in the EEPROM of the MLX90614 Device. */
+    MLX90614_Temp_t temperature_type;                       /**< @brief Temperature Type with which this PWM Reader will be responding whenever it is requested to give a temperature value. */
+    float (*p_get_converted_temperature)(uint16_t raw_temp);/**< @brief Pointer to the function that converts a Raw Value into a temperature value of the Temperature Type of this PWM Reader. */
+    MLX90614_Filter *p_filter;                              /**< @brief Pointer to the @ref MLX90614_Filter applied to the Raw Values of this PWM Reader, or \c NULL if none is. */
+} MLX90614_PWM;
+#endif
+
+#if (MLX90614_ENABLE_RTOS)
+/**@brief	MLX90614 RTOS Port Structure definition, which holds the RTOS primitives that the RTOS Port Layer of the
+ *          @ref mlx90614 requires, so that it can be plugged into any RTOS (e.g., FreeRTOS or CMSIS-RTOS2) without
+ *          this @ref mlx90614 depending on any of them.
+ *
+ * @details Each hook must give back @ref MLX90614_EC_OK if it succeeded, or @ref MLX90614_EC_NR if its timeout
+ *          elapsed (where @ref MLX90614_RTOS_WAIT_FOREVER stands for an indefinite wait). The queue given to a
+ *          @ref MLX90614_RTOS_Bus is created by the implementer, and its items must have the size of a pointer to a
+ *          @ref MLX90614_RTOS_Request . The following is an example of these hooks for FreeRTOS:
+ * @code
+  static MLX90614_Status queue_send(void *queue, MLX90614_RTOS_Request *request, uint32_t timeout)
+  {
+      return (xQueueSend((QueueHandle_t) queue, &request, (timeout == MLX90614_RTOS_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(timeout)) == pdPASS) ? MLX90614_EC_OK : MLX90614_EC_NR;
+  }
+  static MLX90614_Status queue_receive(void *queue, MLX90614_RTOS_Request **request, uint32_t timeout)
+  {
+      return (xQueueReceive((QueueHandle_t) queue, request, (timeout == MLX90614_RTOS_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(timeout)) == pdPASS) ? MLX90614_EC_OK : MLX90614_EC_NR;
+  }
+  static void *get_current_task(void)
+  {
+      return xTaskGetCurrentTaskHandle();
+  }
+  static void notify_task(void *task)
+  {
+      xTaskNotifyGive((TaskHandle_t) task);
+  }
+  static MLX90614_Status wait_notification(uint32_t timeout)
+  {
+      return (ulTaskNotifyTake(pdTRUE, (timeout == MLX90614_RTOS_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(timeout)) != 0) ? MLX90614_EC_OK : MLX90614_EC_NR;
+  }
+  static const MLX90614_RTOS_Port freertos_port = {queue_send, queue_receive, get_current_task, notify_task, wait_notification};
+ * @endcode
+ *          With CMSIS-RTOS2, the same hooks map into @ref osMessageQueuePut , @ref osMessageQueueGet ,
+ *          @ref osThreadGetId , @ref osThreadFlagsSet and @ref osThreadFlagsWait respectively.
+ */
+typedef struct MLX90614_RTOS_Request MLX90614_RTOS_Request; /**< @brief Forward declaration of the @ref MLX90614_RTOS_Request type so that it can be used by the @ref MLX90614_RTOS_Port type. */
+typedef struct
+{
+    MLX90614_Status (*p_queue_send)(void *queue, MLX90614_RTOS_Request *request, uint32_t timeout);      /**< @brief Pointer to the hook that sends the given Request pointer to the back of the given queue. */
+    MLX90614_Status (*p_queue_receive)(void *queue, MLX90614_RTOS_Request **request, uint32_t timeout);  /**< @brief Pointer to the hook that receives the Request pointer at the front of the given queue. */
+    void *(*p_get_current_task)(void);                                                                  /**< @brief Pointer to the hook that gives back the handle of the task that calls it. */
+    void (*p_notify_task)(void *task);                                                                  /**< @brief Pointer to the hook that notifies the given task, which must be the one that will wake up the @ref p_wait_notification hook of that task. */
+    MLX90614_Status (*p_wait_notification)(uint32_t timeout);                                           /**< @brief Pointer to the hook that blocks the task that calls it until it is notified. */
+} MLX90614_RTOS_Port;
+
+/**@brief	MLX90614 RTOS Operation definition, which is the type of the functions that a @ref MLX90614_RTOS_Request
+ *          can execute on behalf of its task from the bus-owner task of a @ref MLX90614_RTOS_Bus .
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of the Request.
+ * @param[in,out] arg   Argument of the Request (e.g., a pointer to where a temperature will be stored).
+ *
+ * @return  The @ref MLX90614_Status Exception Code of the operation, which will be given back to the task of the
+ *          Request.
+ */
+typedef MLX90614_Status (*MLX90614_RTOS_Operation)(MLX90614_Handle *hmlx, void *arg);
+
+/**@brief	MLX90614 RTOS Request Structure definition, which holds an operation that a task has requested to be
+ *          executed by the bus-owner task of a @ref MLX90614_RTOS_Bus .
+ *
+ * @note    The Requests are managed by the @ref submit_mlx90614_rtos_request function, which keeps them in the stack
+ *          of the requesting task while they are serviced.
+ */
+struct MLX90614_RTOS_Request
+{
+    MLX90614_RTOS_Operation p_operation;    /**< @brief Pointer to the operation to be executed. */
+    MLX90614_Handle *hmlx;                  /**< @brief Pointer to the @ref MLX90614_Handle with which the operation will be executed. */
+    void *arg;                              /**< @brief Argument with which the operation will be executed. */
+    void *p_task;                           /**< @brief Handle of the task that submitted the Request, which will be notified once it has been serviced. */
+    MLX90614_Status status;                 /**< @brief @ref MLX90614_Status Exception Code with which the operation has concluded. */
+    volatile uint8_t is_done;               /**< @brief Flag indicating whether the Request has been serviced ( \c 1 ) or not ( \c 0 ), which protects the requesting task from any notification that is not the one of its Request. */
+};
+
+/**@brief	MLX90614 RTOS Bus Structure definition, which serializes all the transactions of the MLX90614 Devices
+ *          that share an I2C Peripheral through a single bus-owner task.
+ *
+ * @details Instead of guarding the @ref mlx90614 with a mutex, each task that wants to communicate with a MLX90614
+ *          Device submits a @ref MLX90614_RTOS_Request into the queue of the RTOS Bus of its I2C Peripheral (see
+ *          @ref submit_mlx90614_rtos_request ) and then waits on a task notification, while the bus-owner task of
+ *          that RTOS Bus (see @ref mlx90614_rtos_bus_task ) executes the Requests one at a time. This way, no task
+ *          ever holds a lock of the I2C bus, which removes both the lock contention and the priority inversion that
+ *          a shared mutex causes, where the bus-owner task priority is the only one that defines how the bus is
+ *          served.
+ *
+ * @note    All the @ref MLX90614_Handle of a given I2C Peripheral must be used only through its RTOS Bus, since the
+ *          @ref mlx90614 itself is not thread-safe.
+ */
+typedef struct
+{
+    const MLX90614_RTOS_Port *p_port;   /**< @brief Pointer to the RTOS primitives used by this RTOS Bus. */
+    void *queue;                        /**< @brief Handle of the queue of Request pointers of this RTOS Bus, which is created by the implementer. */
+    uint32_t serviced;                  /**< @brief Number of Requests that have been serviced by this RTOS Bus. */
+} MLX90614_RTOS_Bus;
+#endif
+
+#if (MLX90614_ENABLE_BENCHMARK)
+/**@brief	MLX90614 Benchmark cases definition, which are the ways of obtaining temperatures from a MLX90614 Device
+ *          whose cost is measured by the @ref run_mlx90614_benchmark_case function.
+ *
+ * @note    The cases that make I2C transactions are measured with the SMBus clock and the PEC validation (see
+ *          @ref set_mlx90614_handle_pec_check ) currently configured, whereas the PEC implementation (see
+ *          @ref MLX90614_PEC_IMPLEMENTATION ), the DMA or Interrupt Mode (see @ref MLX90614_ASYNC_USE_DMA ) and the
+ *          Transport (see @ref MLX90614_TRANSPORT ) are compile-time options, so each of them requires its own build
+ *          of the benchmark firmware.
+ */
+typedef enum
+{
+    MLX90614_BENCHMARK_BLOCKING_FLOAT   = 0U,   //!< Blocking reading of a single channel converted into float (i.e., @ref get_mlx90614_handle_object1_temperature ).
+    MLX90614_BENCHMARK_BLOCKING_CENTI   = 1U,   //!< Blocking reading of a single channel converted into hundredths (i.e., @ref get_mlx90614_handle_object1_centi_temperature ).
+    MLX90614_BENCHMARK_BLOCKING_BURST   = 2U,   //!< Blocking reading of all the temperature channels (i.e., @ref get_mlx90614_handle_all_temperatures ), where each sample holds all of them.
+    MLX90614_BENCHMARK_ASYNC_SINGLE     = 3U,   //!< Asynchronous reading of a single channel (i.e., @ref get_mlx90614_handle_object1_temperature_async ), which is polled until it concludes.
+    MLX90614_BENCHMARK_ASYNC_BURST      = 4U,   //!< Asynchronous reading of all the temperature channels (i.e., @ref get_mlx90614_handle_all_temperatures_async ), which is polled until it concludes.
+    MLX90614_BENCHMARK_CONVERT_FLOAT    = 5U,   //!< Float conversion of @ref MLX90614_BENCHMARK_BATCH_SIZE Raw Values (i.e., @ref mlx90614_convert_batch ), without any I2C transaction, where each sample is a single Raw Value.
+    MLX90614_BENCHMARK_CONVERT_CENTI    = 6U,   //!< Integer conversion of @ref MLX90614_BENCHMARK_BATCH_SIZE Raw Values (i.e., @ref mlx90614_convert_centi_batch ), without any I2C transaction, where each sample is a single Raw Value.
+    MLX90614_BENCHMARK_SCAN             = 7U,   //!< Forced scan of the whole I2C bus (i.e., @ref scan_mlx90614_bus with @ref MLX90614_SCAN_PROBE_TIMEOUT ), where each sample is a whole scan. @note This case is only available if @ref MLX90614_ENABLE_SCAN is enabled.
+    MLX90614_BENCHMARK_NUMBER_OF_CASES  = 8U    //!< Number of Benchmark cases.
+} MLX90614_Benchmark_Case;
+
+/**@brief	MLX90614 Benchmark Result Structure definition, which holds what a @ref MLX90614_Benchmark_Case has cost
+ *          over all the iterations with which it was run by the @ref run_mlx90614_benchmark_case function.
+ *
+ * @details The \p total_cycles are measured from the start of each iteration until its temperatures are available
+ *          to the application, whereas the \p cpu_cycles only count the time spent inside the functions of the
+ *          @ref mlx90614 . Both of them are the same for the blocking cases but, for the Asynchronous ones, the
+ *          difference between them is the time during which the CPU is free while the I2C transfer takes place.
+ */
+typedef struct
+{
+    uint32_t samples;               /**< @brief Number of samples that were successfully obtained. */
+    uint32_t errors;                /**< @brief Number of iterations that concluded with an error, which are not included in any of the other members. */
+    uint64_t total_cycles;          /**< @brief Sum of the CPU cycles, measured with @ref MLX90614_CYCLE_COUNTER , that the successful iterations took from their start until their temperatures were available. */
+    uint64_t cpu_cycles;            /**< @brief Sum of the CPU cycles that the successful iterations spent inside the functions of the @ref mlx90614 . */
+    uint32_t cycles_per_sample;     /**< @brief Average of the \p total_cycles per sample, or \c 0 if no sample was obtained. */
+    uint32_t cpu_cycles_per_sample; /**< @brief Average of the \p cpu_cycles per sample, or \c 0 if no sample was obtained. */
+    uint32_t samples_per_second;    /**< @brief Samples per second that the case can give back, which is given by @ref MLX90614_BENCHMARK_CORE_CLOCK divided by the \p cycles_per_sample , or \c 0 if no sample was obtained. */
+} MLX90614_Benchmark_Result;
+#endif
+
 /**@brief	Finds a Device that is ready for I2C communication, if there is any, and configures its slave address to
  *          this @ref mlx90614 .
  *
  * @details This function will start searching for a device via the I2C assigned to this @ref mlx90614 during
  *          the @ref init_mlx90614_module function. The search will start from the lowest slave address value up to
- *          highest one and, if an I2C capable device is actually found, then this function will update the following
- *          Global Static Variables:<br>
- *          - The @ref mlx90614_slave_address Global Static Variable with the value of the MLX90614 device slave address found.
- *          - The @ref mlx90614_slave_address_one_bit_left_shifted Global Static Variable with the value towards which \p mlx90614_slave_address points to, but with one bit shifted to the left, as long as the value towards which \p mlx90614_slave_address points has been successfully updated.
+ *          highest one and, if an I2C capable device is actually found, then this function will update the slave
+ *          address of the Module Handle of the @ref mlx90614 with the value of the MLX90614 device slave address found.
  * @details <i><b style="color:red;"><u>WARNING</u>:</b><b>It is the responsibility of the implementer to make sure that
  *          the I2C capable device wired to the I2C assigned to this @ref mlx90614 , is actually a MLX90614 Infra Red
  *          Thermometer Device because this function will only be able to tell that it found a device ready for I2C
  *          Communication, but it will not be able to know if it is an actual MLX90614 device</b>.</i>
  *
- * @note    Know that if no device is found, then this will mean that @ref mlx90614_slave_address will be disconfigured.
+ * @note    Know that if no device is found, then this will mean that the slave address will be disconfigured.
  *          Therefore, If a functional MLX90614 sensor is connected while the MCU/MPU is still powered-On and running,
  *          then the MCU/MPU will require to either run this function again or to configure the Slave Address of that
  *          sensor via the @ref set_mlx90614_module_slave_address function. However, if the implementer of this library
@@ -462,6 +1254,7 @@ uint8_t get_mlx90614_module_slave_address(void);
  */
 MLX90614_Status set_mlx90614_module_slave_address(uint8_t slave_address);
 
+#if (MLX90614_ENABLE_EEPROM_WRITE)
 /**@brief	Sets a new Slave Address value in the corresponding MLX90614 EEPROM Address and also configures that Slave
  *          Address value in the @ref mlx90614 .<br>
  *          <i><b style="color:red;"><u>WARNING 1</u>:</b><b> Do not have the MLX90614 Device wired to your MCU/MPU
@@ -470,8 +1263,10 @@ MLX90614_Status set_mlx90614_module_slave_address(uint8_t slave_address);
  *
  * @details This function will first validate that the given slave address value is valid for a MLX90614 device. Then,
  *          the Slave Address in the MLX90614 EEPROM will be erased and subsequently written with the new/given slave
- *          address, followed by a delay of @ref MLX90614_ERASE_OR_WRITE_CELL_TIME after each of the erasing and writing
- *          processes. After that, the slave address in the @ref mlx90614 will be updated with the new one. However,
+ *          address, where after each of the erasing and writing processes, the EEPROM cell is read back until it holds
+ *          the expected value within @ref MLX90614_ERASE_OR_WRITE_CELL_TIME (see @ref MLX90614_EEPROM_Write , whose
+ *          @ref start_mlx90614_handle_device_slave_address_write function provides a non-blocking alternative to this
+ *          function). After that, the slave address in the @ref mlx90614 will be updated with the new one. However,
  *          updating that value is probably not worth doing since after that, it is strictly required to Power-Cycle the
  *          MLX90614 (i.e., Software Reset is not going to be enough; make sure to electrically power-Off the MLX90614
  *          Device and then to electrically power it On again), where because of this electrical reset, it is also
@@ -519,6 +1314,7 @@ MLX90614_Status set_mlx90614_module_slave_address(uint8_t slave_address);
  * @date    October 29, 2024.
  */
 MLX90614_Status set_mlx90614_device_slave_address(uint8_t new_slave_address);
+#endif
 
 /**@brief	Gets the Temperature Type with which the @ref mlx90614 is currently responding with whenever a temperature
  *          value is requested from the MLX90614 Infra Red Thermometer.
@@ -646,59 +1442,2498 @@ MLX90614_Status get_mlx90614_object1_temperature(float *dst);
  */
 MLX90614_Status get_mlx90614_object2_temperature(float *dst);
 
-/**@brief   Initializes the @ref mlx90614 in order to be able to use its provided functions and also starts that
- *          module.
+/**@brief	Gets the Ambient, Object1 and Object2 Temperatures from the MLX90614 Infra Red Thermometer Device in a single
+ *          call and in the units corresponding to the currently configured Temperature Type in @ref mlx90614 .
  *
- * @details This function will also update several of its Global Static Pointers and Variables that are used in the
- *          @ref mlx90614.
+ * @details The three temperatures are read back to back and they are then all converted in a single pass, which
+ *          is faster than calling the @ref get_mlx90614_ambient_temperature , @ref get_mlx90614_object1_temperature
+ *          and @ref get_mlx90614_object2_temperature functions one after the other.
  *
- * @note    This Global Static Pointers and variables that will be updated, initialized and/or persisted in the
- *          @ref mlx90614 by this function are the following:<br>
- *          - The @ref p_hi2c Global Static Pointer to point to the address towards which the \p hi2c param points to.
- *          - The @ref mlx90614_slave_address Global Static Variable with the value of the \p slave_address param in the case that it contains a valid value and whenever its value is different than 0, and as long as there is a Device ready for I2C Communication under the given I2C via the \p hi2c param.
- *          - The @ref mlx90614_slave_address_one_bit_left_shifted Global Static Variable with the value towards which \p mlx90614_slave_address points to, but with one bit shifted to the left, as long as the value towards which \p mlx90614_slave_address points has been successfully updated.
- *          - The @ref p_get_mlx90614_object1_temperature Global Static Pointer to point to the address of the corresponding get function of the MLX90614 object1 temperature with respect to the requested Temperature Type via the @ref temp_t param.
- *          - The @ref p_get_mlx90614_object2_temperature Global Static Pointer to point to the address of the corresponding get function of the MLX90614 object2 temperature with respect to the requested Temperature Type via the @ref temp_t param.
- *          - The @ref p_get_mlx90614_ambient_temperature Global Static Pointer to point to the address of the corresponding get function of the MLX90614 ambient temperature with respect to the requested Temperature Type via the @ref temp_t param.
- *          - The @ref mlx90614_temperature_type Global Static Variable containing the Temperature Type with which the @ref mlx90614 will be responding whenever it is requested to give a temperature value.
+ * @param[out] dst  Pointer to the @ref MLX90614_Sample where this function will store the Raw Values and the converted
+ *                  temperatures read from the MLX90614 Infra Red Thermometer Device.
  *
- * @note    <b>This function must be called only once</b> before calling any other function of the @ref mlx90614 .
+ * @retval  MLX90614_EC_OK  If all the temperatures were successfully read with no Error Flags raised by the MLX90614
+ *                          Device and if they were successfully converted and stored into where the \p dst param
+ *                          points to.
+ * @retval  MLX90614_EC_NR  If the MLX90614 Infra Red Thermometer did not respond while attempting to communicate with
+ *                          it via the I2C Communication Protocol.
+ * @retval  MLX90614_EC_ERR If either the MLX90614 Device raised an Error Flag or if anything else went wrong.
  *
- * @param[in] hi2c          Pointer to the I2C is desired for the @ref mlx90614 to use for exchanging information with
- *                          the MLX90614 Infra Red Thermometer via the I2C Communication Protocol.
- * @param slave_address     Slave address value to be configured in the @ref mlx90614, which must match the slave
- *                          address that has been designated in the MLX90614 Infra Red Thermometer.
- *                          The following are the possible values of this param:<br><br>
- *                          * \f$0\f$  = The slave address will not be updated and the default \c 0x5A value will be kept.<br>
- *                          * \f$3_{d}\f$ up to \f$126_{d}\f$ = Update the slave address with the given custom value.<br>
- *                          * \f$1\f$, \f$2\f$ and \f$\geq 127_{d}\f$ = Invalid slave address values.
- * @param temp_t            Desired Temperature Type with which it is desired for the @ref mlx90614 to respond back
- *                          whenever requesting it to get a temperature reading.
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_all_temperatures(MLX90614_Sample *dst);
+
+/**@brief	Converts a given Object1/Object2/Ambient Temperature Raw Value read from a MLX90614 Infra Red Thermometer
+ *          Device into hundredths of the units of the given Temperature Type, by using only integer arithmetic.
  *
- * @retval  MLX90614_EC_OK  If the @ref mlx90614 has been successfully initialized.
- * @retval  MLX90614_EC_NR  If either the given slave address via the @ref slave_address param is incorrect or the
- *                          MLX90614 Infra Red Thermometer wired to our MCU/MPU is not ready for I2C Communication (if
- *                          this happens check that the wiring is correct, that your MLX90614 is functioning correctly
- *                          and that your MCU/MPU I2C peripheral has been correctly configured). If any of these two
- *                          cases give place, then the @ref mlx90614 will not be initialized.
- * @retval  MLX90614_EC_ERR The @ref mlx90614 was not initialized due to one of the following errors:
- *                          <ul>
- *                              <li>
- *                                  If the \p slave_address param contains an invalid slave address value.
- *                              </li>
- *                              <li>
- *                                  If a non-recognized value is given via the \p temp_t param.
- *                              </li>
- *                              <li>
- *                                  If anything else went wrong.
- *                              </li>
- *                          </ul>
+ * @details This function is meant for MCUs/MPUs without an FPU (e.g., Cortex-M0/M0+ devices), where the float
+ *          conversions made by functions such as @ref get_mlx90614_object1_temperature require software emulation of
+ *          the floating point arithmetic. The conversions made by this function are the following, where \f$R\f$
+ *          stands for the Raw Value (whose resolution is of \f$0.02\f$ Kelvin according to the MLX90614 Datasheet):<br>
+ *          - centi-Kelvin: \f$2R\f$ (which is an exact conversion).
+ *          - centi-Celsius: \f$2R - 27315\f$ (which is an exact conversion).
+ *          - centi-Fahrenheit: \f$\frac{9}{5}(2R - 27315) + 3200\f$ , rounded to the nearest integer.
+ *
+ * @param raw_temp  Raw Value of an Object1/Object2/Ambient Temperature, which must not have the Error Flag raised
+ *                  (i.e., it must not be greater than \c 0x7FFF ).
+ * @param temp_t    Temperature Type of the desired result. If an invalid value is given, then the result will be in
+ *                  centi-Kelvin units.
+ *
+ * @return  The temperature in hundredths of the units of the \p temp_t param (e.g., \c 2685 stands for
+ *          \f$26.85^{\circ}C\f$ if \p temp_t equals @ref MLX90614_Temp_C ).
  *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
- * @date    June 19, 2024.
- * @date    LAST UPDATE: October 30, 2024.
+ * @date    October 14, 2026.
  */
-MLX90614_Status init_mlx90614_module(I2C_HandleTypeDef *hi2c, uint8_t slave_address, MLX90614_Temp_t temp_t);
+int32_t get_mlx90614_converted_centi_temperature(uint16_t raw_temp, MLX90614_Temp_t temp_t);
+
+/**@brief	Converts a whole array of Object1/Object2/Ambient Temperature Raw Values read from a MLX90614 Infra Red
+ *          Thermometer Device into temperature values of the given Temperature Type.
+ *
+ * @details This function is meant for post-processing passes over large amounts of Raw Values (e.g., after having
+ *          drained a @ref MLX90614_Ring_Buffer ), where converting them one by one would cost an indirect call per
+ *          sample. Instead, the scale and offset of the requested Temperature Type are fetched once and then applied
+ *          to all the samples in a multiply-accumulate loop that is unrolled by four, which the FPU of Cortex-M4F/M7
+ *          devices can pipeline back to back. In addition, the Error Flag of the MLX90614 Device (i.e., the bit
+ *          \c 0x8000 ) is validated on the whole block at once by ORing all the Raw Values together, instead of doing
+ *          a compare-and-branch per sample.
+ *
+ * @note    The results are identical to those given by the @ref get_mlx90614_object1_temperature function and its
+ *          siblings for the same Raw Values and Temperature Type.
+ *
+ * @param[in] raw   Pointer to the first of the \p n Raw Values to be converted.
+ * @param[out] out  Pointer to the first of the \p n temperature values into which the results will be stored. This
+ *                  may not overlap with \p raw .
+ * @param n         Number of Raw Values to be converted.
+ * @param temp_t    Temperature Type of the desired results. If an invalid value is given, then the results will be in
+ *                  Kelvin units.
+ *
+ * @retval  MLX90614_EC_OK  If all the Raw Values were converted and none of them had the Error Flag raised.
+ * @retval  MLX90614_EC_ERR If at least one of the Raw Values had the Error Flag raised (i.e., it was greater than
+ *                          \c 0x7FFF ), in which case all of them will still be converted, but the results of the
+ *                          flagged ones will be meaningless and it is up to the implementer to find them if required.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status mlx90614_convert_batch(const uint16_t *raw, float *out, size_t n, MLX90614_Temp_t temp_t);
+
+/**@brief	Converts a whole array of Object1/Object2/Ambient Temperature Raw Values read from a MLX90614 Infra Red
+ *          Thermometer Device into hundredths of the units of the given Temperature Type, by using only integer
+ *          arithmetic.
+ *
+ * @details This is the integer counterpart of the @ref mlx90614_convert_batch function, whose results are identical
+ *          to those given by the @ref get_mlx90614_converted_centi_temperature function for the same Raw Values and
+ *          Temperature Type, but where the Temperature Type is resolved once for the whole block.
+ *
+ * @param[in] raw   Pointer to the first of the \p n Raw Values to be converted.
+ * @param[out] out  Pointer to the first of the \p n temperature values, in hundredths of the units of the \p temp_t
+ *                  param, into which the results will be stored. This may not overlap with \p raw .
+ * @param n         Number of Raw Values to be converted.
+ * @param temp_t    Temperature Type of the desired results. If an invalid value is given, then the results will be in
+ *                  centi-Kelvin units.
+ *
+ * @retval  MLX90614_EC_OK  If all the Raw Values were converted and none of them had the Error Flag raised.
+ * @retval  MLX90614_EC_ERR If at least one of the Raw Values had the Error Flag raised (i.e., it was greater than
+ *                          \c 0x7FFF ), in which case all of them will still be converted, but the results of the
+ *                          flagged ones will be meaningless and it is up to the implementer to find them if required.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status mlx90614_convert_centi_batch(const uint16_t *raw, int32_t *out, size_t n, MLX90614_Temp_t temp_t);
+
+/**@brief	Gets the Ambient Temperature from the MLX90614 Infra Red Thermometer Device in hundredths of the units
+ *          corresponding to the currently configured Temperature Type in @ref mlx90614 , by using only integer
+ *          arithmetic.
+ *
+ * @details This function works in the same way as the @ref get_mlx90614_ambient_temperature function, but the
+ *          conversion is made via the @ref get_mlx90614_converted_centi_temperature function.
+ *
+ * @param[out] dst  Pointer to the Memory Address where this function will store the Ambient Temperature value read, in
+ *                  hundredths of the units of the currently configured Temperature Type.
+ *
+ * @retval  MLX90614_EC_OK  If the Ambient Temperature was successfully read, converted and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the MLX90614 Device raised an Error Flag or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_ambient_centi_temperature(int32_t *dst);
+
+/**@brief	Gets the Object1 Temperature from the MLX90614 Infra Red Thermometer Device in hundredths of the units
+ *          corresponding to the currently configured Temperature Type in @ref mlx90614 , by using only integer
+ *          arithmetic.
+ *
+ * @details This function works in the same way as the @ref get_mlx90614_object1_temperature function, but the
+ *          conversion is made via the @ref get_mlx90614_converted_centi_temperature function.
+ *
+ * @param[out] dst  Pointer to the Memory Address where this function will store the Object1 Temperature value read, in
+ *                  hundredths of the units of the currently configured Temperature Type.
+ *
+ * @retval  MLX90614_EC_OK  If the Object1 Temperature was successfully read, converted and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the MLX90614 Device raised an Error Flag or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_object1_centi_temperature(int32_t *dst);
+
+/**@brief	Gets the Object2 Temperature from the MLX90614 Infra Red Thermometer Device in hundredths of the units
+ *          corresponding to the currently configured Temperature Type in @ref mlx90614 , by using only integer
+ *          arithmetic.
+ *
+ * @details This function works in the same way as the @ref get_mlx90614_object2_temperature function, but the
+ *          conversion is made via the @ref get_mlx90614_converted_centi_temperature function.
+ *
+ * @param[out] dst  Pointer to the Memory Address where this function will store the Object2 Temperature value read, in
+ *                  hundredths of the units of the currently configured Temperature Type.
+ *
+ * @retval  MLX90614_EC_OK  If the Object2 Temperature was successfully read, converted and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the MLX90614 Device raised an Error Flag or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_object2_centi_temperature(int32_t *dst);
+
+/**@brief	Requests the Ambient Temperature to the MLX90614 Infra Red Thermometer Device without blocking our MCU/MPU
+ *          while the I2C transaction takes place.
+ *
+ * @details This function will only start the I2C transaction via either the DMA or Interrupt Mode of the I2C
+ *          Peripheral (see @ref MLX90614_ASYNC_USE_DMA ) and will then immediately return. Once that transaction
+ *          concludes, the read value will be validated and converted into the units of the currently configured
+ *          Temperature Type in @ref mlx90614 , and then the \p callback param will be called (if given). The
+ *          implementer may also alternatively poll the @ref get_mlx90614_async_state function and then collect the
+ *          converted value via the @ref get_mlx90614_async_temperature function.
+ *
+ * @note    <i><b style="color:orange;"><u>IMPORTANT-INFORMATION</u>:</b><b>For this function to work, the
+ *          implementer must call the @ref mlx90614_i2c_mem_rx_cplt_callback function from the
+ *          \c HAL_I2C_MemRxCpltCallback function, and the @ref mlx90614_i2c_error_callback function from the
+ *          \c HAL_I2C_ErrorCallback function of the application.</b></i>
+ * @note    Only one Asynchronous temperature reading can be in process at a time.
+ *
+ * @param callback  Pointer to the function that will be called whenever the requested reading concludes, or \c NULL
+ *                  if the implementer wants to poll for its result instead.
+ *
+ * @retval  MLX90614_EC_OK  If the I2C transaction was successfully started.
+ * @retval  MLX90614_EC_NR  If either another Asynchronous temperature reading is still in process or if the I2C
+ *                          Peripheral is currently busy.
+ * @retval  MLX90614_EC_ERR If the I2C transaction could not be started due to any other reason.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_ambient_temperature_async(MLX90614_Async_Callback callback);
+
+/**@brief	Requests the Object1 Temperature to the MLX90614 Infra Red Thermometer Device without blocking our MCU/MPU
+ *          while the I2C transaction takes place.
+ *
+ * @details This function works in the same way as the @ref get_mlx90614_ambient_temperature_async function, but for
+ *          the Object1 Temperature.
+ *
+ * @param callback  Pointer to the function that will be called whenever the requested reading concludes, or \c NULL
+ *                  if the implementer wants to poll for its result instead.
+ *
+ * @retval  MLX90614_EC_OK  If the I2C transaction was successfully started.
+ * @retval  MLX90614_EC_NR  If either another Asynchronous temperature reading is still in process or if the I2C
+ *                          Peripheral is currently busy.
+ * @retval  MLX90614_EC_ERR If the I2C transaction could not be started due to any other reason.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_object1_temperature_async(MLX90614_Async_Callback callback);
+
+/**@brief	Requests the Object2 Temperature to the MLX90614 Infra Red Thermometer Device without blocking our MCU/MPU
+ *          while the I2C transaction takes place.
+ *
+ * @details This function works in the same way as the @ref get_mlx90614_ambient_temperature_async function, but for
+ *          the Object2 Temperature.
+ *
+ * @param callback  Pointer to the function that will be called whenever the requested reading concludes, or \c NULL
+ *                  if the implementer wants to poll for its result instead.
+ *
+ * @retval  MLX90614_EC_OK  If the I2C transaction was successfully started.
+ * @retval  MLX90614_EC_NR  If either another Asynchronous temperature reading is still in process or if the I2C
+ *                          Peripheral is currently busy.
+ * @retval  MLX90614_EC_ERR If the I2C transaction could not be started due to any other reason.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_object2_temperature_async(MLX90614_Async_Callback callback);
+
+/**@brief	Requests the Ambient, Object1 and Object2 Temperatures to the MLX90614 Infra Red Thermometer Device without
+ *          blocking our MCU/MPU while the corresponding I2C transactions take place.
+ *
+ * @details This function will start the I2C transaction of the Ambient Temperature, where each of the subsequent I2C
+ *          transactions are chained from the Interrupt context right after the previous one concludes (see
+ *          @ref mlx90614_i2c_mem_rx_cplt_callback ). Once all of them conclude, all the temperatures are converted in
+ *          a single pass into the units of the currently configured Temperature Type in @ref mlx90614 , and then the
+ *          \p callback param will be called (if given). The implementer may also alternatively poll the
+ *          @ref get_mlx90614_async_state function, where the @ref MLX90614_ASYNC_CPLT state will mean that \p dst has
+ *          been filled.
+ *
+ * @note    The same requirements and restrictions of the @ref get_mlx90614_ambient_temperature_async function apply
+ *          to this function.
+ *
+ * @param[out] dst  Pointer to the @ref MLX90614_Sample where the readings will be stored. <b>It must remain valid
+ *                  until the reading concludes</b>.
+ * @param callback  Pointer to the function that will be called whenever the requested reading concludes, or \c NULL
+ *                  if the implementer wants to poll for its result instead.
+ *
+ * @retval  MLX90614_EC_OK  If the first I2C transaction was successfully started.
+ * @retval  MLX90614_EC_NR  If either another Asynchronous temperature reading is still in process or if the I2C
+ *                          Peripheral is currently busy.
+ * @retval  MLX90614_EC_ERR If the I2C transaction could not be started due to any other reason.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_all_temperatures_async(MLX90614_Sample *dst, MLX90614_Sample_Callback callback);
+
+/**@brief	Gets the current state of the last Asynchronous temperature reading requested to the @ref mlx90614 .
+ *
+ * @return  The current @ref MLX90614_Async_State of the last Asynchronous temperature reading requested.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Async_State get_mlx90614_async_state(void);
+
+/**@brief	Collects the result of the last Asynchronous temperature reading requested to the @ref mlx90614 .
+ *
+ * @details If the last Asynchronous temperature reading has concluded (either successfully or not), then this function
+ *          will also set the Asynchronous reading state of the @ref mlx90614 back to @ref MLX90614_ASYNC_IDLE .
+ *
+ * @param[out] dst  Pointer to the Memory Address where this function will store the converted temperature value.
+ *
+ * @retval  MLX90614_EC_OK  If the last Asynchronous temperature reading was successful and its converted value was
+ *                          stored into where the \p dst param points to.
+ * @retval  MLX90614_EC_NA  If there is no concluded Asynchronous temperature reading to collect (i.e., if it is still
+ *                          in process or if none was requested).
+ * @retval  MLX90614_EC_NR  If the MLX90614 Infra Red Thermometer did not respond during the last Asynchronous
+ *                          temperature reading.
+ * @retval  MLX90614_EC_ERR If either the MLX90614 Device raised an Error Flag or if anything else went wrong during the
+ *                          last Asynchronous temperature reading.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_async_temperature(float *dst);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_async_temperature function, but gives the temperature in
+ *          hundredths of the units of the currently configured Temperature Type in @ref mlx90614 (see
+ *          @ref get_mlx90614_converted_centi_temperature ).
+ *
+ * @param[out] dst  Pointer to the Memory Address where this function will store the converted temperature value.
+ *
+ * @retval  MLX90614_EC_OK  If the last Asynchronous temperature reading was successful and its converted value was
+ *                          stored into where the \p dst param points to.
+ * @retval  MLX90614_EC_NA  If there is no concluded Asynchronous temperature reading to collect.
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond during the last Asynchronous temperature reading.
+ * @retval  MLX90614_EC_ERR If either the MLX90614 Device raised an Error Flag or if anything else went wrong during the
+ *                          last Asynchronous temperature reading.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_async_centi_temperature(int32_t *dst);
+
+/**@brief	Processes the conclusion of an Asynchronous temperature reading of the @ref mlx90614 .
+ *
+ * @note    This function must be called by the implementer from the \c HAL_I2C_MemRxCpltCallback function of the
+ *          application. It is safe to call it for any I2C Peripheral, since this function will ignore the I2C
+ *          Peripherals that do not have an Asynchronous temperature reading of the @ref mlx90614 in process.
+ *
+ * @param[in] hi2c  Pointer to the I2C Handle Structure whose memory reception has completed.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void mlx90614_i2c_mem_rx_cplt_callback(I2C_HandleTypeDef *hi2c);
+
+/**@brief	Processes an I2C error that took place during an Asynchronous temperature reading of the @ref mlx90614 .
+ *
+ * @note    This function must be called by the implementer from the \c HAL_I2C_ErrorCallback function of the
+ *          application. It is safe to call it for any I2C Peripheral, since this function will ignore the I2C
+ *          Peripherals that do not have an Asynchronous temperature reading of the @ref mlx90614 in process.
+ *
+ * @param[in] hi2c  Pointer to the I2C Handle Structure in which the error took place.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void mlx90614_i2c_error_callback(I2C_HandleTypeDef *hi2c);
+
+/**@brief   Initializes the @ref mlx90614 in order to be able to use its provided functions and also starts that
+ *          module.
+ *
+ * @details This function initializes the Module Handle of the @ref mlx90614 (see @ref get_mlx90614_module_handle ) via
+ *          the @ref init_mlx90614_handle function, which is the @ref MLX90614_Handle that all the functions of the
+ *          @ref mlx90614 that do not receive a @ref MLX90614_Handle will work with.
+ *
+ * @note    <b>This function must be called only once</b> before calling any other function of the @ref mlx90614 that
+ *          does not receive a @ref MLX90614_Handle .
+ *
+ * @param[in] hi2c          Pointer to the I2C is desired for the @ref mlx90614 to use for exchanging information with
+ *                          the MLX90614 Infra Red Thermometer via the I2C Communication Protocol.
+ * @param slave_address     Slave address value to be configured in the @ref mlx90614, which must match the slave
+ *                          address that has been designated in the MLX90614 Infra Red Thermometer.
+ *                          The following are the possible values of this param:<br><br>
+ *                          * \f$0\f$  = The slave address will not be updated and the default \c 0x5A value will be kept.<br>
+ *                          * \f$3_{d}\f$ up to \f$126_{d}\f$ = Update the slave address with the given custom value.<br>
+ *                          * \f$1\f$, \f$2\f$ and \f$\geq 127_{d}\f$ = Invalid slave address values.
+ * @param temp_t            Desired Temperature Type with which it is desired for the @ref mlx90614 to respond back
+ *                          whenever requesting it to get a temperature reading.
+ *
+ * @retval  MLX90614_EC_OK  If the @ref mlx90614 has been successfully initialized.
+ * @retval  MLX90614_EC_NR  If either the given slave address via the @ref slave_address param is incorrect or the
+ *                          MLX90614 Infra Red Thermometer wired to our MCU/MPU is not ready for I2C Communication (if
+ *                          this happens check that the wiring is correct, that your MLX90614 is functioning correctly
+ *                          and that your MCU/MPU I2C peripheral has been correctly configured). If any of these two
+ *                          cases give place, then the @ref mlx90614 will not be initialized.
+ * @retval  MLX90614_EC_ERR The @ref mlx90614 was not initialized due to one of the following errors:
+ *                          <ul>
+ *                              <li>
+ *                                  If the \p slave_address param contains an invalid slave address value.
+ *                              </li>
+ *                              <li>
+ *                                  If a non-recognized value is given via the \p temp_t param.
+ *                              </li>
+ *                              <li>
+ *                                  If anything else went wrong.
+ *                              </li>
+ *                          </ul>
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    June 19, 2024.
+ * @date    LAST UPDATE: October 30, 2024.
+ */
+MLX90614_Status init_mlx90614_module(I2C_HandleTypeDef *hi2c, uint8_t slave_address, MLX90614_Temp_t temp_t);
+
+/**@brief   Gets the Module Handle of the @ref mlx90614 , which is the @ref MLX90614_Handle used by all the functions of
+ *          the @ref mlx90614 that do not receive a @ref MLX90614_Handle .
+ *
+ * @details This is useful to be able to use the Handle-based functions of the @ref mlx90614 with the MLX90614 Device
+ *          that was configured via the @ref init_mlx90614_module function.
+ *
+ * @return  Pointer to the Module Handle of the @ref mlx90614 .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Handle *get_mlx90614_module_handle(void);
+
+/**@brief   Initializes a @ref MLX90614_Handle so that it can be used with the Handle-based functions of the
+ *          @ref mlx90614 to communicate with a particular MLX90614 Device.
+ *
+ * @details This function works in the same way as the @ref init_mlx90614_module function, but it will initialize the
+ *          given @ref MLX90614_Handle instead of the Module Handle of the @ref mlx90614 . In this way, several
+ *          @ref MLX90614_Handle can be initialized in order to communicate with several MLX90614 Devices that may be
+ *          wired to either the same or different I2C Peripherals of the MCU/MPU.
+ *
+ * @note    The given @ref MLX90614_Handle will not be modified if this function does not conclude successfully.
+ *
+ * @param[out] hmlx         Pointer to the @ref MLX90614_Handle that wants to be initialized.
+ * @param[in] hi2c          Pointer to the I2C that the MLX90614 Device of \p hmlx is wired to.
+ * @param slave_address     Slave address of the MLX90614 Device of \p hmlx . The following are the possible values of
+ *                          this param:<br><br>
+ *                          * \f$0\f$  = The default \c 0x5A slave address will be used.<br>
+ *                          * \f$3_{d}\f$ up to \f$126_{d}\f$ = Use the given custom slave address value.<br>
+ *                          * \f$1\f$, \f$2\f$ and \f$\geq 127_{d}\f$ = Invalid slave address values.
+ * @param temp_t            Desired Temperature Type with which it is desired for \p hmlx to respond back whenever
+ *                          requesting it to get a temperature reading.
+ *
+ * @retval  MLX90614_EC_OK  If \p hmlx has been successfully initialized.
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device is not ready for I2C Communication under the given custom slave
+ *                          address, which is only probed if @ref MLX90614_DEFAULT_ADDRESS_VALIDATION is
+ *                          @ref MLX90614_ADDRESS_VALIDATION_PROBE .
+ * @retval  MLX90614_EC_ERR If either the \p slave_address or \p temp_t params contain an invalid value.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status init_mlx90614_handle(MLX90614_Handle *hmlx, I2C_HandleTypeDef *hi2c, uint8_t slave_address, MLX90614_Temp_t temp_t);
+
+/**@brief	Works in the same way as the @ref find_mlx90614_slave_address function, but on the given
+ *          @ref MLX90614_Handle .
+ *
+ * @note    Since the slave address found has just acknowledged its device, it is marked as verified (see
+ *          @ref is_mlx90614_handle_slave_address_verified ).
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle whose I2C will be searched and whose slave address will be
+ *                      updated with the one found.
+ *
+ * @retval  MLX90614_EC_OK  If a device was found to be ready for I2C communication and if its slave address was
+ *                          successfully configured in \p hmlx .
+ * @retval  MLX90614_EC_NR  If no device was found to be ready for I2C communication.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status find_mlx90614_handle_slave_address(MLX90614_Handle *hmlx);
+
+/**@brief	Gets the slave address of the MLX90614 Device that is currently configured in the given
+ *          @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle whose slave address is requested.
+ *
+ * @return  The slave address currently configured in \p hmlx .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint8_t get_mlx90614_handle_slave_address(MLX90614_Handle *hmlx);
+
+/**@brief	Works in the same way as the @ref set_mlx90614_module_slave_address function, but on the given
+ *          @ref MLX90614_Handle .
+ *
+ * @param[in,out] hmlx      Pointer to the @ref MLX90614_Handle whose slave address wants to be changed.
+ * @param slave_address     Slave address value that must match the one that has been designated to the MLX90614
+ *                          Device (i.e., from \f$3_{d}\f$ up to \f$126_{d}\f$ ).
+ *
+ * @note    The way in which the given slave address is validated depends on the Slave Address Validation of \p hmlx
+ *          (see @ref set_mlx90614_handle_address_validation ).
+ *
+ * @retval  MLX90614_EC_OK  If the given slave address was successfully validated and configured in \p hmlx .
+ * @retval  MLX90614_EC_NR  If there was no MLX90614 device ready for an I2C communication, or if the given slave
+ *                          address was not found in the @ref MLX90614_Scan_Result attached to \p hmlx .
+ * @retval  MLX90614_EC_ERR If the \p slave_address param contains an invalid slave address value.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status set_mlx90614_handle_slave_address(MLX90614_Handle *hmlx, uint8_t slave_address);
+
+/**@brief	Sets the Slave Address Validation with which the given @ref MLX90614_Handle will accept each new slave
+ *          address given to it via the @ref set_mlx90614_handle_slave_address function.
+ *
+ * @details With @ref MLX90614_ADDRESS_VALIDATION_PROBE , which is the behaviour of the @ref mlx90614 by default, each
+ *          new slave address is accepted only after a blocking @ref HAL_I2C_IsDeviceReady probe under it has
+ *          succeeded, which may take up to the timeout of the @ref MLX90614_Retry_Policy of \p hmlx whenever the
+ *          MLX90614 Device is slow to come up.
+ * @details With @ref MLX90614_ADDRESS_VALIDATION_LAZY , each new slave address is accepted right away without any I2C
+ *          transaction, which makes switching between several known MLX90614 Devices a pure RAM operation. The first
+ *          successful reading under that slave address is then taken as the proof that the MLX90614 Device is there
+ *          (see @ref is_mlx90614_handle_slave_address_verified ), and any reading that fails before that with a NACK
+ *          is reported as @ref MLX90614_EC_NR .
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle whose Slave Address Validation wants to be set.
+ * @param validation    Slave Address Validation desired for \p hmlx , which can be either
+ *                      @ref MLX90614_ADDRESS_VALIDATION_PROBE or @ref MLX90614_ADDRESS_VALIDATION_LAZY . To validate
+ *                      against a @ref MLX90614_Scan_Result , use the @ref set_mlx90614_handle_address_scan function
+ *                      instead.
+ *
+ * @retval  MLX90614_EC_OK  If the given Slave Address Validation was successfully set in \p hmlx .
+ * @retval  MLX90614_EC_ERR If the \p validation param contains an invalid value.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status set_mlx90614_handle_address_validation(MLX90614_Handle *hmlx, uint8_t validation);
+
+#if (MLX90614_ENABLE_SCAN)
+/**@brief	Makes the given @ref MLX90614_Handle validate each new slave address given to it via the
+ *          @ref set_mlx90614_handle_slave_address function against the given @ref MLX90614_Scan_Result (i.e., with
+ *          the @ref MLX90614_ADDRESS_VALIDATION_SCAN Slave Address Validation).
+ *
+ * @details In this way, a slave address is accepted without any I2C transaction whenever it is found in \p scan and
+ *          it is rejected with @ref MLX90614_EC_NR otherwise. However, whenever \p scan does not hold a completed scan
+ *          (e.g., after it has been invalidated via @ref invalidate_mlx90614_scan ), the new slave addresses are probed
+ *          in the same way as with @ref MLX90614_ADDRESS_VALIDATION_PROBE .
+ *
+ * @note    The given @ref MLX90614_Scan_Result must have been filled with a scan of the I2C bus of \p hmlx and it must
+ *          remain valid for as long as it is attached to \p hmlx .
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle whose Slave Address Validation wants to be set.
+ * @param[in] scan      Pointer to the @ref MLX90614_Scan_Result that wants to be attached to \p hmlx .
+ *
+ * @retval  MLX90614_EC_OK  If the given @ref MLX90614_Scan_Result was successfully attached to \p hmlx .
+ * @retval  MLX90614_EC_ERR If the \p scan param is \c NULL .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status set_mlx90614_handle_address_scan(MLX90614_Handle *hmlx, const MLX90614_Scan_Result *scan);
+#endif
+
+/**@brief	Indicates whether a MLX90614 Device has already been confirmed to respond under the current slave address
+ *          of the given @ref MLX90614_Handle , either by a successful probe or by a successful reading.
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle whose slave address is evaluated.
+ *
+ * @retval  1   If the current slave address of \p hmlx has already been confirmed.
+ * @retval  0   If the current slave address of \p hmlx has not been confirmed yet.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint8_t is_mlx90614_handle_slave_address_verified(MLX90614_Handle *hmlx);
+
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+/**@brief	Works in the same way as the @ref set_mlx90614_device_slave_address function, but on the MLX90614 Device
+ *          of the given @ref MLX90614_Handle .<br>
+ *          <i><b style="color:red;"><u>WARNING</u>:</b><b> All the warnings given in the
+ *          @ref set_mlx90614_device_slave_address function also apply to this function.</b></i>
+ *
+ * @param[in,out] hmlx          Pointer to the @ref MLX90614_Handle of the MLX90614 Device whose EEPROM Slave Address
+ *                              wants to be changed.
+ * @param new_slave_address     New slave address value (i.e., from \f$3_{d}\f$ up to \f$126_{d}\f$ ).
+ *
+ * @retval  MLX90614_EC_OK  If the given slave address was successfully validated; stored in the MLX90614 EEPROM; and
+ *                          configured in \p hmlx .
+ * @retval  MLX90614_EC_NR  If there was no MLX90614 device ready for an I2C communication.
+ * @retval  MLX90614_EC_ERR If either the \p new_slave_address param contains an invalid slave address value or if
+ *                          anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status set_mlx90614_handle_device_slave_address(MLX90614_Handle *hmlx, uint8_t new_slave_address);
+#endif
+
+/**@brief	Gets the Temperature Type with which the given @ref MLX90614_Handle is currently responding with.
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle whose Temperature Type is requested.
+ *
+ * @return  The Temperature Type with which \p hmlx is currently responding with.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Temp_t get_mlx90614_handle_temperature_type(MLX90614_Handle *hmlx);
+
+/**@brief	Sets and configures a new Temperature Type in the given @ref MLX90614_Handle .
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle whose Temperature Type wants to be changed.
+ * @param temp_t        Temperature Type that wants to be configured in \p hmlx .
+ *
+ * @retval  MLX90614_EC_OK  If the given Temperature Type is valid and was successfully configured in \p hmlx .
+ * @retval  MLX90614_EC_ERR If the \p temp_t param has an invalid value.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status set_mlx90614_handle_temperature_type(MLX90614_Handle *hmlx, MLX90614_Temp_t temp_t);
+
+/**@brief	Enables or disables the validation of the PEC byte on every reading made with the given
+ *          @ref MLX90614_Handle .
+ *
+ * @details Whenever the PEC validation is enabled, every reading made from the MLX90614 Device (either temperatures or
+ *          EEPROM values) will request one additional byte to it, which is the PEC byte that the MLX90614 Device sends
+ *          at the end of each reading. This PEC byte is then validated against the one calculated by our MCU/MPU (see
+ *          @ref MLX90614_PEC_IMPLEMENTATION ) so that corrupted readings are detected and rejected with
+ *          @ref MLX90614_EC_ERR .
+ *
+ * @note    The PEC validation is disabled by default whenever initializing a @ref MLX90614_Handle . Use the
+ *          @ref get_mlx90614_module_handle function to use this function with the Module Handle of the @ref mlx90614 .
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle whose PEC validation wants to be configured.
+ * @param is_enabled    \c 1 to enable the PEC validation or \c 0 to disable it.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void set_mlx90614_handle_pec_check(MLX90614_Handle *hmlx, uint8_t is_enabled);
+
+/**@brief	Gets whether the validation of the PEC byte on every reading is currently enabled in the given
+ *          @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle whose PEC validation configuration is requested.
+ *
+ * @retval  1   If the PEC validation is enabled.
+ * @retval  0   If the PEC validation is disabled.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint8_t get_mlx90614_handle_pec_check(MLX90614_Handle *hmlx);
+
+/**@brief	Sets the @ref MLX90614_Retry_Policy with which the blocking I2C transactions of the given
+ *          @ref MLX90614_Handle will be timed out and retried.
+ *
+ * @note    Whenever initializing a @ref MLX90614_Handle , its @ref MLX90614_Retry_Policy is set with a timeout of
+ *          @ref MLX90614_I2C_TIMEOUT , @ref MLX90614_DEFAULT_RETRIES retries, a backoff of
+ *          @ref MLX90614_DEFAULT_BACKOFF up to @ref MLX90614_DEFAULT_MAX_BACKOFF and with the fail-fast option
+ *          disabled. Use the @ref get_mlx90614_module_handle function to use this function with the Module Handle of
+ *          the @ref mlx90614 .
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle whose Retry Policy wants to be configured.
+ * @param[in] policy    Pointer to the @ref MLX90614_Retry_Policy to be copied into \p hmlx .
+ *
+ * @retval  MLX90614_EC_OK  If the Retry Policy was successfully set.
+ * @retval  MLX90614_EC_ERR If the timeout of \p policy is zero.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status set_mlx90614_handle_retry_policy(MLX90614_Handle *hmlx, const MLX90614_Retry_Policy *policy);
+
+/**@brief	Gets the @ref MLX90614_Retry_Policy currently configured in the given @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle whose Retry Policy is requested.
+ * @param[out] dst  Pointer to the @ref MLX90614_Retry_Policy into which the Retry Policy will be copied.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void get_mlx90614_handle_retry_policy(MLX90614_Handle *hmlx, MLX90614_Retry_Policy *dst);
+
+/**@brief	Recovers an I2C bus that has been locked up by a slave device that holds SDA low (e.g., after a brownout in
+ *          the middle of a transaction), and then re-initializes its I2C Peripheral.
+ *
+ * @details This function de-initializes the given I2C Peripheral and drives its pins as open-drain GPIOs, where up to
+ *          @ref MLX90614_BUS_RECOVERY_CLOCKS clock pulses are generated on SCL until the slave device releases SDA,
+ *          followed by a STOP condition. Then, the I2C Peripheral is reset via its Software Reset bit (if it has one,
+ *          which clears the BUSY flag that some of them keep raised after a bus lockup) and it is initialized again
+ *          with its current configuration via @ref HAL_I2C_Init , which also gives its pins back to the I2C
+ *          Peripheral through its MSP initialization.
+ *
+ * @note    Any other transaction in process on the given I2C Peripheral is aborted by this function.
+ *
+ * @param[in,out] hi2c      Pointer to the I2C Handle Structure of the I2C Peripheral to be recovered.
+ * @param[in] recovery      Pointer to the @ref MLX90614_Bus_Recovery pins of \p hi2c .
+ *
+ * @retval  MLX90614_EC_OK  If SDA was released and the I2C Peripheral was successfully initialized again.
+ * @retval  MLX90614_EC_ERR If SDA remained low after all the clock pulses, or if the I2C Peripheral could not be
+ *                          initialized again.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status recover_mlx90614_i2c_bus(I2C_HandleTypeDef *hi2c, const MLX90614_Bus_Recovery *recovery);
+
+/**@brief	Enables or disables the automatic recovery of the I2C bus of the given @ref MLX90614_Handle .
+ *
+ * @details Whenever enabled, every blocking I2C transaction of the given @ref MLX90614_Handle that the HAL rejects
+ *          with @ref HAL_BUSY (i.e., because the I2C bus is found to be stuck) triggers a
+ *          @ref recover_mlx90614_i2c_bus of that I2C bus, after which that transaction is retried once. This way, a
+ *          bus lockup costs a single failed sample instead of requiring a power cycle of the board.
+ *
+ * @note    Since the HAL also gives back @ref HAL_BUSY whenever the I2C Peripheral is merely in use, the recovery is
+ *          only attempted if that I2C Peripheral is ready, if it has no Asynchronous reading of the @ref mlx90614 in
+ *          process (e.g., of a @ref MLX90614_Scheduler or a @ref MLX90614_Multi_Bus ) and if SDA is being held low.
+ *
+ * @note    The automatic recovery is disabled by default whenever initializing a @ref MLX90614_Handle . Use the
+ *          @ref get_mlx90614_module_handle function to use this function with the Module Handle of the @ref mlx90614 .
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle whose automatic recovery wants to be configured.
+ * @param[in] recovery  Pointer to the @ref MLX90614_Bus_Recovery pins of the I2C Peripheral of \p hmlx , which must
+ *                      remain valid for as long as they are used, or \c NULL to disable the automatic recovery.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void set_mlx90614_handle_bus_recovery(MLX90614_Handle *hmlx, const MLX90614_Bus_Recovery *recovery);
+
+/**@brief	Sets the Freshness Window of the Freshness Cache of the given @ref MLX90614_Handle , which also
+ *          invalidates all of its cached Raw Values.
+ *
+ * @details The Freshness Cache holds the last Raw Value received by \p hmlx for each temperature channel, either via
+ *          its blocking or its Asynchronous readings. Then, any blocking reading of a temperature channel (e.g., via
+ *          @ref get_mlx90614_handle_object1_temperature ) that is requested within the Freshness Window of its cached
+ *          Raw Value is served from the Freshness Cache without any I2C transaction. This is meant for whenever
+ *          several tasks independently read the same MLX90614 Device faster than it refreshes its RAM, since those
+ *          extra readings could only give back the same RAM values anyway.
+ *
+ * @note    A reading can bypass the Freshness Cache via the @ref get_mlx90614_handle_raw_temperature function.
+ * @note    The Freshness Cache is also invalidated whenever the slave address of \p hmlx is changed (e.g., via
+ *          @ref set_mlx90614_handle_slave_address or @ref find_mlx90614_handle_slave_address ).
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of interest.
+ * @param window        Freshness Window in units of @ref MLX90614_TIMESTAMP (i.e., milliseconds by default), which
+ *                      should not be greater than the time that the MLX90614 Device takes to refresh its RAM with its
+ *                      current IIR and FIR settings, or \c 0 to disable the Freshness Cache.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void set_mlx90614_handle_freshness_window(MLX90614_Handle *hmlx, uint32_t window);
+
+/**@brief	Invalidates all the cached Raw Values of the Freshness Cache of the given @ref MLX90614_Handle , so that
+ *          the next reading of each temperature channel is made via an I2C transaction.
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of interest.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void invalidate_mlx90614_handle_cache(MLX90614_Handle *hmlx);
+
+/**@brief	Gets the Raw Value of the given temperature channel of the MLX90614 Device of the given
+ *          @ref MLX90614_Handle , which is served from its Freshness Cache (see
+ *          @ref set_mlx90614_handle_freshness_window ) unless requested otherwise.
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param channel       @ref MLX90614_Channel_t of the temperature channel that wants to be read.
+ * @param is_forced     \c 1 to read the MLX90614 Device via an I2C transaction even if the Freshness Cache holds a
+ *                      Raw Value within its Freshness Window, or \c 0 otherwise.
+ * @param[out] dst      Pointer to the Memory Address where this function will store the Raw Value, after having
+ *                      been filtered (see @ref set_mlx90614_handle_filter ).
+ *
+ * @retval  MLX90614_EC_OK  If the Raw Value was successfully obtained.
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the \p channel param is invalid, if the MLX90614 Device raised an Error Flag, if
+ *                          the PEC validation failed or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_raw_temperature(MLX90614_Handle *hmlx, MLX90614_Channel_t channel, uint8_t is_forced, uint16_t *dst);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_ambient_temperature function, but with the MLX90614 Device of
+ *          the given @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the temperature is requested.
+ * @param[out] dst  Pointer to the Memory Address where this function will store the Ambient Temperature value read.
+ *
+ * @retval  MLX90614_EC_OK  If the Ambient Temperature was successfully read, converted and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the MLX90614 Device raised an Error Flag, if the PEC validation failed (see
+ *                          @ref set_mlx90614_handle_pec_check ) or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_ambient_temperature(MLX90614_Handle *hmlx, float *dst);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_object1_temperature function, but with the MLX90614 Device of
+ *          the given @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the temperature is requested.
+ * @param[out] dst  Pointer to the Memory Address where this function will store the Object1 Temperature value read.
+ *
+ * @retval  MLX90614_EC_OK  If the Object1 Temperature was successfully read, converted and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the MLX90614 Device raised an Error Flag, if the PEC validation failed (see
+ *                          @ref set_mlx90614_handle_pec_check ) or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_object1_temperature(MLX90614_Handle *hmlx, float *dst);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_object2_temperature function, but with the MLX90614 Device of
+ *          the given @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the temperature is requested.
+ * @param[out] dst  Pointer to the Memory Address where this function will store the Object2 Temperature value read.
+ *
+ * @retval  MLX90614_EC_OK  If the Object2 Temperature was successfully read, converted and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the MLX90614 Device raised an Error Flag, if the PEC validation failed (see
+ *                          @ref set_mlx90614_handle_pec_check ) or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_object2_temperature(MLX90614_Handle *hmlx, float *dst);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_all_temperatures function, but with the MLX90614 Device of
+ *          the given @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the temperatures are
+ *                  requested.
+ * @param[out] dst  Pointer to the @ref MLX90614_Sample where this function will store the readings.
+ *
+ * @retval  MLX90614_EC_OK  If all the temperatures were successfully read, converted and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the MLX90614 Device raised an Error Flag, if the PEC validation failed (see
+ *                          @ref set_mlx90614_handle_pec_check ) or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_all_temperatures(MLX90614_Handle *hmlx, MLX90614_Sample *dst);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_ambient_centi_temperature function, but with the MLX90614
+ *          Device of the given @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the temperature is requested.
+ * @param[out] dst  Pointer to the Memory Address where this function will store the Ambient Temperature value read, in
+ *                  hundredths of the units of the Temperature Type of \p hmlx .
+ *
+ * @retval  MLX90614_EC_OK  If the Ambient Temperature was successfully read, converted and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the MLX90614 Device raised an Error Flag, if the PEC validation failed or if
+ *                          anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_ambient_centi_temperature(MLX90614_Handle *hmlx, int32_t *dst);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_object1_centi_temperature function, but with the MLX90614
+ *          Device of the given @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the temperature is requested.
+ * @param[out] dst  Pointer to the Memory Address where this function will store the Object1 Temperature value read, in
+ *                  hundredths of the units of the Temperature Type of \p hmlx .
+ *
+ * @retval  MLX90614_EC_OK  If the Object1 Temperature was successfully read, converted and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the MLX90614 Device raised an Error Flag, if the PEC validation failed or if
+ *                          anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_object1_centi_temperature(MLX90614_Handle *hmlx, int32_t *dst);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_object2_centi_temperature function, but with the MLX90614
+ *          Device of the given @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the temperature is requested.
+ * @param[out] dst  Pointer to the Memory Address where this function will store the Object2 Temperature value read, in
+ *                  hundredths of the units of the Temperature Type of \p hmlx .
+ *
+ * @retval  MLX90614_EC_OK  If the Object2 Temperature was successfully read, converted and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the MLX90614 Device raised an Error Flag, if the PEC validation failed or if
+ *                          anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_object2_centi_temperature(MLX90614_Handle *hmlx, int32_t *dst);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_ambient_temperature_async function, but with the MLX90614
+ *          Device of the given @ref MLX90614_Handle .
+ *
+ * @note    Asynchronous temperature readings of different @ref MLX90614_Handle can be in process at the same time as
+ *          long as they use different I2C Peripherals (see @ref MLX90614_MAX_NUMBER_OF_ASYNC_I2C ).
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the temperature is
+ *                      requested.
+ * @param callback      Pointer to the function that will be called whenever the requested reading concludes, or
+ *                      \c NULL if the implementer wants to poll for its result instead.
+ *
+ * @retval  MLX90614_EC_OK  If the I2C transaction was successfully started.
+ * @retval  MLX90614_EC_NR  If either another Asynchronous temperature reading is still in process in the I2C of
+ *                          \p hmlx or if that I2C Peripheral is currently busy.
+ * @retval  MLX90614_EC_ERR If the I2C transaction could not be started due to any other reason.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_ambient_temperature_async(MLX90614_Handle *hmlx, MLX90614_Async_Callback callback);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_object1_temperature_async function, but with the MLX90614
+ *          Device of the given @ref MLX90614_Handle .
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the temperature is
+ *                      requested.
+ * @param callback      Pointer to the function that will be called whenever the requested reading concludes, or
+ *                      \c NULL if the implementer wants to poll for its result instead.
+ *
+ * @retval  MLX90614_EC_OK  If the I2C transaction was successfully started.
+ * @retval  MLX90614_EC_NR  If either another Asynchronous temperature reading is still in process in the I2C of
+ *                          \p hmlx or if that I2C Peripheral is currently busy.
+ * @retval  MLX90614_EC_ERR If the I2C transaction could not be started due to any other reason.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_object1_temperature_async(MLX90614_Handle *hmlx, MLX90614_Async_Callback callback);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_object2_temperature_async function, but with the MLX90614
+ *          Device of the given @ref MLX90614_Handle .
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the temperature is
+ *                      requested.
+ * @param callback      Pointer to the function that will be called whenever the requested reading concludes, or
+ *                      \c NULL if the implementer wants to poll for its result instead.
+ *
+ * @retval  MLX90614_EC_OK  If the I2C transaction was successfully started.
+ * @retval  MLX90614_EC_NR  If either another Asynchronous temperature reading is still in process in the I2C of
+ *                          \p hmlx or if that I2C Peripheral is currently busy.
+ * @retval  MLX90614_EC_ERR If the I2C transaction could not be started due to any other reason.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_object2_temperature_async(MLX90614_Handle *hmlx, MLX90614_Async_Callback callback);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_all_temperatures_async function, but with the MLX90614
+ *          Device of the given @ref MLX90614_Handle .
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the temperatures are
+ *                      requested.
+ * @param[out] dst      Pointer to the @ref MLX90614_Sample where the readings will be stored. <b>It must remain valid
+ *                      until the reading concludes</b>.
+ * @param callback      Pointer to the function that will be called whenever the requested reading concludes, or
+ *                      \c NULL if the implementer wants to poll for its result instead.
+ *
+ * @retval  MLX90614_EC_OK  If the first I2C transaction was successfully started.
+ * @retval  MLX90614_EC_NR  If either another Asynchronous temperature reading is still in process in the I2C of
+ *                          \p hmlx or if that I2C Peripheral is currently busy.
+ * @retval  MLX90614_EC_ERR If the I2C transaction could not be started due to any other reason.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_all_temperatures_async(MLX90614_Handle *hmlx, MLX90614_Sample *dst, MLX90614_Sample_Callback callback);
+
+/**@brief	Gets the current state of the last Asynchronous temperature reading requested with the given
+ *          @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle whose Asynchronous reading state is requested.
+ *
+ * @return  The current @ref MLX90614_Async_State of the last Asynchronous temperature reading of \p hmlx .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Async_State get_mlx90614_handle_async_state(MLX90614_Handle *hmlx);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_async_temperature function, but with the given
+ *          @ref MLX90614_Handle .
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle whose Asynchronous temperature reading wants to be
+ *                      collected.
+ * @param[out] dst      Pointer to the Memory Address where this function will store the converted temperature value.
+ *
+ * @retval  MLX90614_EC_OK  If the last Asynchronous temperature reading was successful and its converted value was
+ *                          stored into where the \p dst param points to.
+ * @retval  MLX90614_EC_NA  If there is no concluded Asynchronous temperature reading to collect.
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond during the last Asynchronous temperature reading.
+ * @retval  MLX90614_EC_ERR If either the MLX90614 Device raised an Error Flag or if anything else went wrong during the
+ *                          last Asynchronous temperature reading.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_async_temperature(MLX90614_Handle *hmlx, float *dst);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_async_centi_temperature function, but with the given
+ *          @ref MLX90614_Handle .
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle whose Asynchronous temperature reading wants to be
+ *                      collected.
+ * @param[out] dst      Pointer to the Memory Address where this function will store the converted temperature value,
+ *                      in hundredths of the units of the Temperature Type of \p hmlx .
+ *
+ * @retval  MLX90614_EC_OK  If the last Asynchronous temperature reading was successful and its converted value was
+ *                          stored into where the \p dst param points to.
+ * @retval  MLX90614_EC_NA  If there is no concluded Asynchronous temperature reading to collect.
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond during the last Asynchronous temperature reading.
+ * @retval  MLX90614_EC_ERR If either the MLX90614 Device raised an Error Flag or if anything else went wrong during the
+ *                          last Asynchronous temperature reading.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_async_centi_temperature(MLX90614_Handle *hmlx, int32_t *dst);
+
+/**@brief	Initializes the given @ref MLX90614_Ring_Buffer so that it becomes empty.
+ *
+ * @note    This function must not be called while a producer or a consumer may be accessing the Ring Buffer.
+ *
+ * @param[out] rb   Pointer to the @ref MLX90614_Ring_Buffer that wants to be initialized.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void init_mlx90614_ring_buffer(MLX90614_Ring_Buffer *rb);
+
+/**@brief	Pushes a temperature Raw Value, timestamped with @ref MLX90614_TIMESTAMP , into the given
+ *          @ref MLX90614_Ring_Buffer .
+ *
+ * @note    This function is called by the @ref mlx90614_i2c_mem_rx_cplt_callback function for every Handle that has
+ *          a Ring Buffer attached. However, it may also be called by the implementer as long as it is the only
+ *          producer of \p rb .
+ *
+ * @param[in,out] rb    Pointer to the @ref MLX90614_Ring_Buffer into which the Raw Value wants to be pushed.
+ * @param slave_address Slave address of the MLX90614 Device from which the Raw Value was read.
+ * @param channel       Temperature channel from which the Raw Value was read.
+ * @param raw           Temperature Raw Value that wants to be pushed.
+ *
+ * @retval  MLX90614_EC_OK  If the Raw Value was successfully pushed.
+ * @retval  MLX90614_EC_ERR If the Ring Buffer was full, in which case the Raw Value is discarded and the dropped
+ *                          entries counter of \p rb is incremented (see @ref get_mlx90614_ring_buffer_dropped ).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status push_mlx90614_ring_buffer(MLX90614_Ring_Buffer *rb, uint8_t slave_address, MLX90614_Channel_t channel, uint16_t raw);
+
+/**@brief	Pops, in the same order in which they were pushed, up to a given number of entries from the given
+ *          @ref MLX90614_Ring_Buffer .
+ *
+ * @param[in,out] rb    Pointer to the @ref MLX90614_Ring_Buffer from which the entries want to be popped.
+ * @param[out] dst      Pointer to the array into which the popped entries will be copied.
+ * @param max_entries   Maximum number of entries to pop, which must not be greater than the length of \p dst .
+ *
+ * @return  The number of entries that were actually popped and copied into \p dst , which will be \c 0 if the Ring
+ *          Buffer was empty.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint32_t pop_mlx90614_ring_buffer(MLX90614_Ring_Buffer *rb, MLX90614_Ring_Entry *dst, uint32_t max_entries);
+
+/**@brief	Gets the number of entries that are currently waiting to be popped from the given
+ *          @ref MLX90614_Ring_Buffer .
+ *
+ * @param[in] rb    Pointer to the @ref MLX90614_Ring_Buffer of interest.
+ *
+ * @return  The number of entries that are currently in \p rb .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint32_t get_mlx90614_ring_buffer_count(MLX90614_Ring_Buffer *rb);
+
+/**@brief	Gets the number of entries that have been dropped by the given @ref MLX90614_Ring_Buffer since its
+ *          initialization because it was full when they were pushed.
+ *
+ * @param[in] rb    Pointer to the @ref MLX90614_Ring_Buffer of interest.
+ *
+ * @return  The number of entries dropped by \p rb .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint32_t get_mlx90614_ring_buffer_dropped(MLX90614_Ring_Buffer *rb);
+
+/**@brief	Attaches a @ref MLX90614_Ring_Buffer to the given @ref MLX90614_Handle so that every Raw Value that is
+ *          successfully received by its Asynchronous readings gets pushed into it from the Interrupt context.
+ *
+ * @note    The Raw Values are pushed in addition to the usual conclusion of the Asynchronous readings (i.e., their
+ *          callbacks are still called), so an Asynchronous reading of all the temperature channels will push three
+ *          entries, one per channel.
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of interest.
+ * @param[in] rb        Pointer to an already initialized @ref MLX90614_Ring_Buffer (see
+ *                      @ref init_mlx90614_ring_buffer ), or \c NULL to detach the currently attached one.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void set_mlx90614_handle_ring_buffer(MLX90614_Handle *hmlx, MLX90614_Ring_Buffer *rb);
+
+/**@brief	Initializes the given @ref MLX90614_Event_Detector with the given thresholds, hysteresis and delta, which
+ *          are all given in Raw Value units (i.e., \f$T_{raw} = 50 \cdot T_{K}\f$ ).
+ *
+ * @param[out] det          Pointer to the @ref MLX90614_Event_Detector that wants to be initialized.
+ * @param channel_mask      Bitmask of the temperature channels that \p det will evaluate, where bit \f$n\f$ stands
+ *                          for the @ref MLX90614_Channel_t \f$n\f$ .
+ * @param low_raw           Low threshold, as a Raw Value.
+ * @param high_raw          High threshold, as a Raw Value, which must be greater than or equal to \p low_raw .
+ * @param hysteresis_raw    Raw Value units by which a Raw Value must come back within the thresholds for
+ *                          @ref MLX90614_EVENT_IN_RANGE to be raised, which avoids a burst of events whenever a
+ *                          temperature hovers around a threshold.
+ * @param delta_raw         Raw Value units by which a Raw Value must move away from the last reported one for
+ *                          @ref MLX90614_EVENT_DELTA to be raised, or \c 0 to only report the threshold crossings.
+ * @param callback          Pointer to the function that will be called whenever an event is raised, or \c NULL if
+ *                          no call is desired.
+ *
+ * @retval  MLX90614_EC_OK  If \p det was successfully initialized.
+ * @retval  MLX90614_EC_ERR If either \p high_raw is lower than \p low_raw or if \p high_raw has its Error Flag
+ *                          set (i.e., if it is greater than \c 0x7FFF ).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status init_mlx90614_event_detector(MLX90614_Event_Detector *det, uint8_t channel_mask, uint16_t low_raw, uint16_t high_raw, uint16_t hysteresis_raw, uint16_t delta_raw, MLX90614_Event_Callback callback);
+
+/**@brief	Evaluates a new Raw Value with the given @ref MLX90614_Event_Detector , calling its callback if it raises
+ *          any event.
+ *
+ * @details This is called automatically for every Raw Value successfully received by the Asynchronous readings of a
+ *          @ref MLX90614_Handle that has \p det attached (see @ref set_mlx90614_handle_event_detector ), which is the
+ *          case of the readings requested by a @ref MLX90614_Scheduler . However, it can also be called directly with
+ *          the Raw Values obtained in any other way (e.g., via @ref get_mlx90614_handle_raw_temperature ).
+ *
+ * @param[in,out] det   Pointer to an already initialized @ref MLX90614_Event_Detector .
+ * @param[in] hmlx      Pointer to the @ref MLX90614_Handle from which the Raw Value was read, which is only given
+ *                      to the callback of \p det .
+ * @param channel       @ref MLX90614_Channel_t of the temperature channel from which the Raw Value was read.
+ * @param raw           Raw Value to evaluate, whose Error Flag must be cleared.
+ *
+ * @return  Bitwise OR of the @ref MLX90614_Event_t flags raised by \p raw , which is @ref MLX90614_EVENT_NONE if
+ *          it was suppressed or if \p channel is not evaluated by \p det .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint8_t update_mlx90614_event_detector(MLX90614_Event_Detector *det, MLX90614_Handle *hmlx, MLX90614_Channel_t channel, uint16_t raw);
+
+/**@brief	Attaches a @ref MLX90614_Event_Detector to the given @ref MLX90614_Handle so that every Raw Value that is
+ *          successfully received by its Asynchronous readings gets evaluated by it from the Interrupt context.
+ *
+ * @note    The Raw Values are evaluated after having been filtered (see @ref set_mlx90614_handle_filter ), if
+ *          applicable.
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of interest.
+ * @param[in] det       Pointer to an already initialized @ref MLX90614_Event_Detector , or \c NULL to detach the
+ *                      currently attached one.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void set_mlx90614_handle_event_detector(MLX90614_Handle *hmlx, MLX90614_Event_Detector *det);
+
+/**@brief	Initializes the given @ref MLX90614_Log_Writer and writes the header of its Sample Log into the given
+ *          buffer.
+ *
+ * @param[out] log              Pointer to the @ref MLX90614_Log_Writer that wants to be initialized.
+ * @param[out] buffer           Pointer to the buffer into which the Sample Log will be written.
+ * @param capacity              Size in bytes of \p buffer .
+ * @param[in] hmlx              Pointer to the @ref MLX90614_Handle from whose slave address and Temperature Type the
+ *                              header of the Sample Log will be written.
+ * @param start_tick            Tick that will be written in the header of the Sample Log (e.g., @ref HAL_GetTick ).
+ * @param keyframe_interval     Maximum number of samples of each block of the Sample Log (see
+ *                              @ref MLX90614_Log_Writer ), where larger values give a smaller Sample Log but lose more
+ *                              samples per corrupted block.
+ *
+ * @retval  MLX90614_EC_OK  If \p log was successfully initialized.
+ * @retval  MLX90614_EC_ERR If either \p capacity is lower than @ref MLX90614_LOG_HEADER_SIZE or if
+ *                          \p keyframe_interval is \c 0 .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status init_mlx90614_log_writer(MLX90614_Log_Writer *log, uint8_t *buffer, size_t capacity, const MLX90614_Handle *hmlx, uint32_t start_tick, uint8_t keyframe_interval);
+
+/**@brief	Appends the Raw Values of the given @ref MLX90614_Sample to the Sample Log of the given
+ *          @ref MLX90614_Log_Writer .
+ *
+ * @note    The current block is closed (see @ref close_mlx90614_log_block ) automatically whenever it reaches the
+ *          keyframe interval of \p log .
+ *
+ * @param[in,out] log   Pointer to an already initialized @ref MLX90614_Log_Writer .
+ * @param[in] sample    Pointer to the @ref MLX90614_Sample whose Raw Values want to be appended.
+ *
+ * @retval  MLX90614_EC_OK  If the sample was successfully appended.
+ * @retval  MLX90614_EC_ERR If either the buffer of \p log has less than @ref MLX90614_LOG_MAX_RECORD_SIZE free bytes
+ *                          or if any Raw Value of \p sample has its Error Flag set.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status append_mlx90614_log_sample(MLX90614_Log_Writer *log, const MLX90614_Sample *sample);
+
+/**@brief	Closes the current block of the Sample Log of the given @ref MLX90614_Log_Writer by writing its count and
+ *          CRC bytes, so that all the samples appended so far can be decoded.
+ *
+ * @details This is meant to be called before sending or storing the Sample Log (e.g., before each Flash page is
+ *          programmed), where the next sample appended will then open a new block with a keyframe of its own.
+ *
+ * @param[in,out] log   Pointer to an already initialized @ref MLX90614_Log_Writer .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void close_mlx90614_log_block(MLX90614_Log_Writer *log);
+
+/**@brief	Gets the number of bytes of the Sample Log that have been written into the buffer of the given
+ *          @ref MLX90614_Log_Writer .
+ *
+ * @param[in] log   Pointer to an already initialized @ref MLX90614_Log_Writer .
+ *
+ * @return  The length in bytes of the Sample Log of \p log , including its header.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+size_t get_mlx90614_log_length(const MLX90614_Log_Writer *log);
+
+/**@brief	Decodes a Sample Log written by a @ref MLX90614_Log_Writer back into @ref MLX90614_Sample records,
+ *          whose temperature values are converted into the Temperature Type written in its header.
+ *
+ * @note    This function uses no HAL function at all, so that it can be used either on the MCU/MPU (e.g., to read a
+ *          Sample Log back from an external Flash memory) or from a host tool.
+ *
+ * @param[in] log           Pointer to the Sample Log that wants to be decoded, where only its closed blocks can be
+ *                          decoded.
+ * @param length            Length in bytes of \p log .
+ * @param[out] header       Pointer to the Memory Address into which this function will write the header of \p log .
+ * @param[out] dst          Pointer to an array of \p max_samples @ref MLX90614_Sample into which this function will
+ *                          write the decoded samples.
+ * @param max_samples       Number of @ref MLX90614_Sample that \p dst can hold.
+ * @param[out] n_samples    Pointer to the Memory Address into which this function will write the number of samples
+ *                          decoded into \p dst , which is also valid whenever an error is returned.
+ *
+ * @retval  MLX90614_EC_OK      If all the blocks of \p log were successfully decoded.
+ * @retval  MLX90614_EC_STOP    If \p dst was filled before all the blocks of \p log could be decoded.
+ * @retval  MLX90614_EC_ERR     If either the header or a block of \p log is corrupted or truncated, in which case
+ *                              \p dst holds all the samples of the blocks that preceded it.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status decode_mlx90614_log(const uint8_t *log, size_t length, MLX90614_Log_Header *header, MLX90614_Sample *dst, size_t max_samples, size_t *n_samples);
+
+/**@brief	Initializes the given @ref MLX90614_Scheduler , which will be left stopped.
+ *
+ * @details The given sampling period is clamped to be at least the settling time of the IIR and FIR Filters
+ *          currently configured in the EEPROM of the MLX90614 Device (see @ref get_mlx90614_settling_time ) and at
+ *          least @ref MLX90614_MIN_SAMPLING_PERIOD , so that the Scheduler never requests readings faster than the
+ *          MLX90614 Device produces new data. The result is then rounded up towards the nearest multiple of the tick
+ *          period of the Hardware Timer.
+ *
+ * @note    The IIR and FIR Filters are read via @ref get_mlx90614_handle_iir and @ref get_mlx90614_handle_fir , so
+ *          this function makes I2C transactions unless the EEPROM Shadow of \p hmlx already holds them. Therefore,
+ *          call it again whenever those Filters are changed (e.g., via @ref set_mlx90614_handle_iir ).
+ *
+ * @param[out] sched        Pointer to the @ref MLX90614_Scheduler that wants to be initialized.
+ * @param[in] hmlx          Pointer to an already initialized @ref MLX90614_Handle whose MLX90614 Device will be read
+ *                          by the Scheduler.
+ * @param channel           @ref MLX90614_Channel_t of the temperature channel to be read, or
+ *                          @ref MLX90614_SCHEDULER_ALL_CHANNELS to read all of them.
+ * @param tick_period_ms    Period in milliseconds with which the Hardware Timer will call the
+ *                          @ref mlx90614_scheduler_tick_handler function.
+ * @param sampling_period_ms    Desired period in milliseconds between the readings requested by the Scheduler.
+ *
+ * @retval  MLX90614_EC_OK  If the Scheduler was successfully initialized.
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond while reading its IIR and FIR Filters.
+ * @retval  MLX90614_EC_ERR If either \p channel or \p tick_period_ms are invalid or if anything else went wrong
+ *                          while reading the IIR and FIR Filters.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status init_mlx90614_scheduler(MLX90614_Scheduler *sched, MLX90614_Handle *hmlx, uint8_t channel, uint32_t tick_period_ms, uint32_t sampling_period_ms);
+
+/**@brief	Starts the given @ref MLX90614_Scheduler , whose first reading will be requested on the next tick of its
+ *          Hardware Timer.
+ *
+ * @param[in,out] sched Pointer to an already initialized @ref MLX90614_Scheduler .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void start_mlx90614_scheduler(MLX90614_Scheduler *sched);
+
+/**@brief	Stops the given @ref MLX90614_Scheduler .
+ *
+ * @note    An Asynchronous reading that was already requested by the Scheduler will still conclude normally.
+ *
+ * @param[in,out] sched Pointer to an already initialized @ref MLX90614_Scheduler .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void stop_mlx90614_scheduler(MLX90614_Scheduler *sched);
+
+/**@brief	Processes a tick of the Hardware Timer of the given @ref MLX90614_Scheduler , which requests a new
+ *          Asynchronous reading whenever the sampling period of the Scheduler elapses.
+ *
+ * @note    This function is meant to be called from the Interrupt of the Hardware Timer (e.g., from
+ *          @ref HAL_TIM_PeriodElapsedCallback ), whose Interrupt priority should be the same as the one of the I2C
+ *          Interrupts of the I2C Peripheral used by the Scheduler so that they do not preempt each other.
+ * @note    If the previous reading of the Handle of the Scheduler is still in process when its sampling period
+ *          elapses, then no new reading is requested on that period and its missed readings counter is incremented.
+ * @note    Asynchronous readings may still be requested from the main loop meanwhile (e.g., on another I2C), since
+ *          the slots for them are claimed with the interrupts masked.
+ *
+ * @param[in,out] sched Pointer to the @ref MLX90614_Scheduler whose Hardware Timer has ticked.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void mlx90614_scheduler_tick_handler(MLX90614_Scheduler *sched);
+
+/**@brief	Gets the sampling period, in ticks of its Hardware Timer, with which the given @ref MLX90614_Scheduler
+ *          requests its readings after having applied to it the rounding and clamping described in
+ *          @ref init_mlx90614_scheduler .
+ *
+ * @param[in] sched Pointer to an already initialized @ref MLX90614_Scheduler .
+ *
+ * @return  The sampling period of \p sched in ticks of its Hardware Timer.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint32_t get_mlx90614_scheduler_period(MLX90614_Scheduler *sched);
+
+/**@brief	Puts the MLX90614 Device of the given @ref MLX90614_Handle into its Sleep Mode by sending to it the "Enter
+ *          SLEEP mode" command with its PEC byte (i.e., \c 0xFF followed by \c 0xE8 for the default slave address).
+ *
+ * @details If \p pins is given, then the pins of the I2C Peripheral of \p hmlx are taken away from it and SCL is held
+ *          low, which is what the MLX90614 Datasheet recommends in order to keep the current consumption of the
+ *          MLX90614 Device at its minimum during its Sleep Mode.
+ *
+ * @note    While SCL is held low, the I2C Peripheral of \p hmlx is de-initialized and, therefore, no other device on
+ *          that I2C bus can be used until @ref wake_mlx90614_handle is called, so this is meant for MLX90614 Devices
+ *          that have an I2C bus of their own.
+ * @note    A MLX90614 Device in its Sleep Mode does not respond to any I2C transaction.
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param[in] pins      Pointer to the @ref MLX90614_Bus_Recovery pins of the I2C Peripheral of \p hmlx , or \c NULL
+ *                      to leave the I2C Peripheral as it is.
+ *
+ * @retval  MLX90614_EC_OK  If the MLX90614 Device acknowledged the command.
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If anything else went wrong.
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status sleep_mlx90614_handle(MLX90614_Handle *hmlx, const MLX90614_Bus_Recovery *pins);
+
+/**@brief	Wakes up the MLX90614 Device of the given @ref MLX90614_Handle from its Sleep Mode by holding SDA low, with
+ *          SCL high, during @ref MLX90614_WAKE_PULSE_TIME milliseconds, and then gives the pins back to the I2C
+ *          Peripheral of \p hmlx by initializing it again.
+ *
+ * @note    This function blocks for @ref MLX90614_WAKE_PULSE_TIME milliseconds, and the temperature outputs of the
+ *          MLX90614 Device will not be valid until its IIR and FIR Filters have settled again (see
+ *          @ref get_mlx90614_settling_time ). Use a @ref MLX90614_Duty_Cycle to do all of this without blocking.
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param[in] pins      Pointer to the @ref MLX90614_Bus_Recovery pins of the I2C Peripheral of \p hmlx .
+ *
+ * @retval  MLX90614_EC_OK  If the wake up pulse was given and the I2C Peripheral was successfully initialized again.
+ * @retval  MLX90614_EC_ERR If either \p pins is \c NULL or the I2C Peripheral could not be initialized again.
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status wake_mlx90614_handle(MLX90614_Handle *hmlx, const MLX90614_Bus_Recovery *pins);
+
+/**@brief	Initializes the given @ref MLX90614_Duty_Cycle , which will be left stopped.
+ *
+ * @details The lead time with which the MLX90614 Device is woken up before each sample is given by the
+ *          @ref get_mlx90614_settling_time function for the IIR and FIR Filters currently configured in its EEPROM,
+ *          which are read by this function and, therefore, the MLX90614 Device must be awake when calling it.
+ *
+ * @param[out] dc               Pointer to the @ref MLX90614_Duty_Cycle that wants to be initialized.
+ * @param[in] hmlx              Pointer to an already initialized @ref MLX90614_Handle whose MLX90614 Device will be
+ *                              duty cycled.
+ * @param[in] pins              Pointer to the @ref MLX90614_Bus_Recovery pins of the I2C Peripheral of \p hmlx , which
+ *                              must remain valid for as long as the Duty Cycle is used.
+ * @param sampling_period_ms    Period in milliseconds between the samples of the Duty Cycle.
+ * @param callback              Function that will be called with every sample taken by the Duty Cycle, or \c NULL if
+ *                              none.
+ *
+ * @retval  MLX90614_EC_OK  If the Duty Cycle was successfully initialized.
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either \p pins is \c NULL , if \p sampling_period_ms leaves no time at all for the
+ *                          MLX90614 Device to sleep, if the PEC validation failed or if anything else went wrong.
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status init_mlx90614_duty_cycle(MLX90614_Duty_Cycle *dc, MLX90614_Handle *hmlx, const MLX90614_Bus_Recovery *pins, uint32_t sampling_period_ms, MLX90614_Sample_Callback callback);
+
+/**@brief	Starts the given @ref MLX90614_Duty_Cycle by putting its MLX90614 Device into its Sleep Mode, where its
+ *          first sample will be taken after a whole sampling period.
+ *
+ * @param[in,out] dc    Pointer to an already initialized @ref MLX90614_Duty_Cycle .
+ *
+ * @return  The same @ref MLX90614_Status Exception Codes of the @ref sleep_mlx90614_handle function.
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status start_mlx90614_duty_cycle(MLX90614_Duty_Cycle *dc);
+
+/**@brief	Stops the given @ref MLX90614_Duty_Cycle , where its MLX90614 Device is woken up (which blocks for
+ *          @ref MLX90614_WAKE_PULSE_TIME milliseconds) if it was in its Sleep Mode.
+ *
+ * @param[in,out] dc    Pointer to an already initialized @ref MLX90614_Duty_Cycle .
+ *
+ * @return  The same @ref MLX90614_Status Exception Codes of the @ref wake_mlx90614_handle function.
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status stop_mlx90614_duty_cycle(MLX90614_Duty_Cycle *dc);
+
+/**@brief	Advances the given @ref MLX90614_Duty_Cycle according to @ref HAL_GetTick , which either starts or ends the
+ *          wake up pulse of its MLX90614 Device, or takes its sample and puts it back into its Sleep Mode whenever the
+ *          time of the sample arrives.
+ *
+ * @note    Taking a sample passes it to the callback of the Duty Cycle, if any, even if it failed. If one or more
+ *          sampling periods were missed (i.e., this function was not called for too long), then the next sample is
+ *          scheduled a whole sampling period after the current one.
+ *
+ * @param[in,out] dc    Pointer to an already started @ref MLX90614_Duty_Cycle .
+ *
+ * @retval  MLX90614_EC_NA      If no sample was taken on this call, in which case this function has to be called again
+ *                              later.
+ * @retval  MLX90614_EC_STOP    If the Duty Cycle is stopped.
+ * @retval  MLX90614_EC_OK      If a sample was successfully taken and the MLX90614 Device was put back into its Sleep
+ *                              Mode.
+ * @retval  MLX90614_EC_NR      If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR     If either the wake up pulse or the sample failed, or if anything else went wrong.
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status pump_mlx90614_duty_cycle(MLX90614_Duty_Cycle *dc);
+
+/**@brief	Initializes a @ref MLX90614_Multi_Bus without any @ref MLX90614_Bus_Lane .
+ *
+ * @param[out] mb       Pointer to the @ref MLX90614_Multi_Bus that wants to be initialized.
+ * @param callback      Pointer to the function that will be called, from within @ref pump_mlx90614_multi_bus , for
+ *                      every reading of \p mb that concludes or that could not even be requested (i.e., with the
+ *                      Exception Code of that request), or \c NULL if no call is desired.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void init_mlx90614_multi_bus(MLX90614_Multi_Bus *mb, MLX90614_Sample_Callback callback);
+
+/**@brief	Adds a @ref MLX90614_Bus_Lane to the given @ref MLX90614_Multi_Bus with the MLX90614 Devices of the given
+ *          @ref MLX90614_Handle , which must all be wired to the same I2C Peripheral.
+ *
+ * @note    The given arrays must remain valid for as long as \p mb is used.
+ *
+ * @param[in,out] mb    Pointer to the @ref MLX90614_Multi_Bus to which the Lane wants to be added.
+ * @param[in] handles   Pointer to an array of \p count already initialized @ref MLX90614_Handle .
+ * @param[out] samples  Pointer to an array of \p count @ref MLX90614_Sample , where the sample \f$n\f$ will hold the
+ *                      last reading of the MLX90614 Device of \p handles \f$[n]\f$ .
+ * @param count         Number of @ref MLX90614_Handle of the Lane, which must be from \c 1 up to \c 32 .
+ *
+ * @retval  MLX90614_EC_OK  If the Lane was successfully added to \p mb .
+ * @retval  MLX90614_EC_ERR <ul>
+ *                              <li>
+ *                                  If \p mb already has @ref MLX90614_MAX_NUMBER_OF_ASYNC_I2C Lanes.
+ *                              </li>
+ *                              <li>
+ *                                  If the \p count param contains an invalid value.
+ *                              </li>
+ *                              <li>
+ *                                  If \p handles are not all wired to the same I2C Peripheral, or if that I2C
+ *                                  Peripheral is already used by another Lane of \p mb .
+ *                              </li>
+ *                          </ul>
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status add_mlx90614_multi_bus_lane(MLX90614_Multi_Bus *mb, MLX90614_Handle *const *handles, MLX90614_Sample *samples, uint8_t count);
+
+/**@brief	Advances all the @ref MLX90614_Bus_Lane of the given @ref MLX90614_Multi_Bus without blocking.
+ *
+ * @details For each Lane whose reading has concluded, this function updates the \ref MLX90614_Bus_Lane::valid_mask
+ *          of its sample, calls the callback of \p mb (if any), moves on to the next MLX90614 Device of that Lane and
+ *          requests its reading right away. A Lane whose reading is still in process is left untouched, so that all
+ *          the Lanes are kept transferring in parallel.
+ *
+ * @note    A reading that cannot be requested (e.g., because another Asynchronous reading is in process in the same
+ *          I2C Peripheral) is counted as failed and its Lane moves on to its next MLX90614 Device.
+ *
+ * @param[in,out] mb    Pointer to the @ref MLX90614_Multi_Bus that wants to be advanced.
+ *
+ * @return  The number of Lanes of \p mb that have a reading in process after this call.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint8_t pump_mlx90614_multi_bus(MLX90614_Multi_Bus *mb);
+
+/**@brief	Reads all the given MLX90614 Devices at once and gives back the mean, the median and the maximum deviation
+ *          of the Raw Values of the given temperature channel, which is meant for several redundant MLX90614 Devices
+ *          that measure the same zone.
+ *
+ * @details The given Handles are grouped by their I2C Peripheral into the @ref MLX90614_Bus_Lane of a
+ *          @ref MLX90614_Multi_Bus , so that the MLX90614 Devices wired to different I2C Peripherals are read in
+ *          parallel via @ref get_mlx90614_handle_all_temperatures_async , and this function blocks until each of them
+ *          has been read exactly once. Then, all the statistics are computed on the Raw Values as integers.
+ *
+ * @note    This function blocks for at most the sum of the \ref MLX90614_Retry_Policy::timeout_ms of the Handles of
+ *          the I2C Peripheral that has the most of them (i.e., the slowest @ref MLX90614_Bus_Lane ). Whenever that
+ *          deadline expires, the readings still in process are aborted via @ref HAL_I2C_Master_Abort_IT and the
+ *          MLX90614 Devices that were not read are excluded from the statistics, so that a partial result is given.
+ *
+ * @note    Any MLX90614 Device that did not respond, that raised an Error Flag (i.e., a Raw Value greater than
+ *          \c 0x7FFF ) or whose reading failed its PEC validation is excluded from the statistics, which is reported
+ *          via the \ref MLX90614_Aggregate::valid_mask of \p dst .
+ * @note    The Raw Values are filtered by the @ref MLX90614_Filter attached to each Handle, if any, before being
+ *          aggregated.
+ *
+ * @param[in] handles   Pointer to the array of @ref MLX90614_Handle that want to be aggregated, whose I2C
+ *                      Peripherals must be at most @ref MLX90614_MAX_NUMBER_OF_ASYNC_I2C different ones and must not
+ *                      have any other Asynchronous reading in process.
+ * @param count         Number of Handles in \p handles , which must be from \c 1 up to
+ *                      @ref MLX90614_AGGREGATE_MAX_HANDLES .
+ * @param channel       @ref MLX90614_Channel_t of the temperature channel that wants to be aggregated.
+ * @param[out] dst      Pointer to the @ref MLX90614_Aggregate into which the statistics will be stored.
+ *
+ * @retval  MLX90614_EC_OK  If at least one MLX90614 Device gave back a valid Raw Value.
+ * @retval  MLX90614_EC_NR  If none of the MLX90614 Devices gave back a valid Raw Value before the deadline, in which
+ *                          case only the \ref MLX90614_Aggregate::valid_count and
+ *                          \ref MLX90614_Aggregate::valid_mask of \p dst are updated.
+ * @retval  MLX90614_EC_ERR If either \p count or \p channel are invalid, or if \p handles use more than
+ *                          @ref MLX90614_MAX_NUMBER_OF_ASYNC_I2C different I2C Peripherals.
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status aggregate_mlx90614_handles(MLX90614_Handle *const *handles, uint8_t count, MLX90614_Channel_t channel, MLX90614_Aggregate *dst);
+
+/**@brief	Gets the IIR Filter setting currently stored in the "ConfigRegister1" Register of the EEPROM of the MLX90614
+ *          Infra Red Thermometer Device of the @ref mlx90614 .
+ *
+ * @param[out] dst  Pointer to the Memory Address where this function will store the IIR Filter setting read.
+ *
+ * @retval  MLX90614_EC_OK  If the IIR Filter setting was successfully read and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_iir(MLX90614_IIR_t *dst);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_iir function, but with the MLX90614 Device of the given
+ *          @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param[out] dst  Pointer to the Memory Address where this function will store the IIR Filter setting read.
+ *
+ * @retval  MLX90614_EC_OK  If the IIR Filter setting was successfully read and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the PEC validation failed or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_iir(MLX90614_Handle *hmlx, MLX90614_IIR_t *dst);
+
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+/**@brief	Stores a new IIR Filter setting into the "ConfigRegister1" Register of the EEPROM of the MLX90614 Infra Red
+ *          Thermometer Device of the @ref mlx90614 , while keeping all the other bits of that Register unchanged.
+ *
+ * @details This function reads the current value of the "ConfigRegister1" Register and, only if the given setting
+ *          differs from the stored one, it then erases and writes that Register via the same sequence used by the
+ *          @ref set_mlx90614_device_slave_address function.
+ *
+ * @note    The MLX90614 Device loads its "ConfigRegister1" Register from its EEPROM only after a Power-On Reset.
+ *          Therefore, the new setting will take effect only after power cycling the MLX90614 Device.
+ * @note    <i><b style="color:red;"><u>WARNING</u>:</b><b>Having an electrical failure while this function is writing
+ *          into the EEPROM of the MLX90614 Device may leave the "ConfigRegister1" Register corrupted, which holds
+ *          factory calibration relevant bits. Also have in mind that the EEPROM cells of the MLX90614 Device have a
+ *          limited number of write cycles.</b></i>
+ *
+ * @param iir    New IIR Filter setting that wants to be stored.
+ *
+ * @retval  MLX90614_EC_OK  If the new IIR Filter setting was successfully stored (or if it was already stored).
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the given setting is invalid or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status set_mlx90614_iir(MLX90614_IIR_t iir);
+
+/**@brief	Works in the same way as the @ref set_mlx90614_iir function, but with the MLX90614 Device of the given
+ *          @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param iir    New IIR Filter setting that wants to be stored.
+ *
+ * @retval  MLX90614_EC_OK  If the new IIR Filter setting was successfully stored (or if it was already stored).
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the given setting is invalid, if the PEC validation failed or if anything else
+ *                          went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status set_mlx90614_handle_iir(MLX90614_Handle *hmlx, MLX90614_IIR_t iir);
+#endif
+
+/**@brief	Gets the FIR Filter setting currently stored in the "ConfigRegister1" Register of the EEPROM of the MLX90614
+ *          Infra Red Thermometer Device of the @ref mlx90614 .
+ *
+ * @param[out] dst  Pointer to the Memory Address where this function will store the FIR Filter setting read.
+ *
+ * @retval  MLX90614_EC_OK  If the FIR Filter setting was successfully read and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_fir(MLX90614_FIR_t *dst);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_fir function, but with the MLX90614 Device of the given
+ *          @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param[out] dst  Pointer to the Memory Address where this function will store the FIR Filter setting read.
+ *
+ * @retval  MLX90614_EC_OK  If the FIR Filter setting was successfully read and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the PEC validation failed or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_fir(MLX90614_Handle *hmlx, MLX90614_FIR_t *dst);
+
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+/**@brief	Stores a new FIR Filter setting into the "ConfigRegister1" Register of the EEPROM of the MLX90614 Infra Red
+ *          Thermometer Device of the @ref mlx90614 , while keeping all the other bits of that Register unchanged.
+ *
+ * @details This function reads the current value of the "ConfigRegister1" Register and, only if the given setting
+ *          differs from the stored one, it then erases and writes that Register via the same sequence used by the
+ *          @ref set_mlx90614_device_slave_address function.
+ *
+ * @note    The MLX90614 Device loads its "ConfigRegister1" Register from its EEPROM only after a Power-On Reset.
+ *          Therefore, the new setting will take effect only after power cycling the MLX90614 Device.
+ * @note    <i><b style="color:red;"><u>WARNING</u>:</b><b>Having an electrical failure while this function is writing
+ *          into the EEPROM of the MLX90614 Device may leave the "ConfigRegister1" Register corrupted, which holds
+ *          factory calibration relevant bits. Also have in mind that the EEPROM cells of the MLX90614 Device have a
+ *          limited number of write cycles.</b></i>
+ *
+ * @param fir    New FIR Filter setting that wants to be stored.
+ *
+ * @retval  MLX90614_EC_OK  If the new FIR Filter setting was successfully stored (or if it was already stored).
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the given setting is invalid or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status set_mlx90614_fir(MLX90614_FIR_t fir);
+
+/**@brief	Works in the same way as the @ref set_mlx90614_fir function, but with the MLX90614 Device of the given
+ *          @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param fir    New FIR Filter setting that wants to be stored.
+ *
+ * @retval  MLX90614_EC_OK  If the new FIR Filter setting was successfully stored (or if it was already stored).
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the given setting is invalid, if the PEC validation failed or if anything else
+ *                          went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status set_mlx90614_handle_fir(MLX90614_Handle *hmlx, MLX90614_FIR_t fir);
+#endif
+
+/**@brief	Gets the Amplifier Gain setting currently stored in the "ConfigRegister1" Register of the EEPROM of the MLX90614
+ *          Infra Red Thermometer Device of the @ref mlx90614 .
+ *
+ * @param[out] dst  Pointer to the Memory Address where this function will store the Amplifier Gain setting read.
+ *
+ * @retval  MLX90614_EC_OK  If the Amplifier Gain setting was successfully read and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_gain(MLX90614_Gain_t *dst);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_gain function, but with the MLX90614 Device of the given
+ *          @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param[out] dst  Pointer to the Memory Address where this function will store the Amplifier Gain setting read.
+ *
+ * @retval  MLX90614_EC_OK  If the Amplifier Gain setting was successfully read and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the PEC validation failed or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_gain(MLX90614_Handle *hmlx, MLX90614_Gain_t *dst);
+
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+/**@brief	Stores a new Amplifier Gain setting into the "ConfigRegister1" Register of the EEPROM of the MLX90614 Infra Red
+ *          Thermometer Device of the @ref mlx90614 , while keeping all the other bits of that Register unchanged.
+ *
+ * @details This function reads the current value of the "ConfigRegister1" Register and, only if the given setting
+ *          differs from the stored one, it then erases and writes that Register via the same sequence used by the
+ *          @ref set_mlx90614_device_slave_address function.
+ *
+ * @note    The MLX90614 Device loads its "ConfigRegister1" Register from its EEPROM only after a Power-On Reset.
+ *          Therefore, the new setting will take effect only after power cycling the MLX90614 Device.
+ * @note    <i><b style="color:red;"><u>WARNING</u>:</b><b>Having an electrical failure while this function is writing
+ *          into the EEPROM of the MLX90614 Device may leave the "ConfigRegister1" Register corrupted, which holds
+ *          factory calibration relevant bits. Also have in mind that the EEPROM cells of the MLX90614 Device have a
+ *          limited number of write cycles.</b></i>
+ *
+ * @param gain    New Amplifier Gain setting that wants to be stored.
+ *
+ * @retval  MLX90614_EC_OK  If the new Amplifier Gain setting was successfully stored (or if it was already stored).
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the given setting is invalid or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status set_mlx90614_gain(MLX90614_Gain_t gain);
+
+/**@brief	Works in the same way as the @ref set_mlx90614_gain function, but with the MLX90614 Device of the given
+ *          @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param gain    New Amplifier Gain setting that wants to be stored.
+ *
+ * @retval  MLX90614_EC_OK  If the new Amplifier Gain setting was successfully stored (or if it was already stored).
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the given setting is invalid, if the PEC validation failed or if anything else
+ *                          went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status set_mlx90614_handle_gain(MLX90614_Handle *hmlx, MLX90614_Gain_t gain);
+#endif
+
+/**@brief	Gets the whole value currently stored in the "ConfigRegister1" Register of the EEPROM of the MLX90614
+ *          Device of the given @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param[out] dst  Pointer to the Memory Address where this function will store the 16-bit value read.
+ *
+ * @retval  MLX90614_EC_OK  If the "ConfigRegister1" Register was successfully read and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the PEC validation failed or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_config_register1(MLX90614_Handle *hmlx, uint16_t *dst);
+
+/**@brief	Gets the \f$T_{O,MAX}\f$ and \f$T_{O,MIN}\f$ values currently stored in the EEPROM of the MLX90614
+ *          Device of the given @ref MLX90614_Handle , which define the temperature range of its PWM output.
+ *
+ * @note    These values have to be read via the I2C Protocol while the MLX90614 Device is still in its SMBus mode
+ *          (i.e., before enabling its PWM mode), and they can then be given to the @ref init_mlx90614_pwm function.
+ *
+ * @param[in] hmlx      Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param[out] to_max   Pointer to the Memory Address where this function will store \f$T_{O,MAX}\f$ in hundredths of
+ *                      Kelvin (e.g., \c 39315 stands for \f$120^{\circ}C\f$ ).
+ * @param[out] to_min   Pointer to the Memory Address where this function will store \f$T_{O,MIN}\f$ in hundredths of
+ *                      Kelvin (e.g., \c 25315 stands for \f$-20^{\circ}C\f$ ).
+ *
+ * @retval  MLX90614_EC_OK  If both values were successfully read and stored.
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the PEC validation failed or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_pwm_range(MLX90614_Handle *hmlx, uint16_t *to_max, uint16_t *to_min);
+
+/**@brief	Gets the Emissivity currently stored in the EEPROM of the MLX90614 Infra Red Thermometer Device of the
+ *          @ref mlx90614 , which is the one that the MLX90614 Device uses to calculate its Object Temperatures.
+ *
+ * @param[out] dst  Pointer to the Memory Address where this function will store the Emissivity read (i.e., from
+ *                  \c 0.1 up to \c 1.0 ).
+ *
+ * @retval  MLX90614_EC_OK  If the Emissivity was successfully read and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_emissivity(float *dst);
+
+/**@brief	Works in the same way as the @ref get_mlx90614_emissivity function, but with the MLX90614 Device of the
+ *          given @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param[out] dst  Pointer to the Memory Address where this function will store the Emissivity read.
+ *
+ * @retval  MLX90614_EC_OK  If the Emissivity was successfully read and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the PEC validation failed or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_handle_emissivity(MLX90614_Handle *hmlx, float *dst);
+
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+/**@brief	Stores a new Emissivity into the EEPROM of the MLX90614 Infra Red Thermometer Device of the
+ *          @ref mlx90614 .
+ *
+ * @details This function reads the current Emissivity of the MLX90614 Device and, only if the given one differs from
+ *          it, it then erases and writes its EEPROM cell via the same sequence used by the
+ *          @ref set_mlx90614_device_slave_address function, which blocks for several milliseconds.
+ *
+ * @note    The MLX90614 Device loads its Emissivity from its EEPROM only after a Power-On Reset. Therefore, the new
+ *          Emissivity will take effect only after power cycling the MLX90614 Device.
+ * @note    <i><b style="color:red;"><u>WARNING</u>:</b><b>The EEPROM cells of the MLX90614 Device have a limited
+ *          number of write cycles. Therefore, if the target material changes frequently, use the
+ *          @ref set_mlx90614_handle_emissivity_compensation function instead.</b></i>
+ *
+ * @param emissivity    New Emissivity that wants to be stored, which must be from \c 0.1 up to \c 1.0 .
+ *
+ * @retval  MLX90614_EC_OK  If the new Emissivity was successfully stored (or if it was already stored).
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the given Emissivity is invalid or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status set_mlx90614_emissivity(float emissivity);
+
+/**@brief	Works in the same way as the @ref set_mlx90614_emissivity function, but with the MLX90614 Device of the
+ *          given @ref MLX90614_Handle .
+ *
+ * @param[in] hmlx      Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param emissivity    New Emissivity that wants to be stored, which must be from \c 0.1 up to \c 1.0 .
+ *
+ * @retval  MLX90614_EC_OK  If the new Emissivity was successfully stored (or if it was already stored).
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the given Emissivity is invalid, if the PEC validation failed or if anything
+ *                          else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status set_mlx90614_handle_emissivity(MLX90614_Handle *hmlx, float emissivity);
+#endif
+
+/**@brief	Enables the software Emissivity compensation of the given @ref MLX90614_Handle for a target material with
+ *          the given Emissivity, without writing anything into the EEPROM of its MLX90614 Device.
+ *
+ * @details The MLX90614 Device calculates its Object Temperatures with the Emissivity \f$\varepsilon_{d}\f$ stored in
+ *          its EEPROM. Therefore, the Object Temperatures of a target whose Emissivity is \f$\varepsilon_{t}\f$ are
+ *          compensated via
+ *          \f$T_{obj}^{4} = T_{a}^{4} + \frac{\varepsilon_{d}}{\varepsilon_{t}}(T_{meas}^{4} - T_{a}^{4})\f$ , where
+ *          \f$T_{a}\f$ is the Ambient Temperature of the same reading. This function reads
+ *          \f$\varepsilon_{d}\f$ once (see @ref set_mlx90614_handle_eeprom_shadow ) and precomputes the
+ *          \f$\varepsilon_{d}/\varepsilon_{t}\f$ ratio as a Q16 fixed-point coefficient, so that each compensation is
+ *          then done on the Raw Values with integer arithmetic only (see @ref compensate_mlx90614_emissivity ).
+ *
+ * @note    The compensation is applied to the Object1 and Object2 Raw Values of the readings of all the temperature
+ *          channels (i.e., @ref get_mlx90614_handle_all_temperatures , its Asynchronous counterpart and the
+ *          @ref MLX90614_Multi_Bus ), since those already read \f$T_{a}\f$ in the same burst. The readings of a single
+ *          temperature channel are never compensated.
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param emissivity    Emissivity of the target material, which must be from \c 0.1 up to \c 1.0 , or \c 0 to
+ *                      disable the Emissivity compensation of \p hmlx .
+ *
+ * @retval  MLX90614_EC_OK  If the Emissivity compensation was successfully either enabled or disabled.
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the given Emissivity is invalid, if the PEC validation failed or if anything
+ *                          else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status set_mlx90614_handle_emissivity_compensation(MLX90614_Handle *hmlx, float emissivity);
+
+/**@brief	Compensates an Object Temperature Raw Value with the given Emissivity compensation coefficient, as
+ *          described in @ref set_mlx90614_handle_emissivity_compensation , via integer arithmetic only.
+ *
+ * @param raw_obj       Object Temperature Raw Value read from the MLX90614 Device.
+ * @param raw_ta        Ambient Temperature Raw Value read from the MLX90614 Device in the same burst.
+ * @param coefficient   Emissivity compensation coefficient in Q16 fixed-point, which must not be greater than
+ *                      \f$10 \cdot 2^{16}\f$ .
+ *
+ * @return  The compensated Object Temperature Raw Value, which saturates at \c 0 and at \c 0x7FFF .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint16_t compensate_mlx90614_emissivity(uint16_t raw_obj, uint16_t raw_ta, uint32_t coefficient);
+
+/**@brief	Estimates the settling time, in milliseconds, of the temperature outputs of a MLX90614 Device for the given
+ *          IIR and FIR Filter settings.
+ *
+ * @details The estimation is made by multiplying the approximate time that the MLX90614 Device takes to produce a
+ *          new output with the given FIR Filter (which is of about 100 milliseconds for \f$N=1024\f$ and that
+ *          scales linearly with \f$N\f$ ) by the number of outputs that the given IIR Filter requires to reach 95\%
+ *          of a step change in the measured temperature.
+ *
+ * @note    The result of this function is only meant to be used as a rough guide (e.g., for choosing the sampling
+ *          period of a @ref MLX90614_Scheduler ), since the actual settling times depend on the variant of the
+ *          MLX90614 Device and are listed in its Datasheet.
+ *
+ * @param iir   IIR Filter setting of interest.
+ * @param fir   FIR Filter setting of interest.
+ *
+ * @return  The estimated settling time in milliseconds, or \c 0 if either \p iir or \p fir are invalid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint32_t get_mlx90614_settling_time(MLX90614_IIR_t iir, MLX90614_FIR_t fir);
+
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+/**@brief	Starts a non-blocking @ref MLX90614_EEPROM_Write that changes only the given bits of an EEPROM address of
+ *          the MLX90614 Device of the given @ref MLX90614_Handle , while keeping the rest of its bits unchanged.
+ *
+ * @details No I2C transaction is made by this function. Instead, the EEPROM Write has to be advanced by repeatedly
+ *          calling the @ref pump_mlx90614_eeprom_write function until it concludes.
+ *
+ * @note    <i><b style="color:red;"><u>WARNING</u>:</b><b>The MLX90614 Datasheet states that several EEPROM cells
+ *          hold factory calibration data. It is the responsibility of the implementer to only write the EEPROM cells
+ *          and bits that are documented as writable by the user.</b></i>
+ *
+ * @param[out] job          Pointer to the @ref MLX90614_EEPROM_Write that will be started.
+ * @param[in] hmlx          Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param eeprom_address    EEPROM address as stated in the MLX90614 Datasheet (i.e., \c 0x00 up to \c 0x1F ), such
+ *                          as \c 0x05 for the "ConfigRegister1" Register.
+ * @param mask              Bit mask of the bits that want to be changed.
+ * @param value             New value of the bits of interest, already positioned according to \p mask .
+ * @param is_verify_enabled \c 1 if the EEPROM cell is to be read back until it holds the expected value after being
+ *                          erased and after being written, so that it concludes as soon as the MLX90614 Device is
+ *                          done. Otherwise, \c 0 to simply wait @ref MLX90614_ERASE_OR_WRITE_CELL_TIME milliseconds
+ *                          after each of these.
+ *
+ * @retval  MLX90614_EC_OK  If the EEPROM Write was successfully started.
+ * @retval  MLX90614_EC_ERR If the given EEPROM address is invalid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status start_mlx90614_handle_eeprom_write(MLX90614_EEPROM_Write *job, MLX90614_Handle *hmlx, uint8_t eeprom_address, uint16_t mask, uint16_t value, uint8_t is_verify_enabled);
+
+/**@brief	Starts a non-blocking @ref MLX90614_EEPROM_Write that works in the same way as the
+ *          @ref set_mlx90614_handle_device_slave_address function.
+ *
+ * @details The slave address of the given @ref MLX90614_Handle is updated once the EEPROM Write concludes
+ *          successfully. Have in mind that all the warnings given at @ref set_mlx90614_device_slave_address also apply
+ *          to this function.
+ *
+ * @param[out] job          Pointer to the @ref MLX90614_EEPROM_Write that will be started.
+ * @param[in,out] hmlx      Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param new_slave_address New slave address value that wants to be stored in the EEPROM of the MLX90614 Device, which
+ *                          must be from \f$3_{d}\f$ up to \f$126_{d}\f$ .
+ * @param is_verify_enabled See the @ref start_mlx90614_handle_eeprom_write function.
+ *
+ * @retval  MLX90614_EC_OK  If the EEPROM Write was successfully started.
+ * @retval  MLX90614_EC_ERR If the given slave address is invalid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status start_mlx90614_handle_device_slave_address_write(MLX90614_EEPROM_Write *job, MLX90614_Handle *hmlx, uint8_t new_slave_address, uint8_t is_verify_enabled);
+
+/**@brief	Advances the given @ref MLX90614_EEPROM_Write by at most one I2C transaction.
+ *
+ * @param[in,out] job   Pointer to an already started @ref MLX90614_EEPROM_Write .
+ *
+ * @retval  MLX90614_EC_NA  If the EEPROM Write has not concluded yet, in which case this function has to be called
+ *                          again later.
+ * @retval  MLX90614_EC_OK  If the EEPROM Write has successfully concluded (or if the desired value was already stored,
+ *                          in which case the EEPROM is not written at all).
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the readback verification failed, if the PEC validation failed or if anything
+ *                          else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status pump_mlx90614_eeprom_write(MLX90614_EEPROM_Write *job);
+
+#endif
+
+#if (MLX90614_ENABLE_SCAN)
+/**@brief	Scans all the valid slave addresses of a MLX90614 Device (i.e., \f$3_{d}\f$ up to \f$126_{d}\f$ ) in the
+ *          given I2C Peripheral and records every one of them that responds into the given
+ *          @ref MLX90614_Scan_Result .
+ *
+ * @details Unlike the @ref find_mlx90614_slave_address function, which stops at the first device that it finds and
+ *          that waits @ref MLX90614_I2C_TIMEOUT for each slave address, this function probes every slave address with
+ *          the given timeout, which allows finding all the devices of a multi-sensor I2C bus in a fraction of the
+ *          time. In addition, if \p dst already holds a valid Scan Result, then it is given back as it is (i.e.,
+ *          without making any I2C transaction) unless a new scan is forced.
+ *
+ * @note    <i><b style="color:red;"><u>WARNING</u>:</b><b>Just like with the @ref find_mlx90614_slave_address
+ *          function, this function is only able to tell which slave addresses responded, but not whether they belong
+ *          to actual MLX90614 Devices.</b></i>
+ *
+ * @param[in] hi2c              Pointer to the I2C Handle Structure of the I2C Peripheral that wants to be scanned.
+ * @param[in,out] dst           Pointer to the @ref MLX90614_Scan_Result that will hold the result of the scan.
+ * @param probe_timeout_ms      Time in milliseconds that will be waited for each slave address to respond (e.g.,
+ *                              @ref MLX90614_SCAN_PROBE_TIMEOUT ).
+ * @param is_rescan_forced      \c 1 to scan the I2C bus even if \p dst already holds a valid Scan Result. Otherwise,
+ *                              \c 0 .
+ *
+ * @retval  MLX90614_EC_OK  If at least one slave address responded (or was recorded in the cached Scan Result).
+ * @retval  MLX90614_EC_NR  If no slave address responded.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status scan_mlx90614_bus(I2C_HandleTypeDef *hi2c, MLX90614_Scan_Result *dst, uint32_t probe_timeout_ms, uint8_t is_rescan_forced);
+
+/**@brief	Invalidates the given @ref MLX90614_Scan_Result so that the next call to @ref scan_mlx90614_bus with it
+ *          scans the I2C bus again.
+ *
+ * @param[out] scan Pointer to the @ref MLX90614_Scan_Result that wants to be invalidated.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void invalidate_mlx90614_scan(MLX90614_Scan_Result *scan);
+
+/**@brief	Tells whether a slave address responded in the given @ref MLX90614_Scan_Result .
+ *
+ * @param[in] scan          Pointer to the @ref MLX90614_Scan_Result of interest.
+ * @param slave_address     Slave address of interest.
+ *
+ * @return  \c 1 if \p scan is valid and \p slave_address responded in it. Otherwise, \c 0 .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint8_t is_mlx90614_address_in_scan(const MLX90614_Scan_Result *scan, uint8_t slave_address);
+
+/**@brief	Gets the lowest slave address that responded in the given @ref MLX90614_Scan_Result and that is greater
+ *          than or equal to the given one, which allows iterating through all the devices found (e.g., to initialize
+ *          their @ref MLX90614_Handle via the @ref init_mlx90614_handle function).
+ *
+ * @param[in] scan          Pointer to the @ref MLX90614_Scan_Result of interest.
+ * @param from_address      Slave address from which the search will start.
+ *
+ * @return  The slave address found, or \c 0 if there is none.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint8_t get_mlx90614_next_scanned_address(const MLX90614_Scan_Result *scan, uint8_t from_address);
+#endif
+
+/**@brief	Enables or disables the EEPROM Shadow of the given @ref MLX90614_Handle .
+ *
+ * @details Whenever the EEPROM Shadow is enabled, each EEPROM word used by the @ref mlx90614 (i.e., the
+ *          "ConfigRegister1" Register, the Slave Address, the \f$T_{O,MAX}\f$ and \f$T_{O,MIN}\f$ registers and the
+ *          Emissivity) is read from the MLX90614 Device only the first time that it is required and it is then served
+ *          from the RAM of our MCU/MPU (e.g., by @ref get_mlx90614_handle_iir or by the read stage of a
+ *          @ref MLX90614_EEPROM_Write ). In addition, every EEPROM Write made with this Handle keeps the EEPROM Shadow
+ *          up to date. Alternatively, all the words of the EEPROM Shadow can be loaded at once via the
+ *          @ref load_mlx90614_handle_eeprom_shadow function.
+ *
+ * @note    The EEPROM Shadow is disabled by default whenever initializing a @ref MLX90614_Handle . Enabling or
+ *          disabling it invalidates all of its words, and so does changing the slave address of the Handle (e.g., via
+ *          @ref set_mlx90614_handle_slave_address or @ref find_mlx90614_handle_slave_address ).
+ * @note    Do not enable the EEPROM Shadow if the EEPROM of the MLX90614 Device may be changed by any other means than
+ *          this Handle (e.g., by another MCU/MPU), since the EEPROM Shadow would then become outdated.
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle whose EEPROM Shadow wants to be configured.
+ * @param is_enabled    \c 1 to enable the EEPROM Shadow or \c 0 to disable it.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void set_mlx90614_handle_eeprom_shadow(MLX90614_Handle *hmlx, uint8_t is_enabled);
+
+/**@brief	Gets whether the EEPROM Shadow of the given @ref MLX90614_Handle is currently enabled.
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle of interest.
+ *
+ * @return  \c 1 if the EEPROM Shadow is enabled. Otherwise, \c 0 .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint8_t get_mlx90614_handle_eeprom_shadow(MLX90614_Handle *hmlx);
+
+/**@brief	Reads, from the MLX90614 Device of the given @ref MLX90614_Handle , all the words of its EEPROM Shadow at
+ *          once, regardless of whether they were already valid.
+ *
+ * @note    This function is meant to be called right after initializing the Handle and enabling its EEPROM Shadow
+ *          so that the later reads of the EEPROM words used by the @ref mlx90614 make no I2C transaction at all.
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle whose EEPROM Shadow, which must be enabled, wants to be
+ *                      loaded.
+ *
+ * @retval  MLX90614_EC_OK  If all the words of the EEPROM Shadow were successfully read.
+ * @retval  MLX90614_EC_NA  If the EEPROM Shadow of \p hmlx is disabled.
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the PEC validation failed or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status load_mlx90614_handle_eeprom_shadow(MLX90614_Handle *hmlx);
+
+/**@brief	Initializes the given @ref MLX90614_Filter so that it becomes empty.
+ *
+ * @param[out] filter   Pointer to the @ref MLX90614_Filter that wants to be initialized.
+ * @param type          Type of the Filter.
+ * @param length        Shift (i.e., \c 1 up to @ref MLX90614_FILTER_MAX_EMA_SHIFT ) if \p type is
+ *                      @ref MLX90614_FILTER_EMA , or \f$N\f$ (i.e., \c 1 up to @ref MLX90614_FILTER_MAX_WINDOW ) if
+ *                      \p type is either @ref MLX90614_FILTER_BOXCAR or @ref MLX90614_FILTER_MEDIAN . This param is
+ *                      ignored if \p type is @ref MLX90614_FILTER_NONE .
+ *
+ * @retval  MLX90614_EC_OK  If the Filter was successfully initialized.
+ * @retval  MLX90614_EC_ERR If either \p type or \p length are invalid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status init_mlx90614_filter(MLX90614_Filter *filter, MLX90614_Filter_Type type, uint8_t length);
+
+/**@brief	Empties the given @ref MLX90614_Filter while keeping its type and length.
+ *
+ * @param[in,out] filter    Pointer to an already initialized @ref MLX90614_Filter .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void reset_mlx90614_filter(MLX90614_Filter *filter);
+
+/**@brief	Gives a new temperature Raw Value to the given @ref MLX90614_Filter and gets its filtered output.
+ *
+ * @details The Exponential Moving Average and Boxcar Filters take a constant amount of work per sample. The Median
+ *          Filter sorts a copy of its window, which is bounded by @ref MLX90614_FILTER_MAX_WINDOW . Until the
+ *          Filter has received \f$N\f$ samples, its output is calculated only with the samples received so far, and
+ *          the Exponential Moving Average Filter starts from its first sample.
+ *
+ * @param[in,out] filter    Pointer to an already initialized @ref MLX90614_Filter .
+ * @param raw               New temperature Raw Value, whose Error Flag must be cleared.
+ *
+ * @return  The filtered temperature Raw Value.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint16_t update_mlx90614_filter(MLX90614_Filter *filter, uint16_t raw);
+
+/**@brief	Attaches a @ref MLX90614_Filter to a temperature channel of the given @ref MLX90614_Handle .
+ *
+ * @note    A Filter must only be attached to a single temperature channel of a single Handle. In addition, the
+ *          blocking and the Asynchronous functions of a Handle must not be used at the same time with a filtered
+ *          channel, since they would both update its Filter.
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of interest.
+ * @param channel       Temperature channel whose Raw Values want to be filtered.
+ * @param[in] filter    Pointer to an already initialized @ref MLX90614_Filter , or \c NULL to detach the currently
+ *                      attached one.
+ *
+ * @retval  MLX90614_EC_OK  If the Filter was successfully attached or detached.
+ * @retval  MLX90614_EC_ERR If \p channel is invalid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status set_mlx90614_handle_filter(MLX90614_Handle *hmlx, MLX90614_Channel_t channel, MLX90614_Filter *filter);
+
+#ifdef HAL_TIM_MODULE_ENABLED
+/**@brief	Initializes a @ref MLX90614_PWM Reader and starts the Input Capture of both of its Hardware Timer
+ *          channels.
+ *
+ * @note    This function is only available if the HAL TIM Module is enabled.
+ *
+ * @param[out] pwm          Pointer to the @ref MLX90614_PWM Reader to be initialized.
+ * @param[in] htim          Pointer to the Hardware Timer Handle, which must already be configured in "PWM Input" mode
+ *                          (see @ref MLX90614_PWM ).
+ * @param period_channel    Channel of \p htim that captures the period of the PWM (e.g., @ref TIM_CHANNEL_1 ).
+ * @param high_channel      Channel of \p htim that captures the high time of the PWM (e.g., @ref TIM_CHANNEL_2 ).
+ * @param to_max            \f$T_{O,MAX}\f$ of the PWM output in hundredths of Kelvin (see
+ *                          @ref get_mlx90614_handle_pwm_range ).
+ * @param to_min            \f$T_{O,MIN}\f$ of the PWM output in hundredths of Kelvin (see
+ *                          @ref get_mlx90614_handle_pwm_range ).
+ * @param temp_t            Temperature Type with which the PWM Reader will be responding.
+ *
+ * @retval  MLX90614_EC_OK  If the PWM Reader was successfully initialized.
+ * @retval  MLX90614_EC_NR  If the Hardware Timer was busy.
+ * @retval  MLX90614_EC_ERR If either \p to_max is not greater than \p to_min , if \p temp_t is invalid or if
+ *                          anything else went wrong while starting the Input Capture.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status init_mlx90614_pwm(MLX90614_PWM *pwm, TIM_HandleTypeDef *htim, uint32_t period_channel, uint32_t high_channel, uint16_t to_max, uint16_t to_min, MLX90614_Temp_t temp_t);
+
+/**@brief	Stops the Input Capture of both of the Hardware Timer channels of a @ref MLX90614_PWM Reader.
+ *
+ * @note    This function is only available if the HAL TIM Module is enabled.
+ *
+ * @param[in] pwm   Pointer to the @ref MLX90614_PWM Reader of interest.
+ *
+ * @retval  MLX90614_EC_OK  If the Input Capture was successfully stopped.
+ * @retval  MLX90614_EC_ERR If anything went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status stop_mlx90614_pwm(MLX90614_PWM *pwm);
+
+/**@brief	Attaches a @ref MLX90614_Filter to a @ref MLX90614_PWM Reader, so that every Raw Value that it gives is
+ *          filtered first, or detaches it if \c NULL is given.
+ *
+ * @note    This function is only available if the HAL TIM Module is enabled.
+ *
+ * @param[out] pwm      Pointer to the @ref MLX90614_PWM Reader of interest.
+ * @param[in] filter    Pointer to an already initialized @ref MLX90614_Filter (see @ref init_mlx90614_filter ), or
+ *                      \c NULL .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void set_mlx90614_pwm_filter(MLX90614_PWM *pwm, MLX90614_Filter *filter);
+
+/**@brief	Gets the Raw Value of the temperature measured in the latest PWM cycle of a @ref MLX90614_PWM Reader,
+ *          which has the same \f$0.02\f$ Kelvin resolution as the Raw Values read via the I2C Protocol.
+ *
+ * @note    This function is only available if the HAL TIM Module is enabled.
+ *
+ * @param[in] pwm   Pointer to the @ref MLX90614_PWM Reader of interest.
+ * @param[out] dst  Pointer to the Memory Address where this function will store the Raw Value.
+ *
+ * @retval  MLX90614_EC_OK  If the Raw Value was successfully measured and stored into \p dst .
+ * @retval  MLX90614_EC_NA  If no whole PWM cycle has been captured yet.
+ * @retval  MLX90614_EC_ERR If the captured high time is out of the range that the PWM output can give (e.g., due to
+ *                          noise or due to a Hardware Timer whose counter is too short for the PWM period).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_pwm_raw_temperature(MLX90614_PWM *pwm, uint16_t *dst);
+
+/**@brief	Gets the temperature measured in the latest PWM cycle of a @ref MLX90614_PWM Reader in its configured
+ *          Temperature Type.
+ *
+ * @note    This function is only available if the HAL TIM Module is enabled.
+ *
+ * @param[in] pwm   Pointer to the @ref MLX90614_PWM Reader of interest.
+ * @param[out] dst  Pointer to the Memory Address where this function will store the temperature.
+ *
+ * @return  The same @ref MLX90614_Status Exception Codes of the @ref get_mlx90614_pwm_raw_temperature function.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_pwm_temperature(MLX90614_PWM *pwm, float *dst);
+
+/**@brief	Gets the temperature measured in the latest PWM cycle of a @ref MLX90614_PWM Reader in hundredths of the
+ *          units of its configured Temperature Type, by using only integer arithmetic (see
+ *          @ref get_mlx90614_converted_centi_temperature ).
+ *
+ * @note    This function is only available if the HAL TIM Module is enabled.
+ *
+ * @param[in] pwm   Pointer to the @ref MLX90614_PWM Reader of interest.
+ * @param[out] dst  Pointer to the Memory Address where this function will store the temperature.
+ *
+ * @return  The same @ref MLX90614_Status Exception Codes of the @ref get_mlx90614_pwm_raw_temperature function.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_pwm_centi_temperature(MLX90614_PWM *pwm, int32_t *dst);
+#endif
+
+#if (MLX90614_TRANSPORT == MLX90614_TRANSPORT_CUSTOM)
+/**@brief	Reads the given number of bytes of the given RAM or EEPROM command from a MLX90614 Device, which is the
+ *          blocking reading through which the @ref mlx90614 makes all of its temperature and EEPROM readings whenever
+ *          @ref MLX90614_TRANSPORT is @ref MLX90614_TRANSPORT_CUSTOM .
+ *
+ * @details The implementer must define this function so that it makes an SMBus "Read Word" transaction (i.e., a START,
+ *          the slave address with the write bit, \p command , a Repeated START, the slave address with the read bit
+ *          and then \p size bytes, from which the last one is NACKed, and a STOP) and gives back the bytes as they
+ *          were received, since the PEC validation is made by the @ref mlx90614 itself.
+ *
+ * @note    This function is only declared if @ref MLX90614_TRANSPORT is @ref MLX90614_TRANSPORT_CUSTOM .
+ * @note    A @ref HAL_BUSY or @ref HAL_TIMEOUT result is treated as the MLX90614 Device not having responded, whereas
+ *          a @ref HAL_ERROR result (e.g., a NACK) is treated as an error, just as with @ref HAL_I2C_Mem_Read .
+ *
+ * @param[in,out] hi2c                      Pointer to the I2C Handle given to the @ref MLX90614_Handle in use, which
+ *                                          can be cast to whatever bus handle the port needs.
+ * @param slave_address_one_bit_left_shifted Slave address of the MLX90614 Device, shifted to the left by one bit.
+ * @param command                           RAM or EEPROM command that wants to be read.
+ * @param[out] dst                          Pointer to the Memory Address where the bytes read must be stored.
+ * @param size                              Number of bytes to read, which can be either \c 2 or \c 3 (i.e., with
+ *                                          the PEC byte).
+ * @param timeout                           Timeout in milliseconds of the @ref MLX90614_Retry_Policy in use.
+ *
+ * @return  The @ref HAL_StatusTypeDef result of the transaction.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+HAL_StatusTypeDef mlx90614_transport_read(I2C_HandleTypeDef *hi2c, uint8_t slave_address_one_bit_left_shifted, uint8_t command, uint8_t *dst, uint16_t size, uint32_t timeout);
+#endif
+
+#if (MLX90614_ENABLE_RTOS)
+/**@brief	Initializes a @ref MLX90614_RTOS_Bus with the given RTOS primitives and queue.
+ *
+ * @note    This function is only available if @ref MLX90614_ENABLE_RTOS is enabled.
+ *
+ * @param[out] bus      Pointer to the @ref MLX90614_RTOS_Bus to be initialized.
+ * @param[in] p_port    Pointer to the @ref MLX90614_RTOS_Port whose RTOS primitives will be used by the RTOS Bus, which
+ *                      must remain valid for as long as the RTOS Bus is used.
+ * @param[in] queue     Handle of the queue of the RTOS Bus, whose items must have the size of a pointer to a
+ *                      @ref MLX90614_RTOS_Request .
+ *
+ * @retval  MLX90614_EC_OK  If the RTOS Bus was successfully initialized.
+ * @retval  MLX90614_EC_ERR If either \p p_port , any of its hooks or \p queue is \c NULL .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status init_mlx90614_rtos_bus(MLX90614_RTOS_Bus *bus, const MLX90614_RTOS_Port *p_port, void *queue);
+
+/**@brief	Requests the bus-owner task of a @ref MLX90614_RTOS_Bus to execute the given operation, and blocks the
+ *          calling task on a task notification until it has been executed.
+ *
+ * @note    This function is only available if @ref MLX90614_ENABLE_RTOS is enabled.
+ * @note    The \p timeout param only bounds the time waited for the queue of the RTOS Bus to have room for the
+ *          Request. Once it has been queued, the calling task will wait until it is serviced, since the Request lives
+ *          in its stack, where the operation itself is bounded by the timeouts of the @ref mlx90614 (e.g.,
+ *          @ref MLX90614_I2C_TIMEOUT ).
+ *
+ * @param[in] bus           Pointer to the @ref MLX90614_RTOS_Bus of the I2C Peripheral of \p hmlx .
+ * @param[in] p_operation   Pointer to the operation to be executed by the bus-owner task.
+ * @param[in,out] hmlx      Pointer to the @ref MLX90614_Handle with which the operation will be executed.
+ * @param[in,out] arg       Argument with which the operation will be executed.
+ * @param timeout           Time in milliseconds that will be waited for the queue of the RTOS Bus to have room for the
+ *                          Request, or @ref MLX90614_RTOS_WAIT_FOREVER .
+ *
+ * @retval  MLX90614_EC_NR  If the queue of the RTOS Bus remained full for the whole \p timeout .
+ * @return  Otherwise, the @ref MLX90614_Status Exception Code given back by the operation.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status submit_mlx90614_rtos_request(MLX90614_RTOS_Bus *bus, MLX90614_RTOS_Operation p_operation, MLX90614_Handle *hmlx, void *arg, uint32_t timeout);
+
+/**@brief	Reads all the temperature channels of the MLX90614 Device of a @ref MLX90614_Handle through the
+ *          bus-owner task of its @ref MLX90614_RTOS_Bus (i.e., via @ref get_mlx90614_handle_all_temperatures ).
+ *
+ * @note    This function is only available if @ref MLX90614_ENABLE_RTOS is enabled.
+ *
+ * @param[in] bus       Pointer to the @ref MLX90614_RTOS_Bus of the I2C Peripheral of \p hmlx .
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of interest.
+ * @param[out] dst      Pointer to the @ref MLX90614_Sample into which the temperatures will be stored.
+ * @param timeout       Time in milliseconds that will be waited for the queue of the RTOS Bus to have room for the
+ *                      Request (see @ref submit_mlx90614_rtos_request ).
+ *
+ * @return  The same @ref MLX90614_Status Exception Codes of the @ref submit_mlx90614_rtos_request function.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status get_mlx90614_rtos_all_temperatures(MLX90614_RTOS_Bus *bus, MLX90614_Handle *hmlx, MLX90614_Sample *dst, uint32_t timeout);
+
+/**@brief	Services the next @ref MLX90614_RTOS_Request of a @ref MLX90614_RTOS_Bus , if there is any, by executing
+ *          its operation and then notifying its task.
+ *
+ * @note    This function is only available if @ref MLX90614_ENABLE_RTOS is enabled.
+ * @note    This function must only be called from the bus-owner task of the RTOS Bus, which is already done by the
+ *          @ref mlx90614_rtos_bus_task function. It is only made public for implementers whose bus-owner task also
+ *          has other work to do.
+ *
+ * @param[in,out] bus   Pointer to the @ref MLX90614_RTOS_Bus to be serviced.
+ * @param timeout       Time in milliseconds that will be waited for a Request to arrive, or
+ *                      @ref MLX90614_RTOS_WAIT_FOREVER .
+ *
+ * @retval  MLX90614_EC_OK  If a Request was serviced.
+ * @retval  MLX90614_EC_NR  If no Request arrived during the whole \p timeout .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status service_mlx90614_rtos_bus(MLX90614_RTOS_Bus *bus, uint32_t timeout);
+
+/**@brief	Body of the bus-owner task of a @ref MLX90614_RTOS_Bus , which indefinitely services its Requests.
+ *
+ * @details This function is meant to be given as the entry function of the bus-owner task when creating it (e.g.,
+ *          via <tt>xTaskCreate(mlx90614_rtos_bus_task, "mlx90614", 256, &bus, priority, NULL)</tt> ), where its
+ *          argument must be a pointer to an already initialized @ref MLX90614_RTOS_Bus (see
+ *          @ref init_mlx90614_rtos_bus ).
+ *
+ * @note    This function is only available if @ref MLX90614_ENABLE_RTOS is enabled.
+ *
+ * @param[in,out] argument  Pointer to the @ref MLX90614_RTOS_Bus to be serviced.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void mlx90614_rtos_bus_task(void *argument);
+#endif
+
+#if (MLX90614_ENABLE_STATS)
+/**@brief	Gets a copy of the execution statistics recorded so far by the @ref mlx90614 .
+ *
+ * @note    This function is only available if @ref MLX90614_ENABLE_STATS is enabled.
+ *
+ * @param[out] dst  Pointer to the @ref MLX90614_Stats into which the statistics will be copied.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void get_mlx90614_stats(MLX90614_Stats *dst);
+
+/**@brief	Resets all the execution statistics recorded so far by the @ref mlx90614 .
+ *
+ * @note    This function is only available if @ref MLX90614_ENABLE_STATS is enabled.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void reset_mlx90614_stats(void);
+#endif
+
+#if (MLX90614_ENABLE_BENCHMARK)
+/**@brief	Measures the cost of the given @ref MLX90614_Benchmark_Case by running it the given number of times with the
+ *          given @ref MLX90614_Handle .
+ *
+ * @details The case is run with the SMBus clock and the PEC validation currently configured in \p hmlx , but with its
+ *          Freshness Cache disabled (see @ref set_mlx90614_handle_freshness_window ) so that every sample actually
+ *          goes through the I2C bus, which is restored once the case has concluded. Each of the Asynchronous
+ *          readings is polled until it concludes, which requires the HAL callbacks of the I2C Peripheral of \p hmlx
+ *          to be forwarded to @ref mlx90614_i2c_mem_rx_cplt_callback and @ref mlx90614_i2c_error_callback .
+ *
+ * @note    This function is only available if @ref MLX90614_ENABLE_BENCHMARK is enabled.
+ *
+ * @param[in,out] hmlx  Pointer to the already initialized @ref MLX90614_Handle of the MLX90614 Device with which the
+ *                      case will be run.
+ * @param bench_case    @ref MLX90614_Benchmark_Case that wants to be measured.
+ * @param iterations    Number of times that the case will be run, which must not be \c 0 .
+ * @param[out] dst      Pointer to the @ref MLX90614_Benchmark_Result into which the measurements will be stored.
+ *
+ * @retval  MLX90614_EC_OK  If at least one sample was successfully obtained.
+ * @retval  MLX90614_EC_NR  If no sample could be obtained (e.g., because the MLX90614 Device did not respond).
+ * @retval  MLX90614_EC_NA  If \p bench_case is not available in this build (i.e., @ref MLX90614_BENCHMARK_SCAN while
+ *                          @ref MLX90614_ENABLE_SCAN is disabled).
+ * @retval  MLX90614_EC_ERR If either the arguments are not valid or if an Asynchronous reading did not conclude
+ *                          within the timeout of the @ref MLX90614_Retry_Policy of \p hmlx per each of its I2C
+ *                          transactions, in which case that reading is aborted.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status run_mlx90614_benchmark_case(MLX90614_Handle *hmlx, MLX90614_Benchmark_Case bench_case, uint32_t iterations, MLX90614_Benchmark_Result *dst);
+
+#ifdef HAL_UART_MODULE_ENABLED
+/**@brief	Runs every @ref MLX90614_Benchmark_Case with the given @ref MLX90614_Handle at SMBus clocks of 10kHz, 50kHz
+ *          and 100kHz, both with the PEC validation disabled and enabled, and reports their
+ *          @ref MLX90614_Benchmark_Result via the given UART.
+ *
+ * @details The report starts with a line, beginning with \c '#' , that tells the compile-time options of the build
+ *          being measured (i.e., @ref MLX90614_BENCHMARK_CORE_CLOCK , @ref MLX90614_PEC_IMPLEMENTATION ,
+ *          @ref MLX90614_ASYNC_USE_DMA , @ref MLX90614_TRANSPORT and @ref MLX90614_FIXED_UNIT ), followed by a line of
+ *          Comma Separated Values with the names of the columns and then by one line per each case, SMBus clock and
+ *          PEC validation, so that the reports of several builds can be directly appended into a single spreadsheet
+ *          to choose the configuration of each product from data. The cases that make no I2C transaction or that are
+ *          not affected by the PEC validation (i.e., the conversion and scan cases) are only reported with the PEC
+ *          validation disabled.<br><br>
+ *          The SMBus clock of the I2C Peripheral of \p hmlx is changed via @ref MLX90614_BENCHMARK_SET_I2C_CLOCK and
+ *          @ref HAL_I2C_Init , whereas its PEC validation is changed via @ref set_mlx90614_handle_pec_check , and
+ *          both of them are restored before this function returns.
+ *
+ * @note    This function is only available if @ref MLX90614_ENABLE_BENCHMARK is enabled and if the UART module of the
+ *          HAL is enabled (i.e., if @ref HAL_UART_MODULE_ENABLED is defined).
+ * @note    <b>This function blocks for as long as all the cases take</b>, which is meant to be called once from the
+ *          main function of a dedicated benchmark firmware, after having initialized \p hmlx .
+ *
+ * @param[in,out] hmlx  Pointer to the already initialized @ref MLX90614_Handle of the MLX90614 Device with which the
+ *                      cases will be run.
+ * @param[in] huart     Pointer to the UART Handle Structure of the UART via which the results will be reported.
+ * @param iterations    Number of times that each case will be run per each SMBus clock and PEC validation, which
+ *                      must not be \c 0 .
+ *
+ * @retval  MLX90614_EC_OK  If every case was run and reported, even if some of them could not obtain any sample.
+ * @retval  MLX90614_EC_ERR If either the arguments are not valid, if the I2C Peripheral could not be re-initialized,
+ *                          if the UART could not transmit the report or if an Asynchronous reading did not conclude.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+MLX90614_Status run_mlx90614_benchmark(MLX90614_Handle *hmlx, UART_HandleTypeDef *huart, uint32_t iterations);
+#endif
+#endif
 
 #endif /* MLX90614_IR_THERMOMETER_H_ */
 
@@ -0,0 +1,138 @@
+/**@file
+ * @brief	MLX90614 Infra Red Thermometer's driver Configuration Header file.
+ *
+ * @addtogroup mlx90614
+ * @{
+ *
+ * @details This file holds all the compile-time configuration options of the @ref mlx90614 , where each of them can be
+ *          changed either by editing this file or by defining it via the compiler flags (e.g.,
+ *          <tt>-DMLX90614_FIXED_UNIT=1</tt> ), since each of them is only defined here whenever it has not already been
+ *          defined.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#ifndef MLX90614_IR_THERMOMETER_CONFIG_H_
+#define MLX90614_IR_THERMOMETER_CONFIG_H_
+
+#ifndef MLX90614_I2C_TIMEOUT
+#define MLX90614_I2C_TIMEOUT                (100)     /**< @brief Time in milliseconds that our MCU/MPU will wait for the MLX90614 Infra Red Thermometer device to respond to an I2C transaction between them. @note This is the timeout with which the @ref MLX90614_Retry_Policy of each @ref MLX90614_Handle is initialized, which can then be changed at runtime via @ref set_mlx90614_handle_retry_policy . */
+#endif
+#ifndef MLX90614_ERASE_OR_WRITE_CELL_TIME
+#define MLX90614_ERASE_OR_WRITE_CELL_TIME   (1000)    /**< @brief Maximum time in milliseconds that our MCU/MPU will wait for the MLX90614 Infra Red Thermometer device for either Erasing or Writing Cells in its EEPROM. @note  This is used whenever erasing and writing values into the MLX90614 EEPROM (see @ref MLX90614_EEPROM_Write ), where the EEPROM cells are read back until they hold the expected value, unless the readback verification was disabled, in which case this whole time is waited. @note  Have in consideration that the MLX90614 Datasheet states that either erasing or writing EEPROM cells typically takes 5ms. However, they do not tell what is the maximum expected wait time for this. Therefore, in order to be very safe, a very larger time was assigned, but feel free to change it according to your needs as long as you have this information in mind. */
+#endif
+#ifndef MLX90614_EEPROM_CELL_MIN_TIME
+#define MLX90614_EEPROM_CELL_MIN_TIME       (5)       /**< @brief Time in milliseconds that our MCU/MPU will wait before starting to read back an EEPROM cell of the MLX90614 Infra Red Thermometer device that is being either Erased or Written, which is the typical time that the MLX90614 Datasheet states for this. */
+#endif
+#ifndef IS_MLX90614_READY_NUMBER_OF_TRIALS
+#define IS_MLX90614_READY_NUMBER_OF_TRIALS	(1)       /**< @brief Number of attempts to be made whenever checking if the MLX90614 Infra Red Thermometer is ready for I2C communication. */
+#endif
+#ifndef MLX90614_BUS_RECOVERY_CLOCKS
+#define MLX90614_BUS_RECOVERY_CLOCKS        (9)       /**< @brief Maximum number of clock pulses that the @ref recover_mlx90614_i2c_bus function generates on SCL to make a slave device release SDA, which is enough for it to finish shifting out any byte that it was in the middle of plus its acknowledge bit. */
+#endif
+#ifndef MLX90614_BUS_RECOVERY_DELAY_LOOPS
+#define MLX90614_BUS_RECOVERY_DELAY_LOOPS   (50)      /**< @brief Number of iterations of the busy-wait loop with which the @ref recover_mlx90614_i2c_bus function waits for each half period of its clock pulses, which gives roughly a 100kHz clock on a 72MHz MCU/MPU and which only needs to keep it under the 100kHz of the SMBus standard mode. */
+#endif
+#ifndef MLX90614_WAKE_PULSE_TIME
+#define MLX90614_WAKE_PULSE_TIME            (35)      /**< @brief Time in milliseconds during which SDA is held low, with SCL high, to wake up a MLX90614 Device from its Sleep Mode, which must be greater than the \f$t_{DDQ} > 33ms\f$ stated in the MLX90614 Datasheet. */
+#endif
+#ifndef MLX90614_DEFAULT_RETRIES
+#define MLX90614_DEFAULT_RETRIES            (0)       /**< @brief Number of retries with which the @ref MLX90614_Retry_Policy of each @ref MLX90614_Handle is initialized. */
+#endif
+#ifndef MLX90614_DEFAULT_BACKOFF
+#define MLX90614_DEFAULT_BACKOFF            (1)       /**< @brief Time in milliseconds that the @ref MLX90614_Retry_Policy of each @ref MLX90614_Handle is initialized to wait before its first retry. */
+#endif
+#ifndef MLX90614_DEFAULT_MAX_BACKOFF
+#define MLX90614_DEFAULT_MAX_BACKOFF        (16)      /**< @brief Maximum time in milliseconds with which the @ref MLX90614_Retry_Policy of each @ref MLX90614_Handle is initialized to wait before any of its retries. */
+#endif
+#define MLX90614_ADDRESS_VALIDATION_PROBE   (0)       /**< @brief Identifier of the Slave Address Validation with which each new slave address of a @ref MLX90614_Handle is accepted only after a blocking @ref HAL_I2C_IsDeviceReady probe under it has succeeded. @note See @ref set_mlx90614_handle_address_validation . */
+#define MLX90614_ADDRESS_VALIDATION_LAZY    (1)       /**< @brief Identifier of the Slave Address Validation with which each new slave address of a @ref MLX90614_Handle is accepted right away without any I2C transaction, where the first successful reading under it is then taken as the proof that the MLX90614 Device is there. @note See @ref set_mlx90614_handle_address_validation . */
+#define MLX90614_ADDRESS_VALIDATION_SCAN    (2)       /**< @brief Identifier of the Slave Address Validation with which each new slave address of a @ref MLX90614_Handle is validated against the @ref MLX90614_Scan_Result attached to it without any I2C transaction. @note See @ref set_mlx90614_handle_address_scan . */
+#ifndef MLX90614_DEFAULT_ADDRESS_VALIDATION
+#define MLX90614_DEFAULT_ADDRESS_VALIDATION (MLX90614_ADDRESS_VALIDATION_PROBE) /**< @brief Slave Address Validation with which each @ref MLX90614_Handle is initialized, which can be either @ref MLX90614_ADDRESS_VALIDATION_PROBE or @ref MLX90614_ADDRESS_VALIDATION_LAZY . @note This is also the Slave Address Validation applied to the custom slave address given to the @ref init_mlx90614_module and @ref init_mlx90614_handle functions. */
+#endif
+#ifndef MLX90614_DEFAULT_FRESHNESS_WINDOW
+#define MLX90614_DEFAULT_FRESHNESS_WINDOW   (0)       /**< @brief Freshness Window, in units of @ref MLX90614_TIMESTAMP , with which each @ref MLX90614_Handle is initialized, where \c 0 disables its Freshness Cache (see @ref set_mlx90614_handle_freshness_window ). */
+#endif
+#ifndef MLX90614_SCAN_PROBE_TIMEOUT
+#define MLX90614_SCAN_PROBE_TIMEOUT         (2)       /**< @brief Suggested time in milliseconds that our MCU/MPU will wait for each slave address to respond whenever scanning the I2C bus via the @ref scan_mlx90614_bus function, which can be much shorter than @ref MLX90614_I2C_TIMEOUT since a device that is present acknowledges its slave address right away. */
+#endif
+#ifndef MLX90614_FILTER_MAX_WINDOW
+#define MLX90614_FILTER_MAX_WINDOW          (8)       /**< @brief Maximum number of samples that the window of a @ref MLX90614_Filter can hold, which bounds the length of its Boxcar and Median Filters. */
+#endif
+#ifndef MLX90614_FILTER_MAX_EMA_SHIFT
+#define MLX90614_FILTER_MAX_EMA_SHIFT       (8)       /**< @brief Maximum shift of the Exponential Moving Average Filter of a @ref MLX90614_Filter , which gives the lowest weight (i.e., \f$1/256\f$ ) that each new sample can have in its output. */
+#endif
+#ifndef MLX90614_MAX_NUMBER_OF_ASYNC_I2C
+#define MLX90614_MAX_NUMBER_OF_ASYNC_I2C    (3)       /**< @brief Maximum number of I2C Peripherals that can simultaneously have an Asynchronous temperature reading of the @ref mlx90614 in process. @note Only one Asynchronous temperature reading can be in process at a time per I2C Peripheral. */
+#endif
+#ifndef MLX90614_AGGREGATE_MAX_HANDLES
+#define MLX90614_AGGREGATE_MAX_HANDLES      (16)      /**< @brief Maximum number of @ref MLX90614_Handle that can be aggregated by a single call to the @ref aggregate_mlx90614_handles function, which sizes the arrays that it keeps in the stack and which must not be greater than \c 32 . */
+#endif
+#define MLX90614_PEC_BITWISE                (0)       /**< @brief Identifier of the PEC implementation of the @ref mlx90614 that calculates the PEC byte one bit at a time, which requires no lookup table at all but is the slowest one. @note See @ref MLX90614_PEC_IMPLEMENTATION . */
+#define MLX90614_PEC_NIBBLE_TABLE           (1)       /**< @brief Identifier of the PEC implementation of the @ref mlx90614 that calculates the PEC byte four bits at a time via a 16 bytes lookup table, which is meant for Flash constrained MCUs/MPUs. @note See @ref MLX90614_PEC_IMPLEMENTATION . */
+#define MLX90614_PEC_BYTE_TABLE             (2)       /**< @brief Identifier of the PEC implementation of the @ref mlx90614 that calculates the PEC byte a whole byte at a time via a 256 bytes lookup table, which is the fastest one. @note See @ref MLX90614_PEC_IMPLEMENTATION . */
+#ifndef MLX90614_PEC_IMPLEMENTATION
+#define MLX90614_PEC_IMPLEMENTATION         (MLX90614_PEC_BYTE_TABLE) /**< @brief PEC implementation that the @ref mlx90614 will use to calculate the PEC byte of its I2C transactions, which can be either @ref MLX90614_PEC_BITWISE , @ref MLX90614_PEC_NIBBLE_TABLE or @ref MLX90614_PEC_BYTE_TABLE . */
+#endif
+#ifndef MLX90614_RING_BUFFER_CAPACITY
+#define MLX90614_RING_BUFFER_CAPACITY      (32)      /**< @brief Number of entries that each @ref MLX90614_Ring_Buffer can hold at a time. @note This value must be a power of two so that the indexes of the Ring Buffer can be wrapped with a bit mask instead of a division. */
+#endif
+#ifndef MLX90614_MIN_SAMPLING_PERIOD
+#define MLX90614_MIN_SAMPLING_PERIOD       (100)     /**< @brief Minimum period in milliseconds with which a @ref MLX90614_Scheduler will request new readings to its MLX90614 Device, which is applied on top of the settling time of the IIR and FIR filters configured in the MLX90614 Device (see @ref get_mlx90614_settling_time ) in order to not read the same RAM value several times. @note Since that settling time is only an estimation, feel free to change this value according to the variant of your MLX90614 Device as listed in its Datasheet. */
+#endif
+#ifndef MLX90614_TIMESTAMP
+#define MLX90614_TIMESTAMP()                (HAL_GetTick()) /**< @brief Expression with which the @ref mlx90614 timestamps each entry pushed into a @ref MLX90614_Ring_Buffer , which by default gives the HAL tick in milliseconds. @note This can be defined before including this header file (e.g., as \c (DWT->CYCCNT) ) if a finer time resolution is required. */
+#endif
+#ifndef MLX90614_ENABLE_STATS
+#define MLX90614_ENABLE_STATS              (0)       /**< @brief Flag used to indicate whether the @ref mlx90614 will record its execution statistics (see @ref MLX90614_Stats ) with a value of \c 1 , or not with a value of \c 0 , in which case all of its instrumentation compiles to nothing. */
+#endif
+#ifndef MLX90614_CYCLE_COUNTER
+#define MLX90614_CYCLE_COUNTER()            (DWT->CYCCNT) /**< @brief Expression with which the @ref mlx90614 reads the current CPU cycle count whenever @ref MLX90614_ENABLE_STATS is enabled, which by default is the DWT Cycle Counter of the Cortex-M core. @note The DWT Cycle Counter must be enabled by the implementer before using the @ref mlx90614 (i.e., via <tt>CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; DWT->CYCCNT = 0; DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;</tt> ). @note Cortex-M0/M0+ cores have no DWT Cycle Counter, in which case this can be defined to any other free-running counter (e.g., a hardware timer) before including this header file. */
+#endif
+#ifndef MLX90614_ENABLE_RTOS
+#define MLX90614_ENABLE_RTOS               (0)       /**< @brief Flag used to indicate whether the RTOS Port Layer of the @ref mlx90614 (see @ref MLX90614_RTOS_Bus ) will be compiled with a value of \c 1 , or not with a value of \c 0 . */
+#endif
+#ifndef MLX90614_ASYNC_USE_DMA
+#define MLX90614_ASYNC_USE_DMA              (1)       /**< @brief Flag used to indicate whether the Asynchronous temperature reading functions of the @ref mlx90614 will use the DMA (i.e., @ref HAL_I2C_Mem_Read_DMA ) or the Interrupt (i.e., @ref HAL_I2C_Mem_Read_IT ) mode of the I2C Peripheral, where a value of \c 1 stands for DMA Mode and a value of \c 0 stands for Interrupt Mode. @note If DMA Mode is chosen, then make sure to have configured a DMA Channel for the I2C RX of the I2C Peripheral that will be used in this module (e.g., via the STM32CubeMX). @note In either case, the I2C Event and Error Interrupts of that I2C Peripheral must be enabled in the NVIC. */
+#endif
+#define MLX90614_TRANSPORT_HAL              (0)       /**< @brief Identifier of the Transport of the @ref mlx90614 that makes its blocking readings via @ref HAL_I2C_Mem_Read . @note See @ref MLX90614_TRANSPORT . */
+#define MLX90614_TRANSPORT_LL               (1)       /**< @brief Identifier of the Transport of the @ref mlx90614 that makes its blocking readings by directly driving the registers of the I2C Peripheral, which skips the locking and @ref HAL_GetTick timeout polling of the HAL. @note The state of the I2C Handle is still checked and kept busy during each reading, so that it never overlaps with a transaction of the HAL (e.g., an Asynchronous reading) on the same I2C Peripheral, but either of them is refused with @ref HAL_BUSY while the other is in process. @note This Transport is only available for the I2C Peripherals of the STM32F1, STM32F2, STM32F4 and STM32L1 series (i.e., the ones with the \c SR1 and \c SR2 registers). @note See @ref MLX90614_TRANSPORT . */
+#define MLX90614_TRANSPORT_CUSTOM           (2)       /**< @brief Identifier of the Transport of the @ref mlx90614 that makes its blocking readings via the @ref mlx90614_transport_read function, which is to be defined by the implementer (e.g., for a non STMicroelectronics port). @note See @ref MLX90614_TRANSPORT . */
+#ifndef MLX90614_TRANSPORT
+#define MLX90614_TRANSPORT                  (MLX90614_TRANSPORT_HAL) /**< @brief Transport with which the @ref mlx90614 will make its blocking readings from the MLX90614 Device, which is what every temperature and EEPROM reading goes through, and which can be either @ref MLX90614_TRANSPORT_HAL , @ref MLX90614_TRANSPORT_LL or @ref MLX90614_TRANSPORT_CUSTOM . @note Writes, probes and Asynchronous readings are always made via the HAL, since their cost is dominated by the MLX90614 Device rather than by the MCU/MPU. */
+#endif
+#ifndef MLX90614_LL_POLL_LIMIT
+#define MLX90614_LL_POLL_LIMIT              (20000)   /**< @brief Maximum number of times that the @ref MLX90614_TRANSPORT_LL Transport polls a status flag of the I2C Peripheral before giving up with @ref HAL_TIMEOUT , which is used instead of the timeout of the @ref MLX90614_Retry_Policy to avoid reading @ref HAL_GetTick while polling and which gives several milliseconds on a 72MHz MCU/MPU. */
+#endif
+
+#define MLX90614_FIXED_UNIT_NONE            (-1)      /**< @brief Value of @ref MLX90614_FIXED_UNIT with which the Temperature Type of each @ref MLX90614_Handle can be chosen at runtime. */
+#ifndef MLX90614_FIXED_UNIT
+#define MLX90614_FIXED_UNIT                 (MLX90614_FIXED_UNIT_NONE) /**< @brief Temperature Type to which the @ref mlx90614 will be specialized at compile-time, which can be either \c 0 for Kelvin, \c 1 for Celsius or \c 2 for Fahrenheit (i.e., the values of @ref MLX90614_Temp_t ), or @ref MLX90614_FIXED_UNIT_NONE for the Temperature Type to be chosen at runtime. @note Whenever a Temperature Type is fixed, the float conversions of the @ref mlx90614 compile to an inlined constant scale and offset instead of an indirect call per reading, the conversion functions of the other Temperature Types are not compiled at all and any attempt to use another Temperature Type is rejected with @ref MLX90614_EC_ERR . */
+#endif
+#ifndef MLX90614_ENABLE_EEPROM_WRITE
+#define MLX90614_ENABLE_EEPROM_WRITE        (1)       /**< @brief Flag used to indicate whether the functions of the @ref mlx90614 that write into the EEPROM of the MLX90614 Device (i.e., the @ref MLX90614_EEPROM_Write state machine and all the setters that use it, such as @ref set_mlx90614_device_slave_address or @ref set_mlx90614_handle_iir ) will be compiled with a value of \c 1 , or not with a value of \c 0 , which is meant for products whose MLX90614 Devices are configured only once at production. */
+#endif
+#ifndef MLX90614_ENABLE_SCAN
+#define MLX90614_ENABLE_SCAN                (1)       /**< @brief Flag used to indicate whether the I2C bus scan of the @ref mlx90614 (i.e., @ref scan_mlx90614_bus and the @ref MLX90614_Scan_Result functions) will be compiled with a value of \c 1 , or not with a value of \c 0 . */
+#endif
+#ifndef MLX90614_ENABLE_BENCHMARK
+#define MLX90614_ENABLE_BENCHMARK           (0)       /**< @brief Flag used to indicate whether the on-target Benchmark of the @ref mlx90614 (i.e., @ref run_mlx90614_benchmark_case and @ref run_mlx90614_benchmark ) will be compiled with a value of \c 1 , or not with a value of \c 0 , which is meant for a dedicated benchmark firmware rather than for production. @note The Benchmark measures with @ref MLX90614_CYCLE_COUNTER , so it must be enabled in the same way as for @ref MLX90614_ENABLE_STATS . */
+#endif
+#ifndef MLX90614_BENCHMARK_CORE_CLOCK
+#define MLX90614_BENCHMARK_CORE_CLOCK       (SystemCoreClock) /**< @brief Frequency in Hertz at which @ref MLX90614_CYCLE_COUNTER counts, which is used by the Benchmark of the @ref mlx90614 to turn CPU cycles into samples per second. @note This must be redefined whenever @ref MLX90614_CYCLE_COUNTER is not the DWT Cycle Counter (e.g., to the counter clock of the hardware timer used instead). */
+#endif
+#ifndef MLX90614_BENCHMARK_SET_I2C_CLOCK
+#define MLX90614_BENCHMARK_SET_I2C_CLOCK(hi2c, clock_speed)    ((hi2c)->Init.ClockSpeed = (clock_speed)) /**< @brief Expression with which the Benchmark of the @ref mlx90614 sets the SMBus clock, in Hertz, of the given I2C Handle before re-initializing it via @ref HAL_I2C_Init , which by default is meant for the I2C Peripherals of the STM32F1, STM32F2, STM32F4 and STM32L1 series. @note The I2C Peripherals of the other series are configured via their \c Init.Timing member instead, in which case this can be defined before including this header file to the \c Timing value of each clock speed (e.g., as generated by the STM32CubeMX). */
+#endif
+#ifndef MLX90614_BENCHMARK_BATCH_SIZE
+#define MLX90614_BENCHMARK_BATCH_SIZE       (16)      /**< @brief Number of Raw Values converted by each iteration of the conversion cases of the Benchmark of the @ref mlx90614 (see @ref MLX90614_BENCHMARK_CONVERT_FLOAT ). */
+#endif
+#ifndef MLX90614_BENCHMARK_UART_TIMEOUT
+#define MLX90614_BENCHMARK_UART_TIMEOUT     (100)     /**< @brief Time in milliseconds that our MCU/MPU will wait for each line of the Benchmark report to be transmitted via the UART given to the @ref run_mlx90614_benchmark function. */
+#endif
+
+#endif /* MLX90614_IR_THERMOMETER_CONFIG_H_ */
+
+/** @} */
@@ -3,27 +3,183 @@
  */
 
 #include "mlx90614_ir_thermometer_driver.h"
+#if ((MLX90614_ENABLE_BENCHMARK) && defined(HAL_UART_MODULE_ENABLED))
+#include <stdio.h> // Library from which "snprintf" is located at.
+#endif
 
 #define MLX90614_RAM_OR_EEPROM_ADDRESS_SIZE			            (1)		/**< @brief	Size in bytes of any single RAM or EEPROM address that the manufacturer has implemented in the MLX90614 Infra Red Thermometer. */
 #define MLX90614_TA_RAM_ADDRESS			                        (0x06)	/**< @brief	RAM address that the manufacturer of the MLX90614 Infra Red Thermometer has designated for calling the \f$T_{A}\f$ Command. */
 #define MLX90614_TOBJ1_RAM_ADDRESS			                    (0x07)	/**< @brief	RAM address that the manufacturer of the MLX90614 Infra Red Thermometer has designated for calling the \f$T_{OBJ1}\f$ Command. */
 #define MLX90614_TOBJ2_RAM_ADDRESS			                    (0x08)	/**< @brief	RAM address that the manufacturer of the MLX90614 Infra Red Thermometer has designated for calling the \f$T_{OBJ2}\f$ Command. */
 #define MLX90614_TEMPERATURE_RESULT_SIZE	                    (2)		/**< @brief	Temperature data size in bytes from a single temperature reading that the MLX90614 Infra Red Thermometer can do. */
+#define MLX90614_TEMPERATURE_RESULT_WITH_PEC_SIZE	            (3)		/**< @brief	Data size in bytes from a single temperature reading that the MLX90614 Infra Red Thermometer can do, but including the PEC byte that it sends after the temperature data. */
 #define MLX90614_EEPROM_SLAVE_ADDRESS_SIZE                      (2)     /**< @brief MLX90614's Slave Address EEPROM value size in bytes, where the first byte (i.e., the LSB) is where the actual Slave Address is located at and where the second byte (i.e., the MSB) contains unknown data. @note I could not find anywhere in the documentation what the most significant byte stands for, but it is required in the process of changing the Slave Address in the EEPROM of the MLX90614 Device according to the <a href=https://github.com/melexis/i2c-stick/blob/main/i2c-stick-arduino/mlx90614_cmd.cpp#L456-L512>code provided to me by the Melexis team</a> via email after requesting them for help in knowing how to change the slave address of a MLX90614 Device. */
 #define MLX90614_I2C_WRITE_COMMAND_SIZE                         (4)     /**< @brief MLX90614's I2C Write command size. */
 #define MLX90614_SLAVE_ADDRESS_EEPROM_ADDRESS                   (0x2E)  /**< @brief	EEPROM address that the MLX90614 Infra Red Thermometer has designated for storing its designated Slave Address to which it will respond via the I2C Protocol. @note <i><b style="color:orange;"><u>IMPORTANT-INFORMATION</u>:</b><b>The actual MLX90614 datasheet does not mention what is the EEPROM address value of the MLX90614 Slave Device and the nearest thing it states is what they defined/called as "SMBus address" whose EEPROM Address value is \c 0x0E , but where it seems that, according to both several statements of the community and an actual Melexis team code that the author of the @ref mlx90614 library received via email from them, this address value is actually \c 0x2E .</b></i> */
+#define MLX90614_EEPROM_ACCESS_COMMAND                          (0x20)  /**< @brief	Command that, combined with an EEPROM address of the MLX90614 Infra Red Thermometer (i.e., \c 0x00 up to @ref MLX90614_MAX_EEPROM_ADDRESS ), requests to access that EEPROM address. */
+#define MLX90614_MAX_EEPROM_ADDRESS                             (0x1F)  /**< @brief	Maximum EEPROM address of the MLX90614 Infra Red Thermometer. */
+#define MLX90614_SLAVE_ADDRESS_EEPROM_MASK                      (0x00FF)/**< @brief	Bit mask of the actual Slave Address within the 2 bytes stored in the @ref MLX90614_SLAVE_ADDRESS_EEPROM_ADDRESS of the MLX90614 EEPROM (see @ref MLX90614_EEPROM_SLAVE_ADDRESS_SIZE ). */
+#define MLX90614_CONFIG_REGISTER1_EEPROM_ADDRESS                (0x25)  /**< @brief	EEPROM address that the MLX90614 Infra Red Thermometer has designated for its "ConfigRegister1" Register, already combined with the EEPROM Access Command (i.e., \c 0x20 ) as it is done with @ref MLX90614_SLAVE_ADDRESS_EEPROM_ADDRESS . */
+#define MLX90614_TO_MAX_EEPROM_ADDRESS                          (0x20)  /**< @brief	EEPROM address that the MLX90614 Infra Red Thermometer has designated for the \f$T_{O,MAX}\f$ of its PWM output, already combined with the EEPROM Access Command. */
+#define MLX90614_EMISSIVITY_EEPROM_ADDRESS                      (0x24)  /**< @brief	EEPROM address that the MLX90614 Infra Red Thermometer has designated for its Emissivity, already combined with the EEPROM Access Command. */
+#define MLX90614_EMISSIVITY_FULL_SCALE                          (65535) /**< @brief	Value of the Emissivity EEPROM cell of the MLX90614 Infra Red Thermometer that stands for an Emissivity of \c 1.0 . */
+#define MLX90614_MIN_EMISSIVITY                                 (0.1f)  /**< @brief	Minimum Emissivity that the MLX90614 Datasheet allows to be configured. */
+#define MLX90614_EMISSIVITY_COEFFICIENT_SHIFT                   (16)    /**< @brief	Number of fractional bits of the Q16 fixed-point Emissivity compensation coefficient of a @ref MLX90614_Handle . */
+#define MLX90614_EMISSIVITY_POWER_SHIFT                         (20)    /**< @brief	Number of least significant bits that are dropped from the fourth power of the Raw Values during an Emissivity compensation, which keeps its intermediate products within 64 bits. */
+#define MLX90614_SLEEP_COMMAND                                  (0xFF)  /**< @brief	Command that puts the MLX90614 Infra Red Thermometer into its Sleep Mode, which has to be followed by its PEC byte. */
+#define MLX90614_SLEEP_COMMAND_SIZE                             (2)     /**< @brief	Size in bytes of the Sleep command of the MLX90614 Infra Red Thermometer (i.e., the command and its PEC byte). */
+#define MLX90614_TO_MIN_EEPROM_ADDRESS                          (0x21)  /**< @brief	EEPROM address that the MLX90614 Infra Red Thermometer has designated for the \f$T_{O,MIN}\f$ of its PWM output, already combined with the EEPROM Access Command. */
+#define MLX90614_PWM_START_MARK_SHIFT                           (3)     /**< @brief	Right shift that gives the start mark of each PWM cycle of the MLX90614 Device out of its period (i.e., \f$t_{1} = \frac{T}{8}\f$ according to the MLX90614 Datasheet). */
+#define MLX90614_CONFIG_REGISTER1_IIR_POS                       (0)     /**< @brief	Position of the first bit of the IIR field in the "ConfigRegister1" Register of the MLX90614 Device. */
+#define MLX90614_CONFIG_REGISTER1_IIR_MASK                      (0x0007)/**< @brief	Bit mask of the IIR field in the "ConfigRegister1" Register of the MLX90614 Device. */
+#define MLX90614_CONFIG_REGISTER1_FIR_POS                       (8)     /**< @brief	Position of the first bit of the FIR field in the "ConfigRegister1" Register of the MLX90614 Device. */
+#define MLX90614_CONFIG_REGISTER1_FIR_MASK                      (0x0700)/**< @brief	Bit mask of the FIR field in the "ConfigRegister1" Register of the MLX90614 Device. */
+#define MLX90614_CONFIG_REGISTER1_GAIN_POS                      (11)    /**< @brief	Position of the first bit of the Gain field in the "ConfigRegister1" Register of the MLX90614 Device. */
+#define MLX90614_CONFIG_REGISTER1_GAIN_MASK                     (0x3800)/**< @brief	Bit mask of the Gain field in the "ConfigRegister1" Register of the MLX90614 Device. */
+#define MLX90614_FIR_1024_OUTPUT_PERIOD                         (100)   /**< @brief	Approximate time in milliseconds that the MLX90614 Device takes to produce a new output with a FIR Filter of \f$N=1024\f$ , which is used by the @ref get_mlx90614_settling_time function. */
 #define MLX90614_PEC_RESET_VALUE                   				(0x00)  /**< @brief	Value with which a new PEC byte to calculate should be defined/started with in order have a correct calculation by the @ref calculate_pec function. */
 #define MLX90614_SLAVE_ADDRESS_EEPROM_ERASE_VALUE               (0x00)  /**< @brief	Value used to erase the currently configured Slave Address in the MLX90614 EEPROM. @note This value is not mentioned anywhere in the MLX90614 Datasheet; I was able to determine it via a <a href=https://github.com/melexis/i2c-stick/blob/main/i2c-stick-arduino/mlx90614_cmd.cpp#L456-L512>code provided to me by the Melexis team</a> via email after requesting them for help in knowing how to change the slave address of a MLX90614 Device. */
 #define MLX90614_MAX_VALID_SLAVE_ADDRESS_VALUE                  (0X7E)  /**< @brief	Maximum valid slave address value that can be assigned to the MLX90614 Device. @note I got this value from a <a href=https://github.com/melexis/i2c-stick/blob/main/i2c-stick-arduino/mlx90614_cmd.cpp#L456-L512>code provided to me by the Melexis team</a> via email after requesting them for help in knowing how to change the slave address of a MLX90614 Device. */
 #define MLX90614_MAX_VALID_SLAVE_ADDRESS_VALUE_PLUS_ONE			(0X7F)  /**< @brief	Maximum valid slave address value, plus one, that can be assigned to the MLX90614 Device. @note I got this value from a <a href=https://github.com/melexis/i2c-stick/blob/main/i2c-stick-arduino/mlx90614_cmd.cpp#L456-L512>code provided to me by the Melexis team</a> via email after requesting them for help in knowing how to change the slave address of a MLX90614 Device. */
 #define MLX90614_MIN_VALID_SLAVE_ADDRESS_VALUE                  (0X03)  /**< @brief	Minimum valid slave address value that can be assigned to the MLX90614 Device. @note I got this value from a <a href=https://github.com/melexis/i2c-stick/blob/main/i2c-stick-arduino/mlx90614_cmd.cpp#L456-L512>code provided to me by the Melexis team</a> via email after requesting them for help in knowing how to change the slave address of a MLX90614 Device. */
 
-static I2C_HandleTypeDef *p_hi2c;                                                            /**< @brief Pointer to the I2C Handle Structure of the I2C that will be used in this @ref mlx90614 to send/receive instructions and/or data to the MLX90614 Infra Red Thermometer Module. @note This pointer's value is defined in the @ref init_mlx90614_module function. */
-static uint8_t mlx90614_slave_address = 0x5A;					                             /**< @brief Slave address of the MLX90614 Infra Red Thermometer device. @note The default slave address device of this Thermometer is 0x5A according to its datasheet. @note The value of this Global Variable is defined in the @ref init_mlx90614_module function but can be customized/changed in the @ref set_mlx90614_module_slave_address function. */
-static uint8_t mlx90614_slave_address_one_bit_left_shifted;                                  /**< @brief Slave address of a MLX90614 Infra Red Thermometer device, but shifted to the left by one bit. @note This Global Variable is updated each time the slave address of this device changes via the @ref set_mlx90614_module_slave_address function. */
-static MLX90614_Temp_t mlx90614_temperature_type;                                            /**< @brief Temperature Type with which the @ref mlx90614 will be currently responding whenever it is requested to give a temperature value. */
-static float (*p_get_mlx90614_converted_temperature)(uint16_t raw_temp);                     /**< @brief Pointer to the function that gets the corresponding current object1, object2 or ambient temperature with the latest configured Temperature Type. @note The value of this pointer is initialized with the @ref init_mlx90614_module function and can be updated with the @ref set_mlx90614_temperature_type function. @note According to the MLX90614 Infra Red Thermometer Datasheet, the formula for calculating either the Object1, Object2 or Ambient Temperatures are the same. */
+#define MLX90614_CENTI_KELVIN_PER_RAW_UNIT                      (2)     /**< @brief	Hundredths of Kelvin that each unit of an Object1/Object2/Ambient Temperature Raw Value stands for (i.e., its \f$0.02\f$ Kelvin resolution according to the MLX90614 Datasheet). */
+#define MLX90614_CENTI_CELSIUS_OFFSET_IN_CENTI_KELVIN           (27315) /**< @brief	Hundredths of Kelvin that stand for \f$0^{\circ}C\f$ . */
+#define MLX90614_CENTI_FAHRENHEIT_OFFSET                        (3200)  /**< @brief	Hundredths of Fahrenheit that stand for \f$0^{\circ}C\f$ . */
+#define MLX90614_RAW_ERROR_FLAG                                 (0x8000)/**< @brief	Bit of an Object1/Object2/Ambient Temperature Raw Value that the MLX90614 Device raises whenever that value is not valid. */
+#define MLX90614_I2C_READ_BIT                                   (0x01)  /**< @brief	Bit that is set in the slave address, shifted to the left by one bit, whenever the MCU/MPU requests to read data from a MLX90614 Device. @note This is used in the calculation of the PEC byte of the readings. */
+#define MLX90614_DEFAULT_SLAVE_ADDRESS                          (0x5A)  /**< @brief	Default slave address of the MLX90614 Infra Red Thermometer device according to its datasheet. */
 
+#define MLX90614_RING_BUFFER_INDEX_MASK                         (MLX90614_RING_BUFFER_CAPACITY - 1) /**< @brief	Bit mask that wraps the free-running indexes of a @ref MLX90614_Ring_Buffer into the indexes of its storage. */
+
+#if (MLX90614_ENABLE_STATS)
+#define MLX90614_STATS_BEGIN(start)             uint32_t start = MLX90614_CYCLE_COUNTER()                           /**< @brief	Declares a local variable with the given name that holds the CPU cycle count at which an instrumented operation started. */
+#define MLX90614_STATS_END(op, start)           record_mlx90614_cycles((op), MLX90614_CYCLE_COUNTER() - (start))    /**< @brief	Records the CPU cycles taken by an instrumented operation since its @ref MLX90614_STATS_BEGIN . */
+#define MLX90614_STATS_INCREMENT(counter)       (mlx90614_stats.counter++)                                          /**< @brief	Increments the given counter of @ref mlx90614_stats . */
+#else
+#define MLX90614_STATS_BEGIN(start)
+#define MLX90614_STATS_END(op, start)           ((void) 0)
+#define MLX90614_STATS_INCREMENT(counter)       ((void) 0)
+#endif
+
+#define MLX90614_LOG_MAGIC                                      (0x4D)  /**< @brief	Magic byte with which every Sample Log of a @ref MLX90614_Log_Writer starts (i.e., the ASCII 'M'). */
+#define MLX90614_LOG_VERSION                                    (1)     /**< @brief	Version of the Sample Log format written by a @ref MLX90614_Log_Writer . */
+#define MLX90614_LOG_KEYFRAME_SIZE                              (6)     /**< @brief	Size in bytes of the keyframe of a block of a Sample Log (i.e., three little endian Raw Values). */
+#define MLX90614_LOG_MAX_VARINT_SIZE                            (3)     /**< @brief	Maximum size in bytes of a zig-zag varint of a Sample Log, which is given by the 17 bits of the zig-zag encoding of a difference between two 15-bit Raw Values. */
+#define MLX90614_VARINT_MAX_SIZE                                (5)     /**< @brief	Maximum size in bytes of a zig-zag varint of any \c int32_t value, which is given by the 32 bits of its zig-zag encoding. */
+#define MLX90614_MULTI_BUS_MAX_LANE_HANDLES                     (32)    /**< @brief	Maximum number of @ref MLX90614_Handle that a @ref MLX90614_Bus_Lane can hold, which is given by the bits of its valid samples bitmask. */
+
+#if (MLX90614_ENABLE_BENCHMARK)
+#define MLX90614_BENCHMARK_FIRST_RAW_VALUE                      (0x3AF7)/**< @brief	Raw Value (i.e., about \f$28.8^{\circ}C\f$ ) from which the Raw Values converted by the conversion cases of the Benchmark start, which are then incremented by one per element. */
+#define MLX90614_BENCHMARK_NUMBER_OF_CLOCK_SPEEDS               (3)     /**< @brief	Number of SMBus clocks at which the @ref run_mlx90614_benchmark function runs every @ref MLX90614_Benchmark_Case . */
+#define MLX90614_BENCHMARK_LINE_SIZE                            (160)   /**< @brief	Size in bytes of the buffer into which each line of the Benchmark report is formatted. */
+#if (MLX90614_PEC_IMPLEMENTATION == MLX90614_PEC_BYTE_TABLE)
+#define MLX90614_BENCHMARK_PEC_NAME                             "byte_table"    /**< @brief	Name with which the Benchmark report tells the @ref MLX90614_PEC_IMPLEMENTATION of the build. */
+#elif (MLX90614_PEC_IMPLEMENTATION == MLX90614_PEC_NIBBLE_TABLE)
+#define MLX90614_BENCHMARK_PEC_NAME                             "nibble_table"  /**< @brief	Name with which the Benchmark report tells the @ref MLX90614_PEC_IMPLEMENTATION of the build. */
+#else
+#define MLX90614_BENCHMARK_PEC_NAME                             "bitwise"       /**< @brief	Name with which the Benchmark report tells the @ref MLX90614_PEC_IMPLEMENTATION of the build. */
+#endif
+#if (MLX90614_ASYNC_USE_DMA)
+#define MLX90614_BENCHMARK_ASYNC_NAME                           "dma"           /**< @brief	Name with which the Benchmark report tells the @ref MLX90614_ASYNC_USE_DMA Mode of the build. */
+#else
+#define MLX90614_BENCHMARK_ASYNC_NAME                           "it"            /**< @brief	Name with which the Benchmark report tells the @ref MLX90614_ASYNC_USE_DMA Mode of the build. */
+#endif
+#if (MLX90614_TRANSPORT == MLX90614_TRANSPORT_LL)
+#define MLX90614_BENCHMARK_TRANSPORT_NAME                       "ll"            /**< @brief	Name with which the Benchmark report tells the @ref MLX90614_TRANSPORT of the build. */
+#elif (MLX90614_TRANSPORT == MLX90614_TRANSPORT_CUSTOM)
+#define MLX90614_BENCHMARK_TRANSPORT_NAME                       "custom"        /**< @brief	Name with which the Benchmark report tells the @ref MLX90614_TRANSPORT of the build. */
+#else
+#define MLX90614_BENCHMARK_TRANSPORT_NAME                       "hal"           /**< @brief	Name with which the Benchmark report tells the @ref MLX90614_TRANSPORT of the build. */
+#endif
+#endif
+
+#if (MLX90614_TRANSPORT == MLX90614_TRANSPORT_HAL)
+#define MLX90614_TRANSPORT_READ(hi2c, slave_address_one_bit_left_shifted, command, dst, size, timeout)     HAL_I2C_Mem_Read((hi2c), (slave_address_one_bit_left_shifted), (command), MLX90614_RAM_OR_EEPROM_ADDRESS_SIZE, (dst), (size), (timeout)) /**< @brief	Makes a blocking reading of the given number of bytes of the given command from a MLX90614 Device via the chosen @ref MLX90614_TRANSPORT , giving back a @ref HAL_StatusTypeDef . */
+#elif (MLX90614_TRANSPORT == MLX90614_TRANSPORT_LL)
+#ifndef I2C_SR1_BTF
+#error "MLX90614_TRANSPORT_LL requires an I2C Peripheral with the SR1 and SR2 registers (i.e., STM32F1, STM32F2, STM32F4 or STM32L1)."
+#endif
+#define MLX90614_TRANSPORT_READ(hi2c, slave_address_one_bit_left_shifted, command, dst, size, timeout)     read_mlx90614_registers((hi2c), (slave_address_one_bit_left_shifted), (command), (dst), (size))
+#elif (MLX90614_TRANSPORT == MLX90614_TRANSPORT_CUSTOM)
+#define MLX90614_TRANSPORT_READ(hi2c, slave_address_one_bit_left_shifted, command, dst, size, timeout)     mlx90614_transport_read((hi2c), (slave_address_one_bit_left_shifted), (command), (dst), (size), (timeout))
+#else
+#error "MLX90614_TRANSPORT must be either MLX90614_TRANSPORT_HAL, MLX90614_TRANSPORT_LL or MLX90614_TRANSPORT_CUSTOM."
+#endif
+
+#if ((MLX90614_DEFAULT_ADDRESS_VALIDATION != MLX90614_ADDRESS_VALIDATION_PROBE) && (MLX90614_DEFAULT_ADDRESS_VALIDATION != MLX90614_ADDRESS_VALIDATION_LAZY))
+#error "MLX90614_DEFAULT_ADDRESS_VALIDATION must be either MLX90614_ADDRESS_VALIDATION_PROBE or MLX90614_ADDRESS_VALIDATION_LAZY."
+#endif
+
+#if (MLX90614_FIXED_UNIT == MLX90614_FIXED_UNIT_NONE)
+#define MLX90614_CONVERT_RAW_TEMPERATURE(p_converter, raw)      ((*(p_converter))(raw)) /**< @brief	Converts a Raw Value into a temperature value via the given conversion function, which is the one of the Temperature Type chosen at runtime. */
+#elif (MLX90614_FIXED_UNIT == 0)
+#define MLX90614_FIXED_UNIT_SCALE                               (0.02f)     /**< @brief	Kelvin that each unit of a Raw Value stands for. */
+#define MLX90614_FIXED_UNIT_OFFSET                              (0.0f)      /**< @brief	Kelvin that stand for a Raw Value of zero. */
+#elif (MLX90614_FIXED_UNIT == 1)
+#define MLX90614_FIXED_UNIT_SCALE                               (0.02f)     /**< @brief	Celsius that each unit of a Raw Value stands for. */
+#define MLX90614_FIXED_UNIT_OFFSET                              (-273.15f)  /**< @brief	Celsius that stand for a Raw Value of zero. */
+#elif (MLX90614_FIXED_UNIT == 2)
+#define MLX90614_FIXED_UNIT_SCALE                               (0.036f)    /**< @brief	Fahrenheit that each unit of a Raw Value stands for. */
+#define MLX90614_FIXED_UNIT_OFFSET                              (-459.67f)  /**< @brief	Fahrenheit that stand for a Raw Value of zero. */
+#else
+#error "MLX90614_FIXED_UNIT must be either MLX90614_FIXED_UNIT_NONE or one of the values of MLX90614_Temp_t."
+#endif
+#if (MLX90614_FIXED_UNIT != MLX90614_FIXED_UNIT_NONE)
+#define MLX90614_CONVERT_RAW_TEMPERATURE(p_converter, raw)      ((void) (p_converter), ((float) (raw))*MLX90614_FIXED_UNIT_SCALE + MLX90614_FIXED_UNIT_OFFSET) /**< @brief	Converts a Raw Value into a temperature value of the fixed Temperature Type (see @ref MLX90614_FIXED_UNIT ) with an inlined constant scale and offset, where the given conversion function is evaluated but not called. */
+#endif
+
+#if ((MLX90614_RING_BUFFER_CAPACITY & MLX90614_RING_BUFFER_INDEX_MASK) != 0)
+#error "MLX90614_RING_BUFFER_CAPACITY must be a power of two."
+#endif
+
+#if (MLX90614_PEC_IMPLEMENTATION == MLX90614_PEC_BYTE_TABLE)
+/**@brief   Lookup table of the CRC-8 (polynomial \f$x^{8}+x^{2}+x+1\f$ , i.e., \c 0x07 ) used to calculate the PEC byte of
+ *          the I2C transactions with an MLX90614 Device a whole byte at a time.
+ *
+ * @details Each element of this table contains the PEC value that results from calculating it, via the
+ *          bit-wise algorithm, with an initial PEC value of \c 0 and with its index as the new data.
+ */
+static const uint8_t mlx90614_pec_table[256] =
+{
+    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D,
+    0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D,
+    0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD,
+    0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD,
+    0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA,
+    0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
+    0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A,
+    0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A,
+    0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4,
+    0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4,
+    0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44,
+    0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
+    0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63,
+    0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13,
+    0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83,
+    0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3
+};
+#elif (MLX90614_PEC_IMPLEMENTATION == MLX90614_PEC_NIBBLE_TABLE)
+/**@brief   Lookup table of the CRC-8 (polynomial \f$x^{8}+x^{2}+x+1\f$ , i.e., \c 0x07 ) used to calculate the PEC byte of
+ *          the I2C transactions with an MLX90614 Device four bits at a time.
+ *
+ * @details Each element of this table contains the PEC value that results from processing, via the bit-wise
+ *          algorithm, the four most significant bits of its index shifted to the left by four bits.
+ */
+static const uint8_t mlx90614_pec_nibble_table[16] =
+{
+    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D
+};
+#endif
+
+static const uint8_t mlx90614_eeprom_shadow_commands[MLX90614_EEPROM_SHADOW_SIZE] = {MLX90614_CONFIG_REGISTER1_EEPROM_ADDRESS, MLX90614_SLAVE_ADDRESS_EEPROM_ADDRESS, MLX90614_TO_MAX_EEPROM_ADDRESS, MLX90614_TO_MIN_EEPROM_ADDRESS, MLX90614_EMISSIVITY_EEPROM_ADDRESS}; /**< @brief EEPROM addresses, already combined with the EEPROM Access Command, of each of the words of the EEPROM Shadow of a @ref MLX90614_Handle . */
+#if (MLX90614_ENABLE_STATS)
+static MLX90614_Stats mlx90614_stats;  /**< @brief Execution statistics recorded so far by the @ref mlx90614 . */
+#endif
+static MLX90614_Handle mlx90614_module_handle = {.slave_address = MLX90614_DEFAULT_SLAVE_ADDRESS};       /**< @brief Module Handle of the @ref mlx90614 , which is the @ref MLX90614_Handle used by all the functions of the @ref mlx90614 that do not receive a @ref MLX90614_Handle . @note This Handle is initialized via the @ref init_mlx90614_module function. */
+static MLX90614_Handle *p_mlx90614_async_handles[MLX90614_MAX_NUMBER_OF_ASYNC_I2C];                      /**< @brief Pointers to the @ref MLX90614_Handle that currently have an Asynchronous temperature reading in process, where there can only be one of them per I2C Peripheral. @note This is used by the @ref mlx90614_i2c_mem_rx_cplt_callback and @ref mlx90614_i2c_error_callback functions to identify the @ref MLX90614_Handle to which a concluded I2C transaction belongs to. @note A \c NULL value means that the corresponding slot is free. */
+
+#if ((MLX90614_FIXED_UNIT == MLX90614_FIXED_UNIT_NONE) || (MLX90614_FIXED_UNIT == 0))
 /**@brief	Gets the either the Object1, Object2 or Ambient Temperature in Kelvin units with respect to a given Decimal
  *          Value standing for an Object1/Object2/Ambient Temperature Raw Value read from the MLX90614 Infra Red
  *          Thermometer Device.
@@ -40,7 +196,9 @@ static float (*p_get_mlx90614_converted_temperature)(uint16_t raw_temp);
  * @date    June 21, 2024.
  */
 static float get_mlx90614_converted_temperature_in_kelvin(uint16_t raw_temp);
+#endif
 
+#if ((MLX90614_FIXED_UNIT == MLX90614_FIXED_UNIT_NONE) || (MLX90614_FIXED_UNIT == 1))
 /**@brief	Gets the either the Object1, Object2 or Ambient Temperature in Celsius units with respect to a given Decimal
  *          Value standing for an Object1/Object2/Ambient Temperature Raw Value read from the MLX90614 Infra Red
  *          Thermometer Device.
@@ -57,7 +215,9 @@ static float get_mlx90614_converted_temperature_in_kelvin(uint16_t raw_temp);
  * @date    June 21, 2024.
  */
 static float get_mlx90614_converted_temperature_in_celsius(uint16_t raw_temp);
+#endif
 
+#if ((MLX90614_FIXED_UNIT == MLX90614_FIXED_UNIT_NONE) || (MLX90614_FIXED_UNIT == 2))
 /**@brief	Gets the either the Object1, Object2 or Ambient Temperature in Fahrenheit units with respect to a given
  *          Decimal Value standing for an Object1/Object2/Ambient Temperature Raw Value read from the MLX90614 Infra Red
  *          Thermometer Device.
@@ -74,6 +234,7 @@ static float get_mlx90614_converted_temperature_in_celsius(uint16_t raw_temp);
  * @date    June 21, 2024.
  */
 static float get_mlx90614_converted_temperature_in_fahrenheit(uint16_t raw_temp);
+#endif
 
 /**@brief   Function that calculates the PEC byte for the I2C Transaction with an MLX90614 Device.
  *
@@ -93,6 +254,10 @@ static float get_mlx90614_converted_temperature_in_fahrenheit(uint16_t raw_temp)
  *          i.e., the last returned value of this iterative process is the final and definitive PEC byte for the
  *          corresponding data to be sent over the I2C.
  *
+ * @note    The original bit-wise algorithm of Melexis is only used if @ref MLX90614_PEC_IMPLEMENTATION is defined with
+ *          @ref MLX90614_PEC_BITWISE . Otherwise, the same result is obtained via either the @ref mlx90614_pec_table
+ *          or the @ref mlx90614_pec_nibble_table lookup tables.
+ *
  * @param init_pec   Either the initial or current value with which the PEC byte was last calculated with.
  * @param new_data   New data with which a new PEC byte value will be calculated.
  *
@@ -100,9 +265,543 @@ static float get_mlx90614_converted_temperature_in_fahrenheit(uint16_t raw_temp)
  *
  * @author	<a href=https://github.com/melexis/i2c-stick/blob/main/i2c-stick-arduino/mlx90614_smbus_driver.cpp#L92>Melexis</a>
  * @date    October 29, 2024 (Reference date from which the code was replicated).
+ * @date    LAST UPDATE: October 14, 2026.
  */
 static uint8_t calculate_pec(uint8_t init_pec, uint8_t new_data);
 
+/**@brief   Calculates the PEC byte that a MLX90614 Device should have sent at the end of a reading (i.e., of a "Read
+ *          Word" SMBus transaction).
+ *
+ * @details The PEC byte of a reading is calculated over the slave address with the write bit, the command (i.e., the
+ *          RAM or EEPROM address read), the slave address with the read bit, and the two data bytes received.
+ *
+ * @param[in] hmlx      Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the data was read.
+ * @param command       RAM or EEPROM address that was read from the MLX90614 Device.
+ * @param[in] i2cdata   Pointer to the two data bytes received, where the first one is the least significant byte.
+ *
+ * @return  The expected PEC byte of the reading.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static uint8_t calculate_mlx90614_read_pec(MLX90614_Handle *hmlx, uint8_t command, const uint8_t *i2cdata);
+
+/**@brief   Calculates the CRC-8 of the given bytes with the same algorithm of the PEC byte (see @ref calculate_pec ),
+ *          which is the one used by the Sample Logs of a @ref MLX90614_Log_Writer .
+ *
+ * @param[in] data  Pointer to the bytes whose CRC-8 is requested.
+ * @param n         Number of bytes of \p data .
+ *
+ * @return  The CRC-8 of the given bytes.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static uint8_t calculate_mlx90614_log_crc(const uint8_t *data, size_t n);
+
+/**@brief   Calculates the integer square root of the given value, rounded down.
+ *
+ * @param value     Value whose square root is requested.
+ *
+ * @return  The greatest integer whose square is not greater than \p value .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static uint32_t calculate_mlx90614_isqrt(uint64_t value);
+
+/**@brief   Writes the given signed difference between two Raw Values as a zig-zag encoded base-128 varint, where the
+ *          least significant groups of 7 bits are written first and where the most significant bit of each byte
+ *          indicates whether another byte follows.
+ *
+ * @param[out] dst  Pointer to the Memory Address into which the varint will be written, which must have at least
+ *                  @ref MLX90614_LOG_MAX_VARINT_SIZE free bytes if \p delta is a difference between two Raw Values,
+ *                  or @ref MLX90614_VARINT_MAX_SIZE free bytes otherwise.
+ * @param delta     Signed difference that wants to be written.
+ *
+ * @return  The number of bytes written.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static uint8_t write_mlx90614_log_varint(uint8_t *dst, int32_t delta);
+
+/**@brief   Reads a signed difference between two Raw Values that was written via @ref write_mlx90614_log_varint .
+ *
+ * @param[in] src       Pointer to the first byte of the varint.
+ * @param remaining     Number of bytes that can be read from \p src .
+ * @param[out] delta    Pointer to the Memory Address into which the signed difference read will be written.
+ *
+ * @return  The number of bytes read, or \c 0 if the varint is either truncated, longer than
+ *          @ref MLX90614_VARINT_MAX_SIZE or if it does not fit into an \c int32_t .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static uint8_t read_mlx90614_log_varint(const uint8_t *src, size_t remaining, int32_t *delta);
+
+/**@brief	Reads a 2-bytes word from either the RAM or EEPROM of the MLX90614 Device of the given
+ *          @ref MLX90614_Handle , while also validating its PEC byte if it is enabled in that Handle.
+ *
+ * @param[in] hmlx      Pointer to the @ref MLX90614_Handle of the MLX90614 Device that wants to be read.
+ * @param command       RAM or EEPROM address that wants to be read.
+ * @param[out] dst      Pointer to the Memory Address where this function will store the 2-bytes word read.
+ *
+ * @retval  MLX90614_EC_OK  If the word was successfully read (and its PEC byte successfully validated if enabled).
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the PEC validation failed or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static MLX90614_Status read_mlx90614_word(MLX90614_Handle *hmlx, uint8_t command, uint16_t *dst);
+
+/**@brief	Gets the function that converts a Raw Value into a temperature value of the given Temperature Type.
+ *
+ * @param temp_t    Temperature Type whose conversion function is requested.
+ *
+ * @return  Pointer to the corresponding conversion function, or \c NULL if the \p temp_t param has an invalid value.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static float (*get_mlx90614_temperature_converter(MLX90614_Temp_t temp_t))(uint16_t raw_temp);
+
+/**@brief	Reads the Raw Value of either the Object1, Object2 or Ambient Temperature from the MLX90614 Device of the
+ *          given @ref MLX90614_Handle and validates that the MLX90614 Device has not raised an Error Flag.
+ *
+ * @details If the Freshness Cache of the given @ref MLX90614_Handle holds a Raw Value of the requested temperature
+ *          within its Freshness Window, then that Raw Value is given back without any I2C transaction. Otherwise, the
+ *          Raw Value read is stored in that Freshness Cache.
+ *
+ * @param[in] hmlx      Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the temperature is
+ *                      requested.
+ * @param ram_address   MLX90614 RAM address of the temperature that wants to be read (i.e., either
+ *                      @ref MLX90614_TA_RAM_ADDRESS , @ref MLX90614_TOBJ1_RAM_ADDRESS or
+ *                      @ref MLX90614_TOBJ2_RAM_ADDRESS ).
+ * @param[out] dst      Pointer to the Memory Address where this function will store the Raw Value read.
+ *
+ * @retval  MLX90614_EC_OK  If the Raw Value was successfully read with no Error Flags raised by the MLX90614 Device.
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the MLX90614 Device raised an Error Flag or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static MLX90614_Status read_mlx90614_raw_temperature(MLX90614_Handle *hmlx, uint8_t ram_address, uint16_t *dst);
+
+/**@brief	Stores the given Raw Value in the Freshness Cache of the given @ref MLX90614_Handle , if enabled.
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of interest.
+ * @param channel       @ref MLX90614_Channel_t of the temperature channel from which the Raw Value was read.
+ * @param raw           Raw Value that wants to be stored, after having been filtered.
+ * @param timestamp     Value of @ref MLX90614_TIMESTAMP at the moment in which the Raw Value was received.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static void store_mlx90614_cached_raw_temperature(MLX90614_Handle *hmlx, uint8_t channel, uint16_t raw, uint32_t timestamp);
+
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+/**@brief	Sends a Write Command to the MLX90614 Device of the given @ref MLX90614_Handle , which includes its
+ *          corresponding PEC byte, in order to store a 16-bit value into the given EEPROM address.
+ *
+ * @param[in] hmlx      Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param command       EEPROM address, already combined with the EEPROM Access Command, into which the value will be
+ *                      written.
+ * @param value         16-bit value that will be written.
+ *
+ * @retval  MLX90614_EC_OK  If the Write Command was successfully sent.
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static MLX90614_Status send_mlx90614_write_command(MLX90614_Handle *hmlx, uint8_t command, uint16_t value);
+
+/**@brief	Prepares the given @ref MLX90614_EEPROM_Write so that its first stage gets executed on the next call to
+ *          the @ref pump_mlx90614_eeprom_write function.
+ *
+ * @param[out] job      Pointer to the @ref MLX90614_EEPROM_Write that wants to be prepared.
+ * @param[in] hmlx      Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param command       EEPROM address, already combined with the EEPROM Access Command, of interest.
+ * @param mask          Bit mask of the bits that want to be changed.
+ * @param value         New value of the bits of interest, already positioned according to \p mask .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static void prepare_mlx90614_eeprom_write(MLX90614_EEPROM_Write *job, MLX90614_Handle *hmlx, uint8_t command, uint16_t mask, uint16_t value);
+
+/**@brief	Checks whether the EEPROM cell being erased or written by the given @ref MLX90614_EEPROM_Write has
+ *          concluded such process.
+ *
+ * @details If the readback verification of \p job is enabled, then the EEPROM cell is read back, once at least
+ *          @ref MLX90614_EEPROM_CELL_MIN_TIME milliseconds have elapsed, until it holds the expected value or until
+ *          @ref MLX90614_ERASE_OR_WRITE_CELL_TIME milliseconds have elapsed. Otherwise, this function simply waits for
+ *          @ref MLX90614_ERASE_OR_WRITE_CELL_TIME milliseconds to elapse.
+ *
+ * @param[in] job       Pointer to the @ref MLX90614_EEPROM_Write of interest.
+ * @param expected      Value that the EEPROM cell must hold once the current process has concluded.
+ *
+ * @retval  MLX90614_EC_OK  If the current process of the EEPROM cell has concluded.
+ * @retval  MLX90614_EC_NA  If the current process of the EEPROM cell has not concluded yet.
+ * @retval  MLX90614_EC_ERR If the EEPROM cell did not hold the expected value within
+ *                          @ref MLX90614_ERASE_OR_WRITE_CELL_TIME milliseconds.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static MLX90614_Status poll_mlx90614_eeprom_cell(MLX90614_EEPROM_Write *job, uint16_t expected);
+
+/**@brief	Changes only the given bits of an EEPROM address of the MLX90614 Device of the given
+ *          @ref MLX90614_Handle , while keeping the rest of its bits unchanged, by pumping a
+ *          @ref MLX90614_EEPROM_Write with its readback verification enabled until it concludes.
+ *
+ * @note    If the bits of interest are already stored with the given value, then the EEPROM is not written at all.
+ *
+ * @param[in] hmlx      Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param command       EEPROM address, already combined with the EEPROM Access Command, of interest.
+ * @param mask          Bit mask of the bits that want to be changed.
+ * @param value         New value of the bits of interest, already positioned according to \p mask .
+ *
+ * @retval  MLX90614_EC_OK  If the bits of interest were successfully stored.
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the PEC validation failed or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static MLX90614_Status update_mlx90614_eeprom_bits(MLX90614_Handle *hmlx, uint8_t command, uint16_t mask, uint16_t value);
+#endif
+
+/**@brief	Gets the index of the word of the EEPROM Shadow of a @ref MLX90614_Handle that holds the copy of the
+ *          given EEPROM address.
+ *
+ * @param command   EEPROM address, already combined with the EEPROM Access Command, of interest.
+ *
+ * @return  The index of the word of the EEPROM Shadow, or @ref MLX90614_EEPROM_SHADOW_SIZE if the given EEPROM address
+ *          is not held by the EEPROM Shadow.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static uint8_t get_mlx90614_eeprom_shadow_index(uint8_t command);
+
+/**@brief	Updates the copy of the given EEPROM address in the EEPROM Shadow of the given @ref MLX90614_Handle , if
+ *          that Handle has its EEPROM Shadow enabled and if that EEPROM Shadow holds the given EEPROM address.
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of interest.
+ * @param command       EEPROM address, already combined with the EEPROM Access Command, of interest.
+ * @param value         Value currently stored in the given EEPROM address.
+ * @param is_valid      \c 1 if \p value is to be stored in the EEPROM Shadow or \c 0 if the copy of the given EEPROM
+ *                      address is to be invalidated instead.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static void update_mlx90614_eeprom_shadow(MLX90614_Handle *hmlx, uint8_t command, uint16_t value, uint8_t is_valid);
+
+/**@brief	Reads a word from an EEPROM address of the MLX90614 Device of the given @ref MLX90614_Handle , which is
+ *          served from its EEPROM Shadow whenever it holds a valid copy of it.
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device of interest.
+ * @param command       EEPROM address, already combined with the EEPROM Access Command, of interest.
+ * @param[out] dst      Pointer to the Memory Address where this function will store the word read.
+ *
+ * @retval  MLX90614_EC_OK  If the word was successfully read and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the PEC validation failed or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static MLX90614_Status read_mlx90614_eeprom_word(MLX90614_Handle *hmlx, uint8_t command, uint16_t *dst);
+
+/**@brief	Reads a temperature channel from the MLX90614 Device of the given @ref MLX90614_Handle and converts it into
+ *          hundredths of the units of the Temperature Type of that Handle via integer arithmetic.
+ *
+ * @param[in] hmlx      Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the temperature is
+ *                      requested.
+ * @param channel       Temperature channel that wants to be read.
+ * @param[out] dst      Pointer to the Memory Address where this function will store the converted temperature value.
+ *
+ * @retval  MLX90614_EC_OK  If the temperature was successfully read, converted and stored into \p dst .
+ * @retval  MLX90614_EC_NR  If the MLX90614 Device did not respond.
+ * @retval  MLX90614_EC_ERR If either the MLX90614 Device raised an Error Flag, if the PEC validation failed or if
+ *                          anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static MLX90614_Status get_mlx90614_handle_channel_centi_temperature(MLX90614_Handle *hmlx, MLX90614_Channel_t channel, int32_t *dst);
+
+/**@brief	Converts the Raw Values of all the temperature channels of the given @ref MLX90614_Sample into the units of
+ *          the Temperature Type of the given @ref MLX90614_Handle , after having compensated its Object Temperature
+ *          Raw Values with the Emissivity compensation coefficient of that Handle, if it is enabled.
+ *
+ * @param[in] hmlx          Pointer to the @ref MLX90614_Handle whose Temperature Type will be used.
+ * @param[in,out] sample    Pointer to the @ref MLX90614_Sample whose Raw Values will be converted.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static void convert_mlx90614_sample(MLX90614_Handle *hmlx, MLX90614_Sample *sample);
+
+/**@brief	Gets the @ref MLX90614_Handle that currently has an Asynchronous temperature reading in process in the
+ *          given I2C Peripheral.
+ *
+ * @param[in] hi2c      Pointer to the I2C Handle Structure whose I2C transaction has concluded.
+ * @param[out] slot     Pointer to the Memory Address where this function will store the index of the slot of
+ *                      @ref p_mlx90614_async_handles that the returned @ref MLX90614_Handle occupies.
+ *
+ * @return  Pointer to the corresponding @ref MLX90614_Handle , or \c NULL if there is none.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static MLX90614_Handle *find_mlx90614_async_handle(I2C_HandleTypeDef *hi2c, uint8_t *slot);
+
+/**@brief	Finds a free slot in @ref p_mlx90614_async_handles and assigns it to the given @ref MLX90614_Handle , as long
+ *          as there is no other Asynchronous temperature reading in process in the I2C of that Handle.
+ *
+ * @note    This is done with the interrupts masked, since the slots can also be claimed from Interrupt context.
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle that wants to start an Asynchronous temperature reading.
+ *
+ * @return  The index of the assigned slot, or @ref MLX90614_MAX_NUMBER_OF_ASYNC_I2C if it could not be assigned.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static uint8_t claim_mlx90614_async_slot(MLX90614_Handle *hmlx);
+
+/**@brief	Starts the I2C transaction, in either DMA or Interrupt Mode, for reading the temperature channel at the given
+ *          RAM address of the MLX90614 Device of the given @ref MLX90614_Handle .
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle whose Asynchronous reading is in process.
+ * @param ram_address   MLX90614 RAM address of the temperature that wants to be read.
+ *
+ * @retval  MLX90614_EC_OK  If the I2C transaction was successfully started.
+ * @retval  MLX90614_EC_NR  If the I2C Peripheral is currently busy.
+ * @retval  MLX90614_EC_ERR If the I2C transaction could not be started due to any other reason.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static MLX90614_Status issue_mlx90614_async_reading(MLX90614_Handle *hmlx, uint8_t ram_address);
+
+/**@brief	Concludes the Asynchronous reading in process of the given @ref MLX90614_Handle by releasing its slot in
+ *          @ref p_mlx90614_async_handles , by updating its state and by calling its corresponding callback (if any).
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle whose Asynchronous reading has concluded.
+ * @param slot          Index of the slot of @ref p_mlx90614_async_handles that \p hmlx occupies.
+ * @param status        @ref MLX90614_Status Exception Code with which the Asynchronous reading has concluded.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static void conclude_mlx90614_async_reading(MLX90614_Handle *hmlx, uint8_t slot, MLX90614_Status status);
+
+/**@brief	Aborts the Asynchronous reading in process, if any, of the given @ref MLX90614_Handle by aborting its I2C
+ *          transaction via @ref HAL_I2C_Master_Abort_IT and by releasing its slot in @ref p_mlx90614_async_handles ,
+ *          which leaves that Handle in the @ref MLX90614_ASYNC_ERR state with a @ref MLX90614_EC_NR Exception Code.
+ *
+ * @note    No callback is called for the aborted reading, since the sample that it was filling is incomplete.
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle whose Asynchronous reading wants to be aborted.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static void abort_mlx90614_async_reading(MLX90614_Handle *hmlx);
+
+/**@brief	Starts an Asynchronous temperature reading via the I2C Peripheral of the given @ref MLX90614_Handle .
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of the MLX90614 Device from which the temperature is
+ *                      requested.
+ * @param channel       Temperature channel that wants to be read.
+ * @param callback      Pointer to the function that will be called whenever the requested reading concludes, or
+ *                      \c NULL if none is desired.
+ *
+ * @retval  MLX90614_EC_OK  If the I2C transaction was successfully started.
+ * @retval  MLX90614_EC_NR  If either another Asynchronous temperature reading is still in process in the I2C of
+ *                          \p hmlx or if that I2C Peripheral is currently busy.
+ * @retval  MLX90614_EC_ERR If the I2C transaction could not be started due to any other reason.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static MLX90614_Status start_mlx90614_async_temperature_reading(MLX90614_Handle *hmlx, MLX90614_Channel_t channel, MLX90614_Async_Callback callback);
+
+/**@brief	Decides whether a failed I2C transaction will be retried according to the given
+ *          @ref MLX90614_Retry_Policy and, if so, waits for its corresponding backoff.
+ *
+ * @param[in] policy    Pointer to the @ref MLX90614_Retry_Policy of interest.
+ * @param attempt       Number of the attempt that has just failed, starting from \c 0 .
+ *
+ * @retval  1   If the I2C transaction has to be retried, in which case its backoff has already been waited.
+ * @retval  0   If the I2C transaction must not be retried.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static uint8_t wait_mlx90614_retry(const MLX90614_Retry_Policy *policy, uint8_t attempt);
+
+/**@brief	Waits for half of the period of the clock pulses generated by the @ref recover_mlx90614_i2c_bus
+ *          function (see @ref MLX90614_BUS_RECOVERY_DELAY_LOOPS ).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static void wait_mlx90614_bus_recovery_half_period(void);
+
+/**@brief	Takes the pins of the given I2C Peripheral away from it by de-initializing it and then drives them as
+ *          open-drain GPIOs that are released (i.e., high).
+ *
+ * @param[in,out] hi2c  Pointer to the I2C Handle Structure of the I2C Peripheral of interest.
+ * @param[in] pins      Pointer to the @ref MLX90614_Bus_Recovery pins of \p hi2c .
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static void take_mlx90614_bus_pins(I2C_HandleTypeDef *hi2c, const MLX90614_Bus_Recovery *pins);
+
+/**@brief	Gives the pins of the given I2C Peripheral back to it after @ref take_mlx90614_bus_pins , by having
+ *          reset it via its Software Reset bit (if it has one) and then initialized again via @ref HAL_I2C_Init .
+ *
+ * @param[in,out] hi2c  Pointer to the I2C Handle Structure of the I2C Peripheral of interest.
+ * @param[in] pins      Pointer to the @ref MLX90614_Bus_Recovery pins of \p hi2c .
+ *
+ * @return  The value given back by @ref HAL_I2C_Init .
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static HAL_StatusTypeDef give_back_mlx90614_bus_pins(I2C_HandleTypeDef *hi2c, const MLX90614_Bus_Recovery *pins);
+
+/**@brief	Starts the wake up pulse of a MLX90614 Device in its Sleep Mode by taking the pins of the given I2C
+ *          Peripheral away from it (if they were not already) and then holding SDA low with SCL high.
+ *
+ * @param[in,out] hi2c  Pointer to the I2C Handle Structure of the I2C Peripheral of the MLX90614 Device.
+ * @param[in] pins      Pointer to the @ref MLX90614_Bus_Recovery pins of \p hi2c .
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static void begin_mlx90614_wake_pulse(I2C_HandleTypeDef *hi2c, const MLX90614_Bus_Recovery *pins);
+
+/**@brief	Ends the wake up pulse started by @ref begin_mlx90614_wake_pulse by releasing SDA, and then gives the pins
+ *          back to the given I2C Peripheral (see @ref give_back_mlx90614_bus_pins ).
+ *
+ * @param[in,out] hi2c  Pointer to the I2C Handle Structure of the I2C Peripheral of the MLX90614 Device.
+ * @param[in] pins      Pointer to the @ref MLX90614_Bus_Recovery pins of \p hi2c .
+ *
+ * @retval  MLX90614_EC_OK  If the I2C Peripheral was successfully initialized again.
+ * @retval  MLX90614_EC_ERR If the I2C Peripheral could not be initialized again.
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static MLX90614_Status end_mlx90614_wake_pulse(I2C_HandleTypeDef *hi2c, const MLX90614_Bus_Recovery *pins);
+
+/**@brief	Recovers the I2C bus of the given @ref MLX90614_Handle via the @ref recover_mlx90614_i2c_bus function,
+ *          but only if its automatic recovery is enabled (see @ref set_mlx90614_handle_bus_recovery ) and if that I2C
+ *          bus is actually stuck rather than in use (i.e., a ready I2C Peripheral without any Asynchronous reading in
+ *          process whose SDA is being held low).
+ *
+ * @param[in] hmlx  Pointer to the @ref MLX90614_Handle whose blocking I2C transaction was rejected with @ref HAL_BUSY .
+ *
+ * @retval  1   If the I2C bus was recovered, in which case the failed transaction has to be retried once.
+ * @retval  0   If the automatic recovery is disabled, if the I2C bus is not stuck or if it could not be recovered.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static uint8_t try_mlx90614_bus_recovery(MLX90614_Handle *hmlx);
+
+/**@brief	Checks whether a device responds to the given slave address via the given I2C Peripheral.
+ *
+ * @param[in] hi2c                      Pointer to the I2C Handle Structure of the I2C Peripheral of interest.
+ * @param slave_address_one_bit_left_shifted    Slave address of interest, but shifted to the left by one bit.
+ * @param timeout                       Time in milliseconds that will be waited for the device to respond.
+ *
+ * @return  The value given back by @ref HAL_I2C_IsDeviceReady .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static HAL_StatusTypeDef probe_mlx90614_slave_address(I2C_HandleTypeDef *hi2c, uint8_t slave_address_one_bit_left_shifted, uint32_t timeout);
+
+#if (MLX90614_ENABLE_STATS)
+/**@brief	Records the CPU cycles taken by an execution of an instrumented operation into @ref mlx90614_stats .
+ *
+ * @param op        Instrumented operation that was executed.
+ * @param cycles    CPU cycles that the execution took.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static void record_mlx90614_cycles(MLX90614_Stats_Op op, uint32_t cycles);
+#endif
+
+#if (MLX90614_ENABLE_RTOS)
+/**@brief	@ref MLX90614_RTOS_Operation that reads all the temperature channels of the given
+ *          @ref MLX90614_Handle via the @ref get_mlx90614_handle_all_temperatures function.
+ *
+ * @param[in,out] hmlx  Pointer to the @ref MLX90614_Handle of interest.
+ * @param[out] arg      Pointer to the @ref MLX90614_Sample into which the temperatures will be stored.
+ *
+ * @return  The @ref MLX90614_Status Exception Code given back by @ref get_mlx90614_handle_all_temperatures .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static MLX90614_Status get_mlx90614_rtos_all_temperatures_operation(MLX90614_Handle *hmlx, void *arg);
+#endif
+
+#if (MLX90614_ENABLE_BENCHMARK)
+/**@brief	Waits until the Asynchronous reading in process of the given @ref MLX90614_Handle concludes.
+ *
+ * @param[in] hmlx          Pointer to the @ref MLX90614_Handle whose Asynchronous reading is in process.
+ * @param transactions      Number of I2C transactions of that Asynchronous reading, each of which is given the timeout
+ *                          of the @ref MLX90614_Retry_Policy of \p hmlx to conclude.
+ *
+ * @retval  MLX90614_EC_OK  If the Asynchronous reading concluded, either successfully or not.
+ * @retval  MLX90614_EC_ERR If the Asynchronous reading did not conclude in time, in which case it is aborted.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static MLX90614_Status wait_mlx90614_benchmark_async_reading(MLX90614_Handle *hmlx, uint32_t transactions);
+
+#ifdef HAL_UART_MODULE_ENABLED
+/**@brief	Gets the name with which the given @ref MLX90614_Benchmark_Case is reported by the
+ *          @ref run_mlx90614_benchmark function.
+ *
+ * @param bench_case    @ref MLX90614_Benchmark_Case of interest.
+ *
+ * @return  A constant string with the name of \p bench_case .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static const char *get_mlx90614_benchmark_case_name(MLX90614_Benchmark_Case bench_case);
+
+/**@brief	Transmits a line of the Benchmark report, already formatted via \c snprintf , via the given UART.
+ *
+ * @param[in] huart     Pointer to the UART Handle Structure of the UART via which the line will be transmitted.
+ * @param[in] line      Pointer to the formatted line.
+ * @param length        Value given back by \c snprintf when formatting \p line .
+ *
+ * @retval  MLX90614_EC_OK  If the line was transmitted.
+ * @retval  MLX90614_EC_ERR If either the line did not fit into @ref MLX90614_BENCHMARK_LINE_SIZE or if the UART
+ *                          could not transmit it.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static MLX90614_Status transmit_mlx90614_benchmark_line(UART_HandleTypeDef *huart, const char *line, int length);
+#endif
+#endif
+
 /**@brief	Gets the corresponding @ref MLX90614_Status value depending on the given @ref HAL_StatusTypeDef value.
  *
  * @param HAL_status	HAL Status value (see @ref HAL_StatusTypeDef ) that wants to be converted into its equivalent
@@ -119,324 +818,3634 @@ static uint8_t calculate_pec(uint8_t init_pec, uint8_t new_data);
  */
 static MLX90614_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status);
 
-MLX90614_Status init_mlx90614_module(I2C_HandleTypeDef *hi2c, uint8_t slave_address, MLX90614_Temp_t temp_t)
+#if (MLX90614_TRANSPORT == MLX90614_TRANSPORT_LL)
+/**@brief	Waits, for up to @ref MLX90614_LL_POLL_LIMIT polls, until the given flag of the \c SR1 register of the given
+ *          I2C Peripheral is set.
+ *
+ * @param[in] i2c   Pointer to the registers of the I2C Peripheral of interest.
+ * @param flag      Bit mask of the \c SR1 flag that wants to be waited for.
+ *
+ * @retval  HAL_OK      If the flag was set.
+ * @retval  HAL_ERROR   If the slave device did not acknowledge (i.e., the \c AF flag was set).
+ * @retval  HAL_TIMEOUT If the flag was not set within @ref MLX90614_LL_POLL_LIMIT polls.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static HAL_StatusTypeDef wait_mlx90614_register_flag(I2C_TypeDef *i2c, uint32_t flag);
+
+/**@brief	Aborts an I2C transaction of the @ref MLX90614_TRANSPORT_LL Transport by generating a STOP condition on the
+ *          I2C Peripheral of the given I2C Handle, which is then given back to the HAL in the
+ *          @ref HAL_I2C_STATE_READY state.
+ *
+ * @param[in,out] hi2c  Pointer to the I2C Handle of the I2C Peripheral of interest.
+ * @param status        @ref HAL_StatusTypeDef of the flag wait that failed, where a @ref HAL_ERROR (i.e., a NACK)
+ *                      also clears the \c AF flag and records @ref HAL_I2C_ERROR_AF in the I2C Handle.
+ *
+ * @return  The given \p status .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static HAL_StatusTypeDef abort_mlx90614_registers_read(I2C_HandleTypeDef *hi2c, HAL_StatusTypeDef status);
+
+/**@brief	Reads the given command of a MLX90614 Device by directly driving the registers of the I2C Peripheral of the
+ *          given I2C Handle, which is the @ref MLX90614_TRANSPORT_LL Transport.
+ *
+ * @details This follows the master receiver procedures of the Reference Manual of the STM32F1 series for 2 and 3 bytes
+ *          receptions, where the 2 bytes one uses the \c POS bit so that the NACK is given to the last byte right
+ *          away, and where the 3 bytes one (i.e., with the PEC byte) reads the first byte while the last two are
+ *          being held via the \c BTF flag.
+ *
+ * @note    The reading is refused with @ref HAL_BUSY if the HAL is using that I2C Peripheral (e.g., for an Asynchronous
+ *          reading) or if the I2C bus is busy. Otherwise, the I2C Handle is kept in the @ref HAL_I2C_STATE_BUSY_RX
+ *          state until the reading concludes, so that any transaction of the HAL requested meanwhile (e.g., from
+ *          Interrupt context) is the one refused with @ref HAL_BUSY instead of driving the same registers too. That
+ *          is, both of them never overlap on the same I2C Peripheral, but each one can fail while the other is in
+ *          process.
+ *
+ * @param[in,out] hi2c                      Pointer to the I2C Handle of the I2C Peripheral to be used.
+ * @param slave_address_one_bit_left_shifted Slave address of the MLX90614 Device, shifted to the left by one bit.
+ * @param command                           RAM or EEPROM command that wants to be read.
+ * @param[out] dst                          Pointer to the Memory Address where the bytes read will be stored.
+ * @param size                              Number of bytes to read, which can be either
+ *                                          @ref MLX90614_TEMPERATURE_RESULT_SIZE or
+ *                                          @ref MLX90614_TEMPERATURE_RESULT_WITH_PEC_SIZE .
+ *
+ * @retval  HAL_OK      If the bytes were read successfully.
+ * @retval  HAL_BUSY    If either the HAL is using the I2C Peripheral or the I2C bus is busy.
+ * @retval  HAL_ERROR   If the MLX90614 Device did not acknowledge, in which case @ref HAL_I2C_ERROR_AF is also set in
+ *                      the I2C Handle.
+ * @retval  HAL_TIMEOUT If the I2C Peripheral did not progress within @ref MLX90614_LL_POLL_LIMIT polls.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+static HAL_StatusTypeDef read_mlx90614_registers(I2C_HandleTypeDef *hi2c, uint8_t slave_address_one_bit_left_shifted, uint8_t command, uint8_t *dst, uint16_t size);
+#endif
+
+MLX90614_Status init_mlx90614_module(I2C_HandleTypeDef *hi2c, uint8_t slave_address, MLX90614_Temp_t temp_t)
+{
+    /** <b>Local uint8_t variable previous_slave_address:</b> Slave address that the Module Handle had before this initialization. */
+    uint8_t previous_slave_address = mlx90614_module_handle.slave_address;
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = init_mlx90614_handle(&mlx90614_module_handle, hi2c, slave_address, temp_t);
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+
+    /* NOTE: A slave address of 0 keeps the one that was configured in the Module Handle (i.e., 0x5A by default). */
+    if (slave_address == 0)
+    {
+        mlx90614_module_handle.slave_address = previous_slave_address;
+        mlx90614_module_handle.slave_address_one_bit_left_shifted = previous_slave_address << 1;
+    }
+
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Handle *get_mlx90614_module_handle(void)
+{
+    return &mlx90614_module_handle;
+}
+
+MLX90614_Status init_mlx90614_handle(MLX90614_Handle *hmlx, I2C_HandleTypeDef *hi2c, uint8_t slave_address, MLX90614_Temp_t temp_t)
+{
+    /* Validate the given slave address to have a valid value. */
+    if ((slave_address > MLX90614_MAX_VALID_SLAVE_ADDRESS_VALUE) || ((slave_address != 0) && (slave_address < MLX90614_MIN_VALID_SLAVE_ADDRESS_VALUE)))
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    /* Validate the requested Temperature Type. */
+    /** <b>Local pointer p_converter:</b> Points to the conversion function of the requested Temperature Type. */
+    float (*p_converter)(uint16_t raw_temp) = get_mlx90614_temperature_converter(temp_t);
+    if (p_converter == NULL)
+    {
+        return MLX90614_EC_ERR; // The requested temperature value type is not recognized. Therefore, send Error Exception Code.
+    }
+
+    /* Validate that the MLX90614 Device is ready for I2C Communication, but only if a custom slave address was given and unless its validation is deferred to the first successful reading. */
+    /** <b>Local uint8_t variable is_verified:</b> Flag indicating whether the MLX90614 Device has been confirmed to respond under the given slave address. */
+    uint8_t is_verified = 0;
+    if (slave_address != 0)
+    {
+#if (MLX90614_DEFAULT_ADDRESS_VALIDATION == MLX90614_ADDRESS_VALIDATION_PROBE)
+        if (probe_mlx90614_slave_address(hi2c, slave_address << 1, MLX90614_I2C_TIMEOUT) != HAL_OK)
+        {
+            return MLX90614_EC_NR;
+        }
+        is_verified = 1;
+#endif
+    }
+    else
+    {
+        slave_address = MLX90614_DEFAULT_SLAVE_ADDRESS;
+    }
+
+    /* Persist the configurations in the given MLX90614 Handle. */
+    hmlx->hi2c = hi2c;
+    hmlx->slave_address = slave_address;
+    hmlx->slave_address_one_bit_left_shifted = slave_address << 1;
+    hmlx->temperature_type = temp_t;
+    hmlx->p_get_converted_temperature = p_converter;
+    hmlx->async_state = MLX90614_ASYNC_IDLE;
+    hmlx->async_status = MLX90614_EC_OK;
+    hmlx->async_temperature = 0;
+    hmlx->async_raw = 0;
+    hmlx->p_async_callback = NULL;
+    hmlx->p_async_sample = NULL;
+    hmlx->p_async_sample_callback = NULL;
+    hmlx->async_channel = MLX90614_Ch_Ta;
+    hmlx->is_pec_check_enabled = 0;
+    hmlx->eeprom_shadow_valid = 0;
+    hmlx->is_eeprom_shadow_enabled = 0;
+    for (uint8_t i=0; i<MLX90614_NUMBER_OF_CHANNELS; i++)
+    {
+        hmlx->p_filter[i] = NULL;
+    }
+    hmlx->p_ring_buffer = NULL;
+    hmlx->p_event_detector = NULL;
+    hmlx->emissivity_coefficient = 0;
+    hmlx->freshness_window = MLX90614_DEFAULT_FRESHNESS_WINDOW;
+    hmlx->cache_valid = 0;
+    hmlx->address_validation = MLX90614_DEFAULT_ADDRESS_VALIDATION;
+    hmlx->is_slave_address_verified = is_verified;
+#if (MLX90614_ENABLE_SCAN)
+    hmlx->p_address_scan = NULL;
+#endif
+    hmlx->retry_policy.timeout_ms = MLX90614_I2C_TIMEOUT;
+    hmlx->retry_policy.retries = MLX90614_DEFAULT_RETRIES;
+    hmlx->retry_policy.backoff_ms = MLX90614_DEFAULT_BACKOFF;
+    hmlx->retry_policy.max_backoff_ms = MLX90614_DEFAULT_MAX_BACKOFF;
+    hmlx->retry_policy.is_fail_fast = 0;
+    hmlx->p_bus_recovery = NULL;
+
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Status find_mlx90614_slave_address(void)
+{
+    return find_mlx90614_handle_slave_address(&mlx90614_module_handle);
+}
+
+MLX90614_Status find_mlx90614_handle_slave_address(MLX90614_Handle *hmlx)
+{
+    /** <b>Local uint8_t variable current_slave_address:</b> Contains the current slave address with which it is being attempted to get a response from a MLX90614 device. */
+    uint8_t current_slave_address = MLX90614_MIN_VALID_SLAVE_ADDRESS_VALUE;
+    /** <b>Local uint8_t variable current_slave_address_one_bit_left_shifted:</b> Contains the current slave address with which it is being attempted to get a response from a MLX90614 device, but with one bit left shift. */
+    uint8_t current_slave_address_one_bit_left_shifted;
+
+    /*
+     NOTE:  We do not start from slave address 0, because that value will make @ref HAL_I2C_IsDeviceReady function to
+            give back @ref HAL_OK as long as a single I2C device responds to the I2C protocol on the specified I2C pins
+            of the MCU via the I2C of the given MLX90614 Handle, which will not allow us to identify the currently
+            stored slave address of our actual I2C device.
+     */
+    /* NOTE: The retries of the Retry Policy are applied to whole sweeps of the slave addresses, since retrying each one of them would multiply the time required to sweep those that have no device at all. */
+    for (uint8_t attempt=0; ; attempt++)
+    {
+        for (current_slave_address=MLX90614_MIN_VALID_SLAVE_ADDRESS_VALUE; current_slave_address<MLX90614_MAX_VALID_SLAVE_ADDRESS_VALUE_PLUS_ONE; current_slave_address++)
+        {
+            current_slave_address_one_bit_left_shifted = current_slave_address<<1;
+            if (probe_mlx90614_slave_address(hmlx->hi2c, current_slave_address_one_bit_left_shifted, hmlx->retry_policy.timeout_ms) == HAL_OK)
+            {
+                hmlx->slave_address = current_slave_address;
+                hmlx->slave_address_one_bit_left_shifted = current_slave_address_one_bit_left_shifted;
+                hmlx->is_slave_address_verified = 1; // The MLX90614 Device has just acknowledged it.
+                hmlx->cache_valid = 0;
+                hmlx->eeprom_shadow_valid = 0; // The EEPROM Shadow may hold the words of another MLX90614 Device.
+                return MLX90614_EC_OK;
+            }
+        }
+        if (!wait_mlx90614_retry(&hmlx->retry_policy, attempt))
+        {
+            return MLX90614_EC_NR;
+        }
+    }
+}
+
+#if (MLX90614_ENABLE_SCAN)
+MLX90614_Status scan_mlx90614_bus(I2C_HandleTypeDef *hi2c, MLX90614_Scan_Result *dst, uint32_t probe_timeout_ms, uint8_t is_rescan_forced)
+{
+    if (dst->is_valid && !is_rescan_forced)
+    {
+        return (dst->count > 0) ? MLX90614_EC_OK : MLX90614_EC_NR;
+    }
+
+    dst->is_valid = 0;
+    dst->count = 0;
+    for (uint8_t i=0; i<MLX90614_SCAN_BITMAP_WORDS; i++)
+    {
+        dst->bitmap[i] = 0;
+    }
+    // NOTE: Slave address 0 is not probed for the same reasons given in @ref find_mlx90614_handle_slave_address .
+    for (uint8_t current_slave_address=MLX90614_MIN_VALID_SLAVE_ADDRESS_VALUE; current_slave_address<MLX90614_MAX_VALID_SLAVE_ADDRESS_VALUE_PLUS_ONE; current_slave_address++)
+    {
+        if (probe_mlx90614_slave_address(hi2c, current_slave_address<<1, probe_timeout_ms) == HAL_OK)
+        {
+            dst->bitmap[current_slave_address >> 5] |= 1UL << (current_slave_address & 0x1F);
+            dst->count++;
+        }
+    }
+    dst->is_valid = 1;
+
+    return (dst->count > 0) ? MLX90614_EC_OK : MLX90614_EC_NR;
+}
+
+void invalidate_mlx90614_scan(MLX90614_Scan_Result *scan)
+{
+    scan->is_valid = 0;
+}
+
+uint8_t is_mlx90614_address_in_scan(const MLX90614_Scan_Result *scan, uint8_t slave_address)
+{
+    if (!scan->is_valid || (slave_address > MLX90614_MAX_VALID_SLAVE_ADDRESS_VALUE))
+    {
+        return 0;
+    }
+
+    return (scan->bitmap[slave_address >> 5] >> (slave_address & 0x1F)) & 1UL;
+}
+
+uint8_t get_mlx90614_next_scanned_address(const MLX90614_Scan_Result *scan, uint8_t from_address)
+{
+    for (; from_address<MLX90614_MAX_VALID_SLAVE_ADDRESS_VALUE_PLUS_ONE; from_address++)
+    {
+        if (is_mlx90614_address_in_scan(scan, from_address))
+        {
+            return from_address;
+        }
+    }
+
+    return 0;
+}
+#endif
+
+uint8_t get_mlx90614_module_slave_address(void)
+{
+    return mlx90614_module_handle.slave_address;
+}
+
+uint8_t get_mlx90614_handle_slave_address(MLX90614_Handle *hmlx)
+{
+    return hmlx->slave_address;
+}
+
+MLX90614_Status set_mlx90614_module_slave_address(uint8_t slave_address)
+{
+    return set_mlx90614_handle_slave_address(&mlx90614_module_handle, slave_address);
+}
+
+MLX90614_Status set_mlx90614_handle_slave_address(MLX90614_Handle *hmlx, uint8_t slave_address)
+{
+    /* Validate the given slave address to have a valid value. */
+    if ((slave_address>MLX90614_MAX_VALID_SLAVE_ADDRESS_VALUE) || (slave_address<MLX90614_MIN_VALID_SLAVE_ADDRESS_VALUE))
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    /* Validate the given slave address according to the Slave Address Validation of the given MLX90614 Handle. */
+    /** <b>Local uint8_t variable tmp_slave_addr_one_bit_left_shifted:</b> Contains the given slave address, but with one bit left shift. */
+    uint8_t tmp_slave_addr_one_bit_left_shifted = slave_address << 1;
+    /** <b>Local uint8_t variable is_verified:</b> Flag indicating whether the MLX90614 Device has been confirmed to respond under the given slave address. */
+    uint8_t is_verified = 1;
+    switch (hmlx->address_validation)
+    {
+        case MLX90614_ADDRESS_VALIDATION_LAZY:
+            is_verified = 0; // The first successful reading under the given slave address will confirm it.
+            break;
+#if (MLX90614_ENABLE_SCAN)
+        case MLX90614_ADDRESS_VALIDATION_SCAN:
+            if ((hmlx->p_address_scan != NULL) && hmlx->p_address_scan->is_valid)
+            {
+                if (!is_mlx90614_address_in_scan(hmlx->p_address_scan, slave_address))
+                {
+                    return MLX90614_EC_NR;
+                }
+                break;
+            }
+            /* A missing or an invalidated scan cannot tell anything, so the given slave address is probed instead. */
+#endif
+            /* fall through */
+        default:
+            if (probe_mlx90614_slave_address(hmlx->hi2c, tmp_slave_addr_one_bit_left_shifted, hmlx->retry_policy.timeout_ms) != HAL_OK)
+            {
+                return MLX90614_EC_NR;
+            }
+            break;
+    }
+
+    /* Update and persist the slave address in the given MLX90614 Handle. */
+    hmlx->slave_address = slave_address;
+    hmlx->slave_address_one_bit_left_shifted = tmp_slave_addr_one_bit_left_shifted;
+    hmlx->is_slave_address_verified = is_verified;
+    hmlx->cache_valid = 0;
+    hmlx->eeprom_shadow_valid = 0; // The EEPROM Shadow may hold the words of another MLX90614 Device.
+
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Status set_mlx90614_handle_address_validation(MLX90614_Handle *hmlx, uint8_t validation)
+{
+    if ((validation != MLX90614_ADDRESS_VALIDATION_PROBE) && (validation != MLX90614_ADDRESS_VALIDATION_LAZY))
+    {
+        return MLX90614_EC_ERR;
+    }
+    hmlx->address_validation = validation;
+
+    return MLX90614_EC_OK;
+}
+
+#if (MLX90614_ENABLE_SCAN)
+MLX90614_Status set_mlx90614_handle_address_scan(MLX90614_Handle *hmlx, const MLX90614_Scan_Result *scan)
+{
+    if (scan == NULL)
+    {
+        return MLX90614_EC_ERR;
+    }
+    hmlx->p_address_scan = scan;
+    hmlx->address_validation = MLX90614_ADDRESS_VALIDATION_SCAN;
+
+    return MLX90614_EC_OK;
+}
+#endif
+
+uint8_t is_mlx90614_handle_slave_address_verified(MLX90614_Handle *hmlx)
+{
+    return hmlx->is_slave_address_verified;
+}
+
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+MLX90614_Status set_mlx90614_device_slave_address(uint8_t new_slave_address)
+{
+    return set_mlx90614_handle_device_slave_address(&mlx90614_module_handle, new_slave_address);
+}
+#endif
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdiscarded-qualifiers" // This pragma definition will tell the compiler to ignore an expected Compilation Warning, that should not affect the program at all and that was decided to put this way for performance purposes. For the record, this Warningstates the following: passing argument 5 of 'HAL_I2C_Mem_Write' discards 'const' qualifier from pointer target type
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+MLX90614_Status set_mlx90614_handle_device_slave_address(MLX90614_Handle *hmlx, uint8_t new_slave_address)
+{
+    /* Validate the given slave address to have a valid value. */
+    if ((new_slave_address>MLX90614_MAX_VALID_SLAVE_ADDRESS_VALUE) || (new_slave_address<MLX90614_MIN_VALID_SLAVE_ADDRESS_VALUE))
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    /* STEP 1, 2 and 3: Read the currently stored 2 bytes of data in the MLX90614 EEPROM address where the Slave Address is stored in order to get the most significant byte, erase them and then write the new Slave Address while keeping that most significant byte. */
+    // NOTE: The MLX90614 Slave Address in the given MLX90614 Handle is updated once the new Slave Address has been successfully written.
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = update_mlx90614_eeprom_bits(hmlx, MLX90614_SLAVE_ADDRESS_EEPROM_ADDRESS, MLX90614_SLAVE_ADDRESS_EEPROM_MASK, new_slave_address);
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+
+    /* STEP 4: Power Cycle (this must be done by implementer or user of this MLX90614 Driver either by external circuit; or by manually electrically disconnecting the MLX90614 Device and subsequently by manually electrically reconnecting it). */
+    // NOTE: A Software Reset will not be enough; Electrical Power reconnection of the MLX90614 must strictly be made.
+    return MLX90614_EC_OK;
+}
+#endif
+#pragma GCC diagnostic pop
+
+MLX90614_Status get_mlx90614_iir(MLX90614_IIR_t *dst)
+{
+    return get_mlx90614_handle_iir(&mlx90614_module_handle, dst);
+}
+
+MLX90614_Status get_mlx90614_handle_iir(MLX90614_Handle *hmlx, MLX90614_IIR_t *dst)
+{
+    /** <b>Local uint16_t variable config_register1:</b> Holds the value of the "ConfigRegister1" Register read from the MLX90614 Device. */
+    uint16_t config_register1;
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = read_mlx90614_eeprom_word(hmlx, MLX90614_CONFIG_REGISTER1_EEPROM_ADDRESS, &config_register1);
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+    *dst = (MLX90614_IIR_t) ((config_register1 & MLX90614_CONFIG_REGISTER1_IIR_MASK) >> MLX90614_CONFIG_REGISTER1_IIR_POS);
+
+    return MLX90614_EC_OK;
+}
+
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+MLX90614_Status set_mlx90614_iir(MLX90614_IIR_t iir)
+{
+    return set_mlx90614_handle_iir(&mlx90614_module_handle, iir);
+}
+
+MLX90614_Status set_mlx90614_handle_iir(MLX90614_Handle *hmlx, MLX90614_IIR_t iir)
+{
+    if (iir > MLX90614_IIR_57)
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    return update_mlx90614_eeprom_bits(hmlx, MLX90614_CONFIG_REGISTER1_EEPROM_ADDRESS, MLX90614_CONFIG_REGISTER1_IIR_MASK, ((uint16_t) iir) << MLX90614_CONFIG_REGISTER1_IIR_POS);
+}
+#endif
+
+MLX90614_Status get_mlx90614_fir(MLX90614_FIR_t *dst)
+{
+    return get_mlx90614_handle_fir(&mlx90614_module_handle, dst);
+}
+
+MLX90614_Status get_mlx90614_handle_fir(MLX90614_Handle *hmlx, MLX90614_FIR_t *dst)
+{
+    /** <b>Local uint16_t variable config_register1:</b> Holds the value of the "ConfigRegister1" Register read from the MLX90614 Device. */
+    uint16_t config_register1;
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = read_mlx90614_eeprom_word(hmlx, MLX90614_CONFIG_REGISTER1_EEPROM_ADDRESS, &config_register1);
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+    *dst = (MLX90614_FIR_t) ((config_register1 & MLX90614_CONFIG_REGISTER1_FIR_MASK) >> MLX90614_CONFIG_REGISTER1_FIR_POS);
+
+    return MLX90614_EC_OK;
+}
+
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+MLX90614_Status set_mlx90614_fir(MLX90614_FIR_t fir)
+{
+    return set_mlx90614_handle_fir(&mlx90614_module_handle, fir);
+}
+
+MLX90614_Status set_mlx90614_handle_fir(MLX90614_Handle *hmlx, MLX90614_FIR_t fir)
+{
+    if ((fir < MLX90614_FIR_128) || (fir > MLX90614_FIR_1024))
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    return update_mlx90614_eeprom_bits(hmlx, MLX90614_CONFIG_REGISTER1_EEPROM_ADDRESS, MLX90614_CONFIG_REGISTER1_FIR_MASK, ((uint16_t) fir) << MLX90614_CONFIG_REGISTER1_FIR_POS);
+}
+#endif
+
+MLX90614_Status get_mlx90614_gain(MLX90614_Gain_t *dst)
+{
+    return get_mlx90614_handle_gain(&mlx90614_module_handle, dst);
+}
+
+MLX90614_Status get_mlx90614_handle_gain(MLX90614_Handle *hmlx, MLX90614_Gain_t *dst)
+{
+    /** <b>Local uint16_t variable config_register1:</b> Holds the value of the "ConfigRegister1" Register read from the MLX90614 Device. */
+    uint16_t config_register1;
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = read_mlx90614_eeprom_word(hmlx, MLX90614_CONFIG_REGISTER1_EEPROM_ADDRESS, &config_register1);
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+    *dst = (MLX90614_Gain_t) ((config_register1 & MLX90614_CONFIG_REGISTER1_GAIN_MASK) >> MLX90614_CONFIG_REGISTER1_GAIN_POS);
+
+    return MLX90614_EC_OK;
+}
+
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+MLX90614_Status set_mlx90614_gain(MLX90614_Gain_t gain)
+{
+    return set_mlx90614_handle_gain(&mlx90614_module_handle, gain);
+}
+
+MLX90614_Status set_mlx90614_handle_gain(MLX90614_Handle *hmlx, MLX90614_Gain_t gain)
+{
+    if (gain > MLX90614_GAIN_100)
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    return update_mlx90614_eeprom_bits(hmlx, MLX90614_CONFIG_REGISTER1_EEPROM_ADDRESS, MLX90614_CONFIG_REGISTER1_GAIN_MASK, ((uint16_t) gain) << MLX90614_CONFIG_REGISTER1_GAIN_POS);
+}
+#endif
+
+MLX90614_Status get_mlx90614_handle_config_register1(MLX90614_Handle *hmlx, uint16_t *dst)
+{
+    return read_mlx90614_eeprom_word(hmlx, MLX90614_CONFIG_REGISTER1_EEPROM_ADDRESS, dst);
+}
+
+MLX90614_Status get_mlx90614_handle_pwm_range(MLX90614_Handle *hmlx, uint16_t *to_max, uint16_t *to_min)
+{
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = read_mlx90614_eeprom_word(hmlx, MLX90614_TO_MAX_EEPROM_ADDRESS, to_max);
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+
+    return read_mlx90614_eeprom_word(hmlx, MLX90614_TO_MIN_EEPROM_ADDRESS, to_min);
+}
+
+MLX90614_Status get_mlx90614_emissivity(float *dst)
+{
+    return get_mlx90614_handle_emissivity(&mlx90614_module_handle, dst);
+}
+
+MLX90614_Status get_mlx90614_handle_emissivity(MLX90614_Handle *hmlx, float *dst)
+{
+    /** <b>Local uint16_t variable emissivity:</b> Holds the value of the Emissivity EEPROM cell read from the MLX90614 Device. */
+    uint16_t emissivity;
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = read_mlx90614_eeprom_word(hmlx, MLX90614_EMISSIVITY_EEPROM_ADDRESS, &emissivity);
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+    *dst = ((float) emissivity) / MLX90614_EMISSIVITY_FULL_SCALE;
+
+    return MLX90614_EC_OK;
+}
+
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+MLX90614_Status set_mlx90614_emissivity(float emissivity)
+{
+    return set_mlx90614_handle_emissivity(&mlx90614_module_handle, emissivity);
+}
+
+MLX90614_Status set_mlx90614_handle_emissivity(MLX90614_Handle *hmlx, float emissivity)
+{
+    if (!(emissivity >= MLX90614_MIN_EMISSIVITY) || (emissivity > 1.0f))
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    return update_mlx90614_eeprom_bits(hmlx, MLX90614_EMISSIVITY_EEPROM_ADDRESS, 0xFFFF, (uint16_t) (emissivity*MLX90614_EMISSIVITY_FULL_SCALE + 0.5f));
+}
+#endif
+
+MLX90614_Status set_mlx90614_handle_emissivity_compensation(MLX90614_Handle *hmlx, float emissivity)
+{
+    if (emissivity == 0.0f)
+    {
+        hmlx->emissivity_coefficient = 0;
+        return MLX90614_EC_OK;
+    }
+    if (!(emissivity >= MLX90614_MIN_EMISSIVITY) || (emissivity > 1.0f))
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    /** <b>Local uint16_t variable device_emissivity:</b> Holds the value of the Emissivity EEPROM cell of the MLX90614 Device. */
+    uint16_t device_emissivity;
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = read_mlx90614_eeprom_word(hmlx, MLX90614_EMISSIVITY_EEPROM_ADDRESS, &device_emissivity);
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+    /** <b>Local uint32_t variable target_emissivity:</b> Emissivity of the target material in the same scale as the Emissivity EEPROM cell. */
+    uint32_t target_emissivity = (uint32_t) (emissivity*MLX90614_EMISSIVITY_FULL_SCALE + 0.5f);
+    hmlx->emissivity_coefficient = ((((uint32_t) device_emissivity) << MLX90614_EMISSIVITY_COEFFICIENT_SHIFT) + target_emissivity/2) / target_emissivity;
+
+    return MLX90614_EC_OK;
+}
+
+uint16_t compensate_mlx90614_emissivity(uint16_t raw_obj, uint16_t raw_ta, uint32_t coefficient)
+{
+    /* Fourth powers of the Raw Values, without their least significant bits so that the products below fit in 64 bits. */
+    /** <b>Local uint64_t variable obj4:</b> Fourth power of the given Object Temperature Raw Value. */
+    uint64_t obj4 = ((uint32_t) raw_obj)*raw_obj;
+    obj4 = (obj4*obj4) >> MLX90614_EMISSIVITY_POWER_SHIFT;
+    /** <b>Local uint64_t variable ta4:</b> Fourth power of the given Ambient Temperature Raw Value. */
+    uint64_t ta4 = ((uint32_t) raw_ta)*raw_ta;
+    ta4 = (ta4*ta4) >> MLX90614_EMISSIVITY_POWER_SHIFT;
+
+    /** <b>Local int64_t variable t4:</b> Fourth power of the compensated Object Temperature Raw Value. */
+    int64_t t4 = ((int64_t) ta4) + ((((int64_t) obj4) - ((int64_t) ta4))*coefficient) / (1L << MLX90614_EMISSIVITY_COEFFICIENT_SHIFT);
+    if (t4 <= 0)
+    {
+        return 0;
+    }
+
+    /* NOTE: The square root of the square root gives the integer fourth root, rounded down. The dropped bits are
+             restored as ones, since restoring them as zeros would round a Raw Value that was not compensated at all
+             down to the one below it. */
+    /** <b>Local uint32_t variable root:</b> Compensated Object Temperature Raw Value. */
+    uint32_t root = calculate_mlx90614_isqrt(calculate_mlx90614_isqrt((((uint64_t) t4) << MLX90614_EMISSIVITY_POWER_SHIFT) | ((1ULL << MLX90614_EMISSIVITY_POWER_SHIFT) - 1)));
+    return (root > 0x7FFF) ? 0x7FFF : root;
+}
+
+uint32_t get_mlx90614_settling_time(MLX90614_IIR_t iir, MLX90614_FIR_t fir)
+{
+    /** <b>Local constant uint8_t array iir_outputs_to_settle:</b> Number of outputs that each IIR Filter setting requires to reach 95\% of a step change, which is indexed by @ref MLX90614_IIR_t . */
+    static const uint8_t iir_outputs_to_settle[] = {5, 11, 17, 23, 1, 2, 3, 4};
+    if ((iir > MLX90614_IIR_57) || (fir < MLX90614_FIR_128) || (fir > MLX90614_FIR_1024))
+    {
+        return 0;
+    }
+
+    /** <b>Local uint8_t variable shift:</b> Number of times that the N of the given FIR Filter setting has been halved with respect to \f$N=1024\f$ , which also halves the time in which a new output is produced. */
+    uint8_t shift = MLX90614_FIR_1024 - fir;
+    // NOTE: The division made by the shift is rounded up so that the estimation never falls below the actual settling time.
+    return ((MLX90614_FIR_1024_OUTPUT_PERIOD * (uint32_t) iir_outputs_to_settle[iir]) + (1U << shift) - 1) >> shift;
+}
+
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+MLX90614_Status start_mlx90614_handle_eeprom_write(MLX90614_EEPROM_Write *job, MLX90614_Handle *hmlx, uint8_t eeprom_address, uint16_t mask, uint16_t value, uint8_t is_verify_enabled)
+{
+    if (eeprom_address > MLX90614_MAX_EEPROM_ADDRESS)
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    prepare_mlx90614_eeprom_write(job, hmlx, MLX90614_EEPROM_ACCESS_COMMAND | eeprom_address, mask, value);
+    job->is_verify_enabled = is_verify_enabled;
+
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Status start_mlx90614_handle_device_slave_address_write(MLX90614_EEPROM_Write *job, MLX90614_Handle *hmlx, uint8_t new_slave_address, uint8_t is_verify_enabled)
+{
+    /* Validate the given slave address to have a valid value. */
+    if ((new_slave_address>MLX90614_MAX_VALID_SLAVE_ADDRESS_VALUE) || (new_slave_address<MLX90614_MIN_VALID_SLAVE_ADDRESS_VALUE))
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    prepare_mlx90614_eeprom_write(job, hmlx, MLX90614_SLAVE_ADDRESS_EEPROM_ADDRESS, MLX90614_SLAVE_ADDRESS_EEPROM_MASK, new_slave_address);
+    job->is_verify_enabled = is_verify_enabled;
+
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Status pump_mlx90614_eeprom_write(MLX90614_EEPROM_Write *job)
+{
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = MLX90614_EC_NA;
+    /** <b>Local uint16_t variable eeprom_value:</b> Holds the value currently stored in the EEPROM address of interest. */
+    uint16_t eeprom_value;
+
+    /* NOTE: Each call to this function makes at most one I2C transaction so that the caller is never blocked for long. */
+    switch (job->stage)
+    {
+        case MLX90614_EEPROM_STAGE_READ:
+            ret = read_mlx90614_eeprom_word(job->hmlx, job->command, &eeprom_value);
+            if (ret != MLX90614_EC_OK)
+            {
+                break;
+            }
+            if ((eeprom_value & job->mask) == job->value)
+            {
+                break; // The desired value is already stored, so there is no need to wear out the EEPROM.
+            }
+            job->value |= eeprom_value & ~job->mask;
+            job->stage = MLX90614_EEPROM_STAGE_ERASE;
+            return MLX90614_EC_NA;
+        case MLX90614_EEPROM_STAGE_ERASE:
+            update_mlx90614_eeprom_shadow(job->hmlx, job->command, 0, 0); // The EEPROM cell is about to change, so its copy can no longer be trusted.
+            ret = send_mlx90614_write_command(job->hmlx, job->command, MLX90614_SLAVE_ADDRESS_EEPROM_ERASE_VALUE);
+            if (ret != MLX90614_EC_OK)
+            {
+                break;
+            }
+            job->stage_tick = HAL_GetTick();
+            job->stage = MLX90614_EEPROM_STAGE_ERASE_WAIT;
+            return MLX90614_EC_NA;
+        case MLX90614_EEPROM_STAGE_ERASE_WAIT:
+            ret = poll_mlx90614_eeprom_cell(job, MLX90614_SLAVE_ADDRESS_EEPROM_ERASE_VALUE);
+            if (ret == MLX90614_EC_OK)
+            {
+                job->stage = MLX90614_EEPROM_STAGE_WRITE;
+                return MLX90614_EC_NA;
+            }
+            if (ret == MLX90614_EC_NA)
+            {
+                return MLX90614_EC_NA;
+            }
+            break;
+        case MLX90614_EEPROM_STAGE_WRITE:
+            ret = send_mlx90614_write_command(job->hmlx, job->command, job->value);
+            if (ret != MLX90614_EC_OK)
+            {
+                break;
+            }
+            job->stage_tick = HAL_GetTick();
+            job->stage = MLX90614_EEPROM_STAGE_WRITE_WAIT;
+            return MLX90614_EC_NA;
+        case MLX90614_EEPROM_STAGE_WRITE_WAIT:
+            ret = poll_mlx90614_eeprom_cell(job, job->value);
+            if (ret == MLX90614_EC_NA)
+            {
+                return MLX90614_EC_NA;
+            }
+            if (ret == MLX90614_EC_OK)
+            {
+                // NOTE: Without the readback verification, the written value is assumed to be stored as it is.
+                update_mlx90614_eeprom_shadow(job->hmlx, job->command, job->value, 1);
+            }
+            if ((ret == MLX90614_EC_OK) && (job->command == MLX90614_SLAVE_ADDRESS_EEPROM_ADDRESS))
+            {
+                /* Updating the MLX90614 Slave Address in the MLX90614 Handle, which will only take effect in the MLX90614 Device after it is Power Cycled. */
+                job->hmlx->slave_address = job->value & MLX90614_SLAVE_ADDRESS_EEPROM_MASK;
+                job->hmlx->slave_address_one_bit_left_shifted = job->hmlx->slave_address << 1;
+            }
+            break;
+        default:
+            return job->status; // The EEPROM Write has already concluded.
+    }
+
+    job->status = ret;
+    job->stage = MLX90614_EEPROM_STAGE_DONE;
+    return ret;
+}
+#endif
+
+void set_mlx90614_handle_eeprom_shadow(MLX90614_Handle *hmlx, uint8_t is_enabled)
+{
+    hmlx->eeprom_shadow_valid = 0;
+    hmlx->is_eeprom_shadow_enabled = is_enabled;
+}
+
+uint8_t get_mlx90614_handle_eeprom_shadow(MLX90614_Handle *hmlx)
+{
+    return hmlx->is_eeprom_shadow_enabled;
+}
+
+MLX90614_Status load_mlx90614_handle_eeprom_shadow(MLX90614_Handle *hmlx)
+{
+    if (!hmlx->is_eeprom_shadow_enabled)
+    {
+        return MLX90614_EC_NA;
+    }
+
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret;
+    /** <b>Local uint16_t variable eeprom_value:</b> Holds the word read from the EEPROM of the MLX90614 Device. */
+    uint16_t eeprom_value;
+    hmlx->eeprom_shadow_valid = 0;
+    for (uint8_t i=0; i<MLX90614_EEPROM_SHADOW_SIZE; i++)
+    {
+        ret = read_mlx90614_eeprom_word(hmlx, mlx90614_eeprom_shadow_commands[i], &eeprom_value);
+        if (ret != MLX90614_EC_OK)
+        {
+            return ret;
+        }
+    }
+
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Temp_t get_mlx90614_temperature_type(void)
+{
+    return mlx90614_module_handle.temperature_type;
+}
+
+MLX90614_Temp_t get_mlx90614_handle_temperature_type(MLX90614_Handle *hmlx)
+{
+    return hmlx->temperature_type;
+}
+
+MLX90614_Status set_mlx90614_temperature_type(MLX90614_Temp_t temp_t)
+{
+    return set_mlx90614_handle_temperature_type(&mlx90614_module_handle, temp_t);
+}
+
+MLX90614_Status set_mlx90614_handle_temperature_type(MLX90614_Handle *hmlx, MLX90614_Temp_t temp_t)
+{
+    /** <b>Local pointer p_converter:</b> Points to the conversion function of the requested Temperature Type. */
+    float (*p_converter)(uint16_t raw_temp) = get_mlx90614_temperature_converter(temp_t);
+    if (p_converter == NULL)
+    {
+        return MLX90614_EC_ERR; // The requested temperature value type is not recognized. Therefore, send Error Exception Code.
+    }
+
+    /* Update the conversion function and the Temperature Type of the given MLX90614 Handle. */
+    hmlx->p_get_converted_temperature = p_converter;
+    hmlx->temperature_type = temp_t;
+
+    return MLX90614_EC_OK;
+}
+
+void set_mlx90614_handle_pec_check(MLX90614_Handle *hmlx, uint8_t is_enabled)
+{
+    hmlx->is_pec_check_enabled = (is_enabled != 0);
+}
+
+uint8_t get_mlx90614_handle_pec_check(MLX90614_Handle *hmlx)
+{
+    return hmlx->is_pec_check_enabled;
+}
+
+MLX90614_Status set_mlx90614_handle_retry_policy(MLX90614_Handle *hmlx, const MLX90614_Retry_Policy *policy)
+{
+    if (policy->timeout_ms == 0)
+    {
+        return MLX90614_EC_ERR;
+    }
+    hmlx->retry_policy = *policy;
+
+    return MLX90614_EC_OK;
+}
+
+void get_mlx90614_handle_retry_policy(MLX90614_Handle *hmlx, MLX90614_Retry_Policy *dst)
+{
+    *dst = hmlx->retry_policy;
+}
+
+MLX90614_Status recover_mlx90614_i2c_bus(I2C_HandleTypeDef *hi2c, const MLX90614_Bus_Recovery *recovery)
+{
+    /* Taking both I2C pins away from the I2C Peripheral as open-drain outputs that are released (i.e., high). */
+    take_mlx90614_bus_pins(hi2c, recovery);
+    wait_mlx90614_bus_recovery_half_period();
+
+    /* Clocking SCL until the slave device releases SDA. */
+    for (uint8_t i=0; (i<MLX90614_BUS_RECOVERY_CLOCKS) && (HAL_GPIO_ReadPin(recovery->sda_port, recovery->sda_pin) == GPIO_PIN_RESET); i++)
+    {
+        HAL_GPIO_WritePin(recovery->scl_port, recovery->scl_pin, GPIO_PIN_RESET);
+        wait_mlx90614_bus_recovery_half_period();
+        HAL_GPIO_WritePin(recovery->scl_port, recovery->scl_pin, GPIO_PIN_SET);
+        wait_mlx90614_bus_recovery_half_period();
+    }
+    /** <b>Local GPIO_PinState variable sda_state:</b> State of SDA after having clocked SCL. */
+    GPIO_PinState sda_state = HAL_GPIO_ReadPin(recovery->sda_port, recovery->sda_pin);
+
+    /* Generating a STOP condition (i.e., a rising edge of SDA while SCL is high). */
+    HAL_GPIO_WritePin(recovery->scl_port, recovery->scl_pin, GPIO_PIN_RESET);
+    wait_mlx90614_bus_recovery_half_period();
+    HAL_GPIO_WritePin(recovery->sda_port, recovery->sda_pin, GPIO_PIN_RESET);
+    wait_mlx90614_bus_recovery_half_period();
+    HAL_GPIO_WritePin(recovery->scl_port, recovery->scl_pin, GPIO_PIN_SET);
+    wait_mlx90614_bus_recovery_half_period();
+    HAL_GPIO_WritePin(recovery->sda_port, recovery->sda_pin, GPIO_PIN_SET);
+    wait_mlx90614_bus_recovery_half_period();
+
+    MLX90614_STATS_INCREMENT(bus_recoveries);
+    if (give_back_mlx90614_bus_pins(hi2c, recovery) != HAL_OK)
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    return (sda_state == GPIO_PIN_SET) ? MLX90614_EC_OK : MLX90614_EC_ERR;
+}
+
+void set_mlx90614_handle_freshness_window(MLX90614_Handle *hmlx, uint32_t window)
+{
+    hmlx->cache_valid = 0;
+    hmlx->freshness_window = window;
+}
+
+void invalidate_mlx90614_handle_cache(MLX90614_Handle *hmlx)
+{
+    hmlx->cache_valid = 0;
+}
+
+MLX90614_Status get_mlx90614_handle_raw_temperature(MLX90614_Handle *hmlx, MLX90614_Channel_t channel, uint8_t is_forced, uint16_t *dst)
+{
+    if (channel > MLX90614_Ch_Tobj2)
+    {
+        return MLX90614_EC_ERR;
+    }
+    if (is_forced)
+    {
+        hmlx->cache_valid &= ~(1U << channel);
+    }
+
+    return read_mlx90614_raw_temperature(hmlx, MLX90614_TA_RAM_ADDRESS + channel, dst);
+}
+
+void set_mlx90614_handle_bus_recovery(MLX90614_Handle *hmlx, const MLX90614_Bus_Recovery *recovery)
+{
+    hmlx->p_bus_recovery = recovery;
+}
+
+MLX90614_Status get_mlx90614_ambient_temperature(float *dst)
+{
+    return get_mlx90614_handle_ambient_temperature(&mlx90614_module_handle, dst);
+}
+
+MLX90614_Status get_mlx90614_handle_ambient_temperature(MLX90614_Handle *hmlx, float *dst)
+{
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret;
+    /** <b>Local uint16_t variable raw_temp:</b> Holds the Decimal Value corresponding to the Raw Data read from the MLX90614 Device after requesting to it a temperature value. */
+    uint16_t raw_temp;
+    MLX90614_STATS_BEGIN(start);
+
+    /* Reading current Ambient Temperature Raw Value from MLX90614 Infra Red Thermometer device. */
+    ret = read_mlx90614_raw_temperature(hmlx, MLX90614_TA_RAM_ADDRESS, &raw_temp);
+    if (ret != MLX90614_EC_OK)
+    {
+        MLX90614_STATS_END(MLX90614_STATS_OP_GET_AMBIENT, start);
+        return ret;
+    }
+
+    /* Converting Raw Data read from MLX90614 Infra Red Thermometer into an actual temperature value according to its datasheet. */
+    *dst = MLX90614_CONVERT_RAW_TEMPERATURE(hmlx->p_get_converted_temperature, raw_temp);
+
+    MLX90614_STATS_END(MLX90614_STATS_OP_GET_AMBIENT, start);
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Status get_mlx90614_object1_temperature(float *dst)
+{
+    return get_mlx90614_handle_object1_temperature(&mlx90614_module_handle, dst);
+}
+
+MLX90614_Status get_mlx90614_handle_object1_temperature(MLX90614_Handle *hmlx, float *dst)
+{
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret;
+    /** <b>Local uint16_t variable raw_temp:</b> Holds the Decimal Value corresponding to the Raw Data read from the MLX90614 Device after requesting to it a temperature value. */
+    uint16_t raw_temp;
+    MLX90614_STATS_BEGIN(start);
+
+    /* Reading current Object1 Temperature Raw Value from MLX90614 Infra Red Thermometer device. */
+    ret = read_mlx90614_raw_temperature(hmlx, MLX90614_TOBJ1_RAM_ADDRESS, &raw_temp);
+    if (ret != MLX90614_EC_OK)
+    {
+        MLX90614_STATS_END(MLX90614_STATS_OP_GET_OBJECT1, start);
+        return ret;
+    }
+
+    /* Converting Raw Data read from MLX90614 Infra Red Thermometer into an actual temperature value according to its datasheet. */
+    *dst = MLX90614_CONVERT_RAW_TEMPERATURE(hmlx->p_get_converted_temperature, raw_temp);
+
+    MLX90614_STATS_END(MLX90614_STATS_OP_GET_OBJECT1, start);
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Status get_mlx90614_object2_temperature(float *dst)
+{
+    return get_mlx90614_handle_object2_temperature(&mlx90614_module_handle, dst);
+}
+
+MLX90614_Status get_mlx90614_handle_object2_temperature(MLX90614_Handle *hmlx, float *dst)
+{
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret;
+    /** <b>Local uint16_t variable raw_temp:</b> Holds the Decimal Value corresponding to the Raw Data read from the MLX90614 Device after requesting to it a temperature value. */
+    uint16_t raw_temp;
+    MLX90614_STATS_BEGIN(start);
+
+    /* Reading current Object2 Temperature Raw Value from MLX90614 Infra Red Thermometer device. */
+    ret = read_mlx90614_raw_temperature(hmlx, MLX90614_TOBJ2_RAM_ADDRESS, &raw_temp);
+    if (ret != MLX90614_EC_OK)
+    {
+        MLX90614_STATS_END(MLX90614_STATS_OP_GET_OBJECT2, start);
+        return ret;
+    }
+
+    /* Converting Raw Data read from MLX90614 Infra Red Thermometer into an actual temperature value according to its datasheet. */
+    *dst = MLX90614_CONVERT_RAW_TEMPERATURE(hmlx->p_get_converted_temperature, raw_temp);
+
+    MLX90614_STATS_END(MLX90614_STATS_OP_GET_OBJECT2, start);
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Status get_mlx90614_ambient_centi_temperature(int32_t *dst)
+{
+    return get_mlx90614_handle_ambient_centi_temperature(&mlx90614_module_handle, dst);
+}
+
+MLX90614_Status get_mlx90614_handle_ambient_centi_temperature(MLX90614_Handle *hmlx, int32_t *dst)
+{
+    return get_mlx90614_handle_channel_centi_temperature(hmlx, MLX90614_Ch_Ta, dst);
+}
+
+MLX90614_Status get_mlx90614_object1_centi_temperature(int32_t *dst)
+{
+    return get_mlx90614_handle_object1_centi_temperature(&mlx90614_module_handle, dst);
+}
+
+MLX90614_Status get_mlx90614_handle_object1_centi_temperature(MLX90614_Handle *hmlx, int32_t *dst)
+{
+    return get_mlx90614_handle_channel_centi_temperature(hmlx, MLX90614_Ch_Tobj1, dst);
+}
+
+MLX90614_Status get_mlx90614_object2_centi_temperature(int32_t *dst)
+{
+    return get_mlx90614_handle_object2_centi_temperature(&mlx90614_module_handle, dst);
+}
+
+MLX90614_Status get_mlx90614_handle_object2_centi_temperature(MLX90614_Handle *hmlx, int32_t *dst)
+{
+    return get_mlx90614_handle_channel_centi_temperature(hmlx, MLX90614_Ch_Tobj2, dst);
+}
+
+MLX90614_Status get_mlx90614_all_temperatures(MLX90614_Sample *dst)
+{
+    return get_mlx90614_handle_all_temperatures(&mlx90614_module_handle, dst);
+}
+
+MLX90614_Status get_mlx90614_handle_all_temperatures(MLX90614_Handle *hmlx, MLX90614_Sample *dst)
+{
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret;
+    MLX90614_STATS_BEGIN(start);
+
+    /* Reading the Raw Values of all the temperature channels back to back. */
+    for (uint8_t channel=MLX90614_Ch_Ta; channel<MLX90614_NUMBER_OF_CHANNELS; channel++)
+    {
+        ret = read_mlx90614_raw_temperature(hmlx, MLX90614_TA_RAM_ADDRESS + channel, &dst->raw[channel]);
+        if (ret != MLX90614_EC_OK)
+        {
+            MLX90614_STATS_END(MLX90614_STATS_OP_GET_ALL, start);
+            return ret;
+        }
+    }
+
+    /* Converting all the Raw Values in a single pass. */
+    convert_mlx90614_sample(hmlx, dst);
+
+    MLX90614_STATS_END(MLX90614_STATS_OP_GET_ALL, start);
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Status get_mlx90614_all_temperatures_async(MLX90614_Sample *dst, MLX90614_Sample_Callback callback)
+{
+    return get_mlx90614_handle_all_temperatures_async(&mlx90614_module_handle, dst, callback);
+}
+
+MLX90614_Status get_mlx90614_handle_all_temperatures_async(MLX90614_Handle *hmlx, MLX90614_Sample *dst, MLX90614_Sample_Callback callback)
+{
+    /** <b>Local uint8_t variable slot:</b> Index of the slot of @ref p_mlx90614_async_handles assigned to the given MLX90614 Handle. */
+    uint8_t slot = claim_mlx90614_async_slot(hmlx);
+    if (slot == MLX90614_MAX_NUMBER_OF_ASYNC_I2C)
+    {
+        return MLX90614_EC_NR;
+    }
+
+    /* NOTE: The rest of the temperature channels are chained from the @ref mlx90614_i2c_mem_rx_cplt_callback function. */
+    hmlx->p_async_sample = dst;
+    hmlx->p_async_sample_callback = callback;
+    hmlx->async_channel = MLX90614_Ch_Ta;
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = issue_mlx90614_async_reading(hmlx, MLX90614_TA_RAM_ADDRESS);
+    if (ret != MLX90614_EC_OK)
+    {
+        p_mlx90614_async_handles[slot] = NULL;
+        hmlx->p_async_sample = NULL;
+        hmlx->async_state = MLX90614_ASYNC_IDLE;
+        return ret;
+    }
+
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Status get_mlx90614_ambient_temperature_async(MLX90614_Async_Callback callback)
+{
+    return start_mlx90614_async_temperature_reading(&mlx90614_module_handle, MLX90614_Ch_Ta, callback);
+}
+
+MLX90614_Status get_mlx90614_handle_ambient_temperature_async(MLX90614_Handle *hmlx, MLX90614_Async_Callback callback)
+{
+    return start_mlx90614_async_temperature_reading(hmlx, MLX90614_Ch_Ta, callback);
+}
+
+MLX90614_Status get_mlx90614_object1_temperature_async(MLX90614_Async_Callback callback)
+{
+    return start_mlx90614_async_temperature_reading(&mlx90614_module_handle, MLX90614_Ch_Tobj1, callback);
+}
+
+MLX90614_Status get_mlx90614_handle_object1_temperature_async(MLX90614_Handle *hmlx, MLX90614_Async_Callback callback)
+{
+    return start_mlx90614_async_temperature_reading(hmlx, MLX90614_Ch_Tobj1, callback);
+}
+
+MLX90614_Status get_mlx90614_object2_temperature_async(MLX90614_Async_Callback callback)
+{
+    return start_mlx90614_async_temperature_reading(&mlx90614_module_handle, MLX90614_Ch_Tobj2, callback);
+}
+
+MLX90614_Status get_mlx90614_handle_object2_temperature_async(MLX90614_Handle *hmlx, MLX90614_Async_Callback callback)
+{
+    return start_mlx90614_async_temperature_reading(hmlx, MLX90614_Ch_Tobj2, callback);
+}
+
+MLX90614_Async_State get_mlx90614_async_state(void)
+{
+    return mlx90614_module_handle.async_state;
+}
+
+MLX90614_Async_State get_mlx90614_handle_async_state(MLX90614_Handle *hmlx)
+{
+    return hmlx->async_state;
+}
+
+MLX90614_Status get_mlx90614_async_temperature(float *dst)
+{
+    return get_mlx90614_handle_async_temperature(&mlx90614_module_handle, dst);
+}
+
+MLX90614_Status get_mlx90614_async_centi_temperature(int32_t *dst)
+{
+    return get_mlx90614_handle_async_centi_temperature(&mlx90614_module_handle, dst);
+}
+
+MLX90614_Status get_mlx90614_handle_async_centi_temperature(MLX90614_Handle *hmlx, int32_t *dst)
+{
+    switch (hmlx->async_state)
+    {
+        case MLX90614_ASYNC_CPLT:
+            *dst = get_mlx90614_converted_centi_temperature(hmlx->async_raw, hmlx->temperature_type);
+            hmlx->async_state = MLX90614_ASYNC_IDLE;
+            return MLX90614_EC_OK;
+        case MLX90614_ASYNC_ERR:
+            hmlx->async_state = MLX90614_ASYNC_IDLE;
+            return hmlx->async_status;
+        default:
+            return MLX90614_EC_NA; // There is no concluded Asynchronous temperature reading to collect.
+    }
+}
+
+MLX90614_Status get_mlx90614_handle_async_temperature(MLX90614_Handle *hmlx, float *dst)
+{
+    switch (hmlx->async_state)
+    {
+        case MLX90614_ASYNC_CPLT:
+            *dst = hmlx->async_temperature;
+            hmlx->async_state = MLX90614_ASYNC_IDLE;
+            return MLX90614_EC_OK;
+        case MLX90614_ASYNC_ERR:
+            hmlx->async_state = MLX90614_ASYNC_IDLE;
+            return hmlx->async_status;
+        default:
+            return MLX90614_EC_NA; // There is no concluded Asynchronous temperature reading to collect.
+    }
+}
+
+void mlx90614_i2c_mem_rx_cplt_callback(I2C_HandleTypeDef *hi2c)
+{
+    /** <b>Local uint8_t variable slot:</b> Index of the slot of @ref p_mlx90614_async_handles that the MLX90614 Handle of the concluded I2C transaction occupies. */
+    uint8_t slot;
+    /** <b>Local pointer hmlx:</b> Points to the MLX90614 Handle to which the concluded I2C transaction belongs to. */
+    MLX90614_Handle *hmlx = find_mlx90614_async_handle(hi2c, &slot);
+    if (hmlx == NULL)
+    {
+        return; // This I2C transaction does not belong to the @ref mlx90614 .
+    }
+
+    if (hmlx->is_pec_check_enabled && (calculate_mlx90614_read_pec(hmlx, MLX90614_TA_RAM_ADDRESS + hmlx->async_channel, hmlx->async_i2cdata) != hmlx->async_i2cdata[2]))
+    {
+        MLX90614_STATS_INCREMENT(pec_errors);
+        conclude_mlx90614_async_reading(hmlx, slot, MLX90614_EC_ERR); // The data received got corrupted.
+        return;
+    }
+    /** <b>Local uint16_t variable raw_temp:</b> Holds the Decimal Value corresponding to the Raw Data read from the MLX90614 Device after requesting to it a temperature value. */
+    uint16_t raw_temp = ((hmlx->async_i2cdata[1]<<8) | hmlx->async_i2cdata[0]);
+    if (raw_temp > 0x7FFF)
+    {
+        MLX90614_STATS_INCREMENT(error_flags);
+        conclude_mlx90614_async_reading(hmlx, slot, MLX90614_EC_ERR); // According to the datasheet, if \c raw_temp > 0x7FFF, then this means that the MLX90614 Device has raised an Error Flag.
+        return;
+    }
+    if (hmlx->p_filter[hmlx->async_channel] != NULL)
+    {
+        raw_temp = update_mlx90614_filter(hmlx->p_filter[hmlx->async_channel], raw_temp);
+    }
+
+    if (hmlx->p_ring_buffer != NULL)
+    {
+        push_mlx90614_ring_buffer(hmlx->p_ring_buffer, hmlx->slave_address, hmlx->async_channel, raw_temp);
+    }
+    if (hmlx->p_event_detector != NULL)
+    {
+        update_mlx90614_event_detector(hmlx->p_event_detector, hmlx, hmlx->async_channel, raw_temp);
+    }
+    store_mlx90614_cached_raw_temperature(hmlx, hmlx->async_channel, raw_temp, MLX90614_TIMESTAMP());
+
+    /* Asynchronous reading of a single temperature channel. */
+    if (hmlx->p_async_sample == NULL)
+    {
+        hmlx->async_raw = raw_temp;
+        hmlx->async_temperature = MLX90614_CONVERT_RAW_TEMPERATURE(hmlx->p_get_converted_temperature, raw_temp);
+        conclude_mlx90614_async_reading(hmlx, slot, MLX90614_EC_OK);
+        return;
+    }
+
+    /* Asynchronous reading of all the temperature channels, where the next channel is chained right away if there is any left. */
+    hmlx->p_async_sample->raw[hmlx->async_channel] = raw_temp;
+    if (hmlx->async_channel < MLX90614_Ch_Tobj2)
+    {
+        hmlx->async_channel++;
+        /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+        uint8_t ret = issue_mlx90614_async_reading(hmlx, MLX90614_TA_RAM_ADDRESS + hmlx->async_channel);
+        if (ret != MLX90614_EC_OK)
+        {
+            conclude_mlx90614_async_reading(hmlx, slot, ret);
+        }
+        return;
+    }
+    convert_mlx90614_sample(hmlx, hmlx->p_async_sample);
+    conclude_mlx90614_async_reading(hmlx, slot, MLX90614_EC_OK);
+}
+
+void mlx90614_i2c_error_callback(I2C_HandleTypeDef *hi2c)
+{
+    /** <b>Local uint8_t variable slot:</b> Index of the slot of @ref p_mlx90614_async_handles that the MLX90614 Handle of the failed I2C transaction occupies. */
+    uint8_t slot;
+    /** <b>Local pointer hmlx:</b> Points to the MLX90614 Handle to which the failed I2C transaction belongs to. */
+    MLX90614_Handle *hmlx = find_mlx90614_async_handle(hi2c, &slot);
+    if (hmlx == NULL)
+    {
+        return; // This I2C transaction does not belong to the @ref mlx90614 .
+    }
+
+    /* A NACK means that the MLX90614 Device did not respond, whereas any other I2C error is treated as a failure. */
+    if ((HAL_I2C_GetError(hi2c) & HAL_I2C_ERROR_AF) != 0)
+    {
+        conclude_mlx90614_async_reading(hmlx, slot, MLX90614_EC_NR);
+    }
+    else
+    {
+        conclude_mlx90614_async_reading(hmlx, slot, MLX90614_EC_ERR);
+    }
+}
+
+MLX90614_Status init_mlx90614_filter(MLX90614_Filter *filter, MLX90614_Filter_Type type, uint8_t length)
+{
+    switch (type)
+    {
+        case MLX90614_FILTER_NONE:
+            length = 0;
+            break;
+        case MLX90614_FILTER_EMA:
+            if ((length == 0) || (length > MLX90614_FILTER_MAX_EMA_SHIFT))
+            {
+                return MLX90614_EC_ERR;
+            }
+            break;
+        case MLX90614_FILTER_BOXCAR:
+        case MLX90614_FILTER_MEDIAN:
+            if ((length == 0) || (length > MLX90614_FILTER_MAX_WINDOW))
+            {
+                return MLX90614_EC_ERR;
+            }
+            break;
+        default:
+            return MLX90614_EC_ERR;
+    }
+
+    filter->type = type;
+    filter->length = length;
+    reset_mlx90614_filter(filter);
+
+    return MLX90614_EC_OK;
+}
+
+void reset_mlx90614_filter(MLX90614_Filter *filter)
+{
+    filter->count = 0;
+    filter->index = 0;
+    filter->accumulator = 0;
+}
+
+uint16_t update_mlx90614_filter(MLX90614_Filter *filter, uint16_t raw)
+{
+    /** <b>Local uint16_t array sorted:</b> Holds a sorted copy of the window of the Median Filter. */
+    uint16_t sorted[MLX90614_FILTER_MAX_WINDOW];
+    /** <b>Local uint16_t variable oldest:</b> Holds the sample of the window of the Boxcar Filter that is being replaced. */
+    uint16_t oldest;
+
+    switch (filter->type)
+    {
+        case MLX90614_FILTER_EMA:
+            if (filter->count == 0)
+            {
+                filter->count = 1;
+                filter->accumulator = ((uint32_t) raw) << filter->length;
+            }
+            else
+            {
+                // NOTE: The state is kept scaled by 2^shift so that the fractional part of the average is not lost.
+                filter->accumulator = filter->accumulator - (filter->accumulator >> filter->length) + raw;
+            }
+            return (filter->accumulator + (1UL << (filter->length - 1))) >> filter->length;
+        case MLX90614_FILTER_BOXCAR:
+            oldest = (filter->count < filter->length) ? 0 : filter->window[filter->index];
+            filter->window[filter->index] = raw;
+            filter->accumulator = filter->accumulator - oldest + raw;
+            filter->index = (filter->index + 1 == filter->length) ? 0 : filter->index + 1;
+            if (filter->count < filter->length)
+            {
+                filter->count++;
+            }
+            return (filter->accumulator + (filter->count >> 1)) / filter->count;
+        case MLX90614_FILTER_MEDIAN:
+            filter->window[filter->index] = raw;
+            filter->index = (filter->index + 1 == filter->length) ? 0 : filter->index + 1;
+            if (filter->count < filter->length)
+            {
+                filter->count++;
+            }
+            /* Insertion sort of a copy of the window, which is the fastest approach for such a small number of samples. */
+            for (uint8_t i=0; i<filter->count; i++)
+            {
+                /** <b>Local uint8_t variable j:</b> Index at which the current sample is being inserted into the sorted copy. */
+                uint8_t j = i;
+                for (; (j > 0) && (sorted[j-1] > filter->window[i]); j--)
+                {
+                    sorted[j] = sorted[j-1];
+                }
+                sorted[j] = filter->window[i];
+            }
+            return sorted[(filter->count - 1) >> 1];
+        default:
+            return raw;
+    }
+}
+
+MLX90614_Status set_mlx90614_handle_filter(MLX90614_Handle *hmlx, MLX90614_Channel_t channel, MLX90614_Filter *filter)
+{
+    if (channel > MLX90614_Ch_Tobj2)
+    {
+        return MLX90614_EC_ERR;
+    }
+    hmlx->p_filter[channel] = filter;
+
+    return MLX90614_EC_OK;
+}
+
+void init_mlx90614_ring_buffer(MLX90614_Ring_Buffer *rb)
+{
+    rb->head = 0;
+    rb->tail = 0;
+    rb->dropped = 0;
+}
+
+MLX90614_Status push_mlx90614_ring_buffer(MLX90614_Ring_Buffer *rb, uint8_t slave_address, MLX90614_Channel_t channel, uint16_t raw)
+{
+    /** <b>Local uint32_t variable head:</b> Holds the free-running index of the entry that is to be pushed. */
+    uint32_t head = rb->head;
+    if ((head - rb->tail) >= MLX90614_RING_BUFFER_CAPACITY)
+    {
+        rb->dropped++;
+        return MLX90614_EC_ERR; // The Ring Buffer is full.
+    }
+
+    /** <b>Local pointer p_entry:</b> Points to the entry of the Ring Buffer that is to be written. */
+    MLX90614_Ring_Entry *p_entry = &rb->entries[head & MLX90614_RING_BUFFER_INDEX_MASK];
+    p_entry->timestamp = MLX90614_TIMESTAMP();
+    p_entry->raw = raw;
+    p_entry->channel = channel;
+    p_entry->slave_address = slave_address;
+    __DMB(); // Makes sure that the entry is written before the consumer can see it via the updated head.
+    rb->head = head + 1;
+
+    return MLX90614_EC_OK;
+}
+
+uint32_t pop_mlx90614_ring_buffer(MLX90614_Ring_Buffer *rb, MLX90614_Ring_Entry *dst, uint32_t max_entries)
+{
+    /** <b>Local uint32_t variable tail:</b> Holds the free-running index of the next entry to be popped. */
+    uint32_t tail = rb->tail;
+    /** <b>Local uint32_t variable n:</b> Holds the number of entries that will be popped. */
+    uint32_t n = rb->head - tail;
+    if (n > max_entries)
+    {
+        n = max_entries;
+    }
+    __DMB(); // Makes sure that the entries are read only after the head that publishes them has been read.
+
+    for (uint32_t i=0; i<n; i++)
+    {
+        dst[i] = rb->entries[(tail + i) & MLX90614_RING_BUFFER_INDEX_MASK];
+    }
+    __DMB(); // Makes sure that the entries have been read before the producer can overwrite them via the updated tail.
+    rb->tail = tail + n;
+
+    return n;
+}
+
+uint32_t get_mlx90614_ring_buffer_count(MLX90614_Ring_Buffer *rb)
+{
+    return rb->head - rb->tail;
+}
+
+uint32_t get_mlx90614_ring_buffer_dropped(MLX90614_Ring_Buffer *rb)
+{
+    return rb->dropped;
+}
+
+void set_mlx90614_handle_ring_buffer(MLX90614_Handle *hmlx, MLX90614_Ring_Buffer *rb)
+{
+    hmlx->p_ring_buffer = rb;
+}
+
+MLX90614_Status init_mlx90614_event_detector(MLX90614_Event_Detector *det, uint8_t channel_mask, uint16_t low_raw, uint16_t high_raw, uint16_t hysteresis_raw, uint16_t delta_raw, MLX90614_Event_Callback callback)
+{
+    if ((high_raw < low_raw) || (high_raw > 0x7FFF))
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    det->low_raw = low_raw;
+    det->high_raw = high_raw;
+    det->hysteresis_raw = hysteresis_raw;
+    det->delta_raw = delta_raw;
+    det->channel_mask = channel_mask;
+    det->p_callback = callback;
+    det->raised = 0;
+    det->suppressed = 0;
+    for (uint8_t i=0; i<MLX90614_NUMBER_OF_CHANNELS; i++)
+    {
+        det->zone[i] = MLX90614_EVENT_NONE;
+        det->reference_raw[i] = 0;
+    }
+
+    return MLX90614_EC_OK;
+}
+
+uint8_t update_mlx90614_event_detector(MLX90614_Event_Detector *det, MLX90614_Handle *hmlx, MLX90614_Channel_t channel, uint16_t raw)
+{
+    if ((channel >= MLX90614_NUMBER_OF_CHANNELS) || !(det->channel_mask & (1U << channel)))
+    {
+        return MLX90614_EVENT_NONE;
+    }
+
+    /* Locate the zone of the given Raw Value, where leaving a threshold zone requires to come back by the hysteresis. */
+    /** <b>Local uint8_t variable zone:</b> Last reported zone of the given channel. */
+    uint8_t zone = det->zone[channel];
+    /** <b>Local uint8_t variable new_zone:</b> Zone of the given Raw Value. */
+    uint8_t new_zone = zone;
+    if (raw > det->high_raw)
+    {
+        new_zone = MLX90614_EVENT_ABOVE_HIGH;
+    }
+    else if (raw < det->low_raw)
+    {
+        new_zone = MLX90614_EVENT_BELOW_LOW;
+    }
+    else if ((zone == MLX90614_EVENT_NONE)
+             || ((zone == MLX90614_EVENT_ABOVE_HIGH) && (((uint32_t) raw) + det->hysteresis_raw <= det->high_raw))
+             || ((zone == MLX90614_EVENT_BELOW_LOW) && (raw >= ((uint32_t) det->low_raw) + det->hysteresis_raw)))
+    {
+        new_zone = MLX90614_EVENT_IN_RANGE;
+    }
+
+    /** <b>Local uint8_t variable events:</b> Bitwise OR of the @ref MLX90614_Event_t flags raised by the given Raw Value. */
+    uint8_t events = (new_zone != zone) ? new_zone : MLX90614_EVENT_NONE;
+    if ((det->delta_raw != 0) && (zone != MLX90614_EVENT_NONE))
+    {
+        /** <b>Local uint16_t variable distance:</b> Raw Value units between the given Raw Value and the last reported one. */
+        uint16_t distance = (raw > det->reference_raw[channel]) ? (raw - det->reference_raw[channel]) : (det->reference_raw[channel] - raw);
+        if (distance >= det->delta_raw)
+        {
+            events |= MLX90614_EVENT_DELTA;
+        }
+    }
+
+    if (events == MLX90614_EVENT_NONE)
+    {
+        det->suppressed++;
+        return MLX90614_EVENT_NONE;
+    }
+    det->zone[channel] = new_zone;
+    det->reference_raw[channel] = raw;
+    det->raised++;
+    if (det->p_callback != NULL)
+    {
+        (*det->p_callback)(hmlx, channel, events, raw);
+    }
+
+    return events;
+}
+
+void set_mlx90614_handle_event_detector(MLX90614_Handle *hmlx, MLX90614_Event_Detector *det)
+{
+    hmlx->p_event_detector = det;
+}
+
+MLX90614_Status init_mlx90614_log_writer(MLX90614_Log_Writer *log, uint8_t *buffer, size_t capacity, const MLX90614_Handle *hmlx, uint32_t start_tick, uint8_t keyframe_interval)
+{
+    if ((capacity < MLX90614_LOG_HEADER_SIZE) || (keyframe_interval == 0))
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    buffer[0] = MLX90614_LOG_MAGIC;
+    buffer[1] = MLX90614_LOG_VERSION;
+    buffer[2] = hmlx->slave_address;
+    buffer[3] = hmlx->temperature_type;
+    buffer[4] = start_tick & 0xFF;
+    buffer[5] = (start_tick >> 8) & 0xFF;
+    buffer[6] = (start_tick >> 16) & 0xFF;
+    buffer[7] = start_tick >> 24;
+    buffer[8] = calculate_mlx90614_log_crc(buffer, MLX90614_LOG_HEADER_SIZE - 1);
+
+    log->p_buffer = buffer;
+    log->capacity = capacity;
+    log->length = MLX90614_LOG_HEADER_SIZE;
+    log->block_start = MLX90614_LOG_HEADER_SIZE;
+    log->keyframe_interval = keyframe_interval;
+    log->block_count = 0;
+
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Status append_mlx90614_log_sample(MLX90614_Log_Writer *log, const MLX90614_Sample *sample)
+{
+    if (((log->capacity - log->length) < MLX90614_LOG_MAX_RECORD_SIZE) || ((sample->raw[MLX90614_Ch_Ta] | sample->raw[MLX90614_Ch_Tobj1] | sample->raw[MLX90614_Ch_Tobj2]) & MLX90614_RAW_ERROR_FLAG))
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    /** <b>Local pointer p_dst:</b> Points to the byte of the Sample Log that is to be written next. */
+    uint8_t *p_dst = &log->p_buffer[log->length];
+    if (log->block_count == 0)
+    {
+        /* Open a new block, whose count byte is written whenever it gets closed, with a keyframe. */
+        log->block_start = log->length;
+        p_dst++;
+        for (uint8_t channel=MLX90614_Ch_Ta; channel<MLX90614_NUMBER_OF_CHANNELS; channel++)
+        {
+            *p_dst++ = sample->raw[channel] & 0xFF;
+            *p_dst++ = sample->raw[channel] >> 8;
+        }
+    }
+    else
+    {
+        for (uint8_t channel=MLX90614_Ch_Ta; channel<MLX90614_NUMBER_OF_CHANNELS; channel++)
+        {
+            p_dst += write_mlx90614_log_varint(p_dst, ((int32_t) sample->raw[channel]) - log->previous_raw[channel]);
+        }
+    }
+    for (uint8_t channel=MLX90614_Ch_Ta; channel<MLX90614_NUMBER_OF_CHANNELS; channel++)
+    {
+        log->previous_raw[channel] = sample->raw[channel];
+    }
+    log->length = p_dst - log->p_buffer;
+
+    if (++log->block_count == log->keyframe_interval)
+    {
+        close_mlx90614_log_block(log);
+    }
+
+    return MLX90614_EC_OK;
+}
+
+void close_mlx90614_log_block(MLX90614_Log_Writer *log)
+{
+    if (log->block_count == 0)
+    {
+        return;
+    }
+    log->p_buffer[log->block_start] = log->block_count;
+    log->p_buffer[log->length] = calculate_mlx90614_log_crc(&log->p_buffer[log->block_start], log->length - log->block_start);
+    log->length++;
+    log->block_count = 0;
+}
+
+size_t get_mlx90614_log_length(const MLX90614_Log_Writer *log)
+{
+    return log->length;
+}
+
+MLX90614_Status decode_mlx90614_log(const uint8_t *log, size_t length, MLX90614_Log_Header *header, MLX90614_Sample *dst, size_t max_samples, size_t *n_samples)
+{
+    *n_samples = 0;
+    if ((length < MLX90614_LOG_HEADER_SIZE) || (log[0] != MLX90614_LOG_MAGIC) || (log[1] != MLX90614_LOG_VERSION) || (calculate_mlx90614_log_crc(log, MLX90614_LOG_HEADER_SIZE - 1) != log[8]))
+    {
+        return MLX90614_EC_ERR;
+    }
+    header->slave_address = log[2];
+    header->temperature_type = (MLX90614_Temp_t) log[3];
+    header->start_tick = ((uint32_t) log[4]) | (((uint32_t) log[5]) << 8) | (((uint32_t) log[6]) << 16) | (((uint32_t) log[7]) << 24);
+    /** <b>Local pointer p_converter:</b> Points to the conversion function of the Temperature Type of the Sample Log. */
+    float (*p_converter)(uint16_t raw_temp) = get_mlx90614_temperature_converter(header->temperature_type);
+    if (p_converter == NULL)
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    /** <b>Local size_t variable pos:</b> Index of the byte of the Sample Log that is to be read next. */
+    size_t pos = MLX90614_LOG_HEADER_SIZE;
+    /** <b>Local size_t variable decoded:</b> Number of samples of the closed blocks that have been decoded into the destination. */
+    size_t decoded = 0;
+    while (pos < length)
+    {
+        /** <b>Local size_t variable block_start:</b> Index of the count byte of the block being decoded. */
+        size_t block_start = pos;
+        /** <b>Local uint8_t variable count:</b> Number of samples of the block being decoded. */
+        uint8_t count = log[pos++];
+        if ((count == 0) || ((length - pos) < MLX90614_LOG_KEYFRAME_SIZE))
+        {
+            break; // The block header is corrupted or truncated.
+        }
+        if ((max_samples - decoded) < count)
+        {
+            *n_samples = decoded;
+            return MLX90614_EC_STOP;
+        }
+
+        /** <b>Local uint16_t 3 elements array raw:</b> Raw Values of the sample being decoded. */
+        uint16_t raw[MLX90614_NUMBER_OF_CHANNELS];
+        for (uint8_t channel=MLX90614_Ch_Ta; channel<MLX90614_NUMBER_OF_CHANNELS; channel++, pos+=2)
+        {
+            raw[channel] = log[pos] | (log[pos + 1] << 8);
+        }
+        /** <b>Local uint8_t variable i:</b> Index, within its block, of the sample being decoded. */
+        uint8_t i = 0;
+        for (;;)
+        {
+            for (uint8_t channel=MLX90614_Ch_Ta; channel<MLX90614_NUMBER_OF_CHANNELS; channel++)
+            {
+                dst[decoded + i].raw[channel] = raw[channel];
+                dst[decoded + i].temperature[channel] = MLX90614_CONVERT_RAW_TEMPERATURE(p_converter, raw[channel]);
+            }
+            if (++i == count)
+            {
+                break;
+            }
+            /** <b>Local uint8_t variable is_truncated:</b> Flag indicating whether a varint of the sample being decoded could not be read. */
+            uint8_t is_truncated = 0;
+            for (uint8_t channel=MLX90614_Ch_Ta; channel<MLX90614_NUMBER_OF_CHANNELS; channel++)
+            {
+                /** <b>Local int32_t variable delta:</b> Difference of the Raw Value being decoded against the previous sample. */
+                int32_t delta;
+                /** <b>Local uint8_t variable n:</b> Number of bytes of the varint being decoded. */
+                uint8_t n = read_mlx90614_log_varint(&log[pos], length - pos, &delta);
+                if ((n == 0) || (n > MLX90614_LOG_MAX_VARINT_SIZE))
+                {
+                    is_truncated = 1;
+                    break;
+                }
+                pos += n;
+                raw[channel] = (uint16_t) (raw[channel] + delta);
+            }
+            if (is_truncated)
+            {
+                break;
+            }
+        }
+        if ((i != count) || (pos >= length) || (calculate_mlx90614_log_crc(&log[block_start], pos - block_start) != log[pos]))
+        {
+            *n_samples = decoded;
+            return MLX90614_EC_ERR; // The samples of a corrupted or truncated block are discarded.
+        }
+        pos++;
+        decoded += count;
+    }
+    *n_samples = decoded;
+
+    return (pos == length) ? MLX90614_EC_OK : MLX90614_EC_ERR;
+}
+
+MLX90614_Status init_mlx90614_scheduler(MLX90614_Scheduler *sched, MLX90614_Handle *hmlx, uint8_t channel, uint32_t tick_period_ms, uint32_t sampling_period_ms)
+{
+    if ((tick_period_ms == 0) || ((channel > MLX90614_Ch_Tobj2) && (channel != MLX90614_SCHEDULER_ALL_CHANNELS)))
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    /* Reading faster than the IIR and FIR Filters of the MLX90614 Device settle would only give back the same or half-settled RAM values. */
+    /** <b>Local MLX90614_IIR_t variable iir:</b> IIR Filter setting currently configured in the EEPROM of the MLX90614 Device. */
+    MLX90614_IIR_t iir = MLX90614_IIR_100;
+    /** <b>Local MLX90614_FIR_t variable fir:</b> FIR Filter setting currently configured in the EEPROM of the MLX90614 Device. */
+    MLX90614_FIR_t fir = MLX90614_FIR_1024;
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = get_mlx90614_handle_iir(hmlx, &iir);
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+    ret = get_mlx90614_handle_fir(hmlx, &fir);
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+    /** <b>Local uint32_t variable settling_time:</b> Time in milliseconds that the IIR and FIR Filters of the MLX90614 Device take to settle. */
+    uint32_t settling_time = get_mlx90614_settling_time(iir, fir);
+    if (sampling_period_ms < settling_time)
+    {
+        sampling_period_ms = settling_time;
+    }
+    if (sampling_period_ms < MLX90614_MIN_SAMPLING_PERIOD)
+    {
+        sampling_period_ms = MLX90614_MIN_SAMPLING_PERIOD;
+    }
+
+    sched->is_running = 0;
+    sched->hmlx = hmlx;
+    sched->channel = channel;
+    sched->period_ticks = (sampling_period_ms + tick_period_ms - 1) / tick_period_ms;
+    sched->countdown = 1;
+    sched->issued = 0;
+    sched->missed = 0;
+
+    return MLX90614_EC_OK;
+}
+
+void start_mlx90614_scheduler(MLX90614_Scheduler *sched)
+{
+    sched->countdown = 1;
+    sched->is_running = 1;
+}
+
+void stop_mlx90614_scheduler(MLX90614_Scheduler *sched)
+{
+    sched->is_running = 0;
+}
+
+void mlx90614_scheduler_tick_handler(MLX90614_Scheduler *sched)
+{
+    if (!sched->is_running || (--sched->countdown != 0))
+    {
+        return;
+    }
+    sched->countdown = sched->period_ticks;
+
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret;
+    if (sched->channel == MLX90614_SCHEDULER_ALL_CHANNELS)
+    {
+        ret = get_mlx90614_handle_all_temperatures_async(sched->hmlx, &sched->sample, NULL);
+    }
+    else
+    {
+        ret = start_mlx90614_async_temperature_reading(sched->hmlx, sched->channel, NULL);
+    }
+
+    if (ret == MLX90614_EC_OK)
+    {
+        sched->issued++;
+    }
+    else
+    {
+        sched->missed++;
+    }
+}
+
+uint32_t get_mlx90614_scheduler_period(MLX90614_Scheduler *sched)
+{
+    return sched->period_ticks;
+}
+
+MLX90614_Status sleep_mlx90614_handle(MLX90614_Handle *hmlx, const MLX90614_Bus_Recovery *pins)
+{
+    /** <b>Local uint8_t array sleep_command:</b> Sleep command followed by its PEC byte, which is calculated over the slave address with the write bit and the command. */
+    uint8_t sleep_command[MLX90614_SLEEP_COMMAND_SIZE];
+    sleep_command[0] = MLX90614_SLEEP_COMMAND;
+    sleep_command[1] = calculate_pec(calculate_pec(MLX90614_PEC_RESET_VALUE, hmlx->slave_address_one_bit_left_shifted), MLX90614_SLEEP_COMMAND);
+
+    MLX90614_STATS_BEGIN(start);
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = HAL_ret_handler(HAL_I2C_Master_Transmit(hmlx->hi2c, hmlx->slave_address_one_bit_left_shifted, sleep_command, MLX90614_SLEEP_COMMAND_SIZE, hmlx->retry_policy.timeout_ms));
+    MLX90614_STATS_END(MLX90614_STATS_OP_HAL_MASTER_TRANSMIT, start);
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+    hmlx->cache_valid = 0; // The RAM of the MLX90614 Device will be refreshed from scratch once it wakes up.
+
+    if (pins != NULL)
+    {
+        take_mlx90614_bus_pins(hmlx->hi2c, pins);
+        HAL_GPIO_WritePin(pins->scl_port, pins->scl_pin, GPIO_PIN_RESET);
+    }
+
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Status wake_mlx90614_handle(MLX90614_Handle *hmlx, const MLX90614_Bus_Recovery *pins)
+{
+    if (pins == NULL)
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    begin_mlx90614_wake_pulse(hmlx->hi2c, pins);
+    HAL_Delay(MLX90614_WAKE_PULSE_TIME);
+    return end_mlx90614_wake_pulse(hmlx->hi2c, pins);
+}
+
+MLX90614_Status init_mlx90614_duty_cycle(MLX90614_Duty_Cycle *dc, MLX90614_Handle *hmlx, const MLX90614_Bus_Recovery *pins, uint32_t sampling_period_ms, MLX90614_Sample_Callback callback)
+{
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret;
+    /** <b>Local MLX90614_IIR_t variable iir:</b> IIR Filter setting currently configured in the MLX90614 Device. */
+    MLX90614_IIR_t iir = MLX90614_IIR_100;
+    /** <b>Local MLX90614_FIR_t variable fir:</b> FIR Filter setting currently configured in the MLX90614 Device. */
+    MLX90614_FIR_t fir = MLX90614_FIR_1024;
+
+    if (pins == NULL)
+    {
+        return MLX90614_EC_ERR;
+    }
+    ret = get_mlx90614_handle_iir(hmlx, &iir);
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+    ret = get_mlx90614_handle_fir(hmlx, &fir);
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+    /** <b>Local uint32_t variable lead_time:</b> Time in milliseconds that the IIR and FIR Filters of the MLX90614 Device take to settle after having been woken up. */
+    uint32_t lead_time = get_mlx90614_settling_time(iir, fir);
+    if (sampling_period_ms <= (MLX90614_WAKE_PULSE_TIME + lead_time))
+    {
+        return MLX90614_EC_ERR; // The MLX90614 Device would have to be woken up again right after each sample.
+    }
+
+    dc->hmlx = hmlx;
+    dc->p_pins = pins;
+    dc->sampling_period_ms = sampling_period_ms;
+    dc->lead_time_ms = lead_time;
+    dc->stage = MLX90614_DUTY_CYCLE_STAGE_STOPPED;
+    dc->p_callback = callback;
+    dc->completed = 0;
+    dc->failed = 0;
+
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Status start_mlx90614_duty_cycle(MLX90614_Duty_Cycle *dc)
+{
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = sleep_mlx90614_handle(dc->hmlx, dc->p_pins);
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+    dc->next_sample_tick = HAL_GetTick() + dc->sampling_period_ms;
+    dc->stage = MLX90614_DUTY_CYCLE_STAGE_SLEEPING;
+
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Status stop_mlx90614_duty_cycle(MLX90614_Duty_Cycle *dc)
+{
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = MLX90614_EC_OK;
+    if ((dc->stage == MLX90614_DUTY_CYCLE_STAGE_SLEEPING) || (dc->stage == MLX90614_DUTY_CYCLE_STAGE_WAKING))
+    {
+        ret = wake_mlx90614_handle(dc->hmlx, dc->p_pins);
+    }
+    dc->stage = MLX90614_DUTY_CYCLE_STAGE_STOPPED;
+
+    return ret;
+}
+
+MLX90614_Status pump_mlx90614_duty_cycle(MLX90614_Duty_Cycle *dc)
+{
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret;
+    /** <b>Local uint32_t variable now:</b> Value of @ref HAL_GetTick at the moment of this call. */
+    uint32_t now = HAL_GetTick();
+
+    // NOTE: The differences between ticks are compared as signed values so that they keep working when @ref HAL_GetTick wraps around.
+    switch (dc->stage)
+    {
+        case MLX90614_DUTY_CYCLE_STAGE_SLEEPING:
+            if ((int32_t) (now - (dc->next_sample_tick - dc->lead_time_ms - MLX90614_WAKE_PULSE_TIME)) < 0)
+            {
+                return MLX90614_EC_NA;
+            }
+            begin_mlx90614_wake_pulse(dc->hmlx->hi2c, dc->p_pins);
+            dc->stage_tick = now;
+            dc->stage = MLX90614_DUTY_CYCLE_STAGE_WAKING;
+            return MLX90614_EC_NA;
+        case MLX90614_DUTY_CYCLE_STAGE_WAKING:
+            if ((now - dc->stage_tick) < MLX90614_WAKE_PULSE_TIME)
+            {
+                return MLX90614_EC_NA;
+            }
+            ret = end_mlx90614_wake_pulse(dc->hmlx->hi2c, dc->p_pins);
+            if (ret != MLX90614_EC_OK)
+            {
+                break;
+            }
+            dc->stage = MLX90614_DUTY_CYCLE_STAGE_SETTLING;
+            return MLX90614_EC_NA;
+        case MLX90614_DUTY_CYCLE_STAGE_SETTLING:
+            if ((int32_t) (now - dc->next_sample_tick) < 0)
+            {
+                return MLX90614_EC_NA;
+            }
+            ret = get_mlx90614_handle_all_temperatures(dc->hmlx, &dc->sample);
+            break;
+        default:
+            return MLX90614_EC_STOP;
+    }
+
+    /* Concluding the current sampling period by reporting its sample and putting the MLX90614 Device back to sleep. */
+    if (ret == MLX90614_EC_OK)
+    {
+        dc->completed++;
+    }
+    else
+    {
+        dc->failed++;
+    }
+    if (dc->p_callback != NULL)
+    {
+        (*dc->p_callback)(dc->hmlx, ret, &dc->sample);
+    }
+    dc->next_sample_tick += dc->sampling_period_ms;
+    if ((int32_t) (now - dc->next_sample_tick) >= 0)
+    {
+        dc->next_sample_tick = now + dc->sampling_period_ms; // The missed sampling periods are skipped instead of being caught up.
+    }
+    dc->stage = MLX90614_DUTY_CYCLE_STAGE_SLEEPING;
+    /** <b>Local int8_t variable sleep_ret:</b> Return value of @ref sleep_mlx90614_handle . */
+    uint8_t sleep_ret = sleep_mlx90614_handle(dc->hmlx, dc->p_pins);
+
+    return (ret == MLX90614_EC_OK) ? sleep_ret : ret;
+}
+
+void init_mlx90614_multi_bus(MLX90614_Multi_Bus *mb, MLX90614_Sample_Callback callback)
+{
+    mb->lane_count = 0;
+    mb->p_callback = callback;
+    mb->completed = 0;
+    mb->failed = 0;
+    mb->is_single_sweep = 0;
+}
+
+MLX90614_Status add_mlx90614_multi_bus_lane(MLX90614_Multi_Bus *mb, MLX90614_Handle *const *handles, MLX90614_Sample *samples, uint8_t count)
+{
+    if ((mb->lane_count >= MLX90614_MAX_NUMBER_OF_ASYNC_I2C) || (count == 0) || (count > MLX90614_MULTI_BUS_MAX_LANE_HANDLES))
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    /* Validate that all the given MLX90614 Handles share an I2C Peripheral that no other Lane uses. */
+    /** <b>Local pointer hi2c:</b> Points to the I2C Peripheral of the Lane that wants to be added. */
+    I2C_HandleTypeDef *hi2c = handles[0]->hi2c;
+    for (uint8_t i=1; i<count; i++)
+    {
+        if (handles[i]->hi2c != hi2c)
+        {
+            return MLX90614_EC_ERR;
+        }
+    }
+    for (uint8_t i=0; i<mb->lane_count; i++)
+    {
+        if (mb->lane[i].p_handles[0]->hi2c == hi2c)
+        {
+            return MLX90614_EC_ERR;
+        }
+    }
+
+    /** <b>Local pointer lane:</b> Points to the Lane that is being added. */
+    MLX90614_Bus_Lane *lane = &mb->lane[mb->lane_count];
+    lane->p_handles = handles;
+    lane->p_samples = samples;
+    lane->count = count;
+    lane->next = 0;
+    lane->is_issued = 0;
+    lane->valid_mask = 0;
+    lane->sweeps = 0;
+    mb->lane_count++;
+
+    return MLX90614_EC_OK;
+}
+
+uint8_t pump_mlx90614_multi_bus(MLX90614_Multi_Bus *mb)
+{
+    /** <b>Local uint8_t variable in_process:</b> Number of Lanes that have a reading in process. */
+    uint8_t in_process = 0;
+    for (uint8_t i=0; i<mb->lane_count; i++)
+    {
+        /** <b>Local pointer lane:</b> Points to the Lane that is being advanced. */
+        MLX90614_Bus_Lane *lane = &mb->lane[i];
+        /** <b>Local pointer hmlx:</b> Points to the MLX90614 Handle of the Lane that is either being read or that will be read next. */
+        MLX90614_Handle *hmlx = lane->p_handles[lane->next];
+
+        if (mb->is_single_sweep && (lane->sweeps != 0))
+        {
+            continue;
+        }
+        if (lane->is_issued)
+        {
+            if (hmlx->async_state == MLX90614_ASYNC_BUSY)
+            {
+                in_process++;
+                continue;
+            }
+
+            /* Collect the concluded reading and move on to the next MLX90614 Device of this Lane. */
+            lane->is_issued = 0;
+            if (hmlx->async_status == MLX90614_EC_OK)
+            {
+                lane->valid_mask |= (1UL << lane->next);
+                mb->completed++;
+            }
+            else
+            {
+                lane->valid_mask &= ~(1UL << lane->next);
+                mb->failed++;
+            }
+            if (mb->p_callback != NULL)
+            {
+                (*mb->p_callback)(hmlx, hmlx->async_status, &lane->p_samples[lane->next]);
+            }
+            if (++lane->next == lane->count)
+            {
+                lane->next = 0;
+                lane->sweeps++;
+                if (mb->is_single_sweep)
+                {
+                    continue;
+                }
+            }
+            hmlx = lane->p_handles[lane->next];
+        }
+
+        /** <b>Local MLX90614_Status variable ret:</b> Whether the reading of the next MLX90614 Device of this Lane could be requested. */
+        MLX90614_Status ret = get_mlx90614_handle_all_temperatures_async(hmlx, &lane->p_samples[lane->next], NULL);
+        if (ret == MLX90614_EC_OK)
+        {
+            lane->is_issued = 1;
+            in_process++;
+        }
+        else
+        {
+            lane->valid_mask &= ~(1UL << lane->next);
+            mb->failed++;
+            if (mb->p_callback != NULL)
+            {
+                (*mb->p_callback)(hmlx, ret, &lane->p_samples[lane->next]);
+            }
+            if (++lane->next == lane->count)
+            {
+                lane->next = 0;
+                lane->sweeps++;
+            }
+        }
+    }
+
+    return in_process;
+}
+
+MLX90614_Status aggregate_mlx90614_handles(MLX90614_Handle *const *handles, uint8_t count, MLX90614_Channel_t channel, MLX90614_Aggregate *dst)
+{
+    /** <b>Local pointer array grouped:</b> Holds the given MLX90614 Handles grouped by their I2C Peripheral, so that each group can be a Lane of a Multi Bus. */
+    MLX90614_Handle *grouped[MLX90614_AGGREGATE_MAX_HANDLES];
+    /** <b>Local uint8_t array origin:</b> Index in \p handles of each MLX90614 Handle of \c grouped . */
+    uint8_t origin[MLX90614_AGGREGATE_MAX_HANDLES];
+    /** <b>Local MLX90614_Sample array samples:</b> Samples of the Lanes, indexed in the same way as \c grouped . */
+    MLX90614_Sample samples[MLX90614_AGGREGATE_MAX_HANDLES];
+    /** <b>Local MLX90614_Multi_Bus variable mb:</b> Multi Bus through which all the MLX90614 Devices are read at once. */
+    MLX90614_Multi_Bus mb;
+    /** <b>Local uint8_t variable n_grouped:</b> Number of MLX90614 Handles that have already been grouped. */
+    uint8_t n_grouped = 0;
+    /** <b>Local uint8_t variable lane_start:</b> Index in \c grouped of the first MLX90614 Handle of the current Lane. */
+    uint8_t lane_start;
+
+    if ((count == 0) || (count > MLX90614_AGGREGATE_MAX_HANDLES) || (channel > MLX90614_Ch_Tobj2))
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    /* Group the MLX90614 Handles by their I2C Peripheral, where each group is added as a Lane of the Multi Bus. */
+    init_mlx90614_multi_bus(&mb, NULL);
+    mb.is_single_sweep = 1;
+    for (uint8_t i=0; i<count; i++)
+    {
+        /** <b>Local uint8_t variable is_grouped:</b> Flag indicating whether the I2C Peripheral of the current MLX90614 Handle has already been grouped. */
+        uint8_t is_grouped = 0;
+        for (uint8_t j=0; j<i; j++)
+        {
+            if (handles[j]->hi2c == handles[i]->hi2c)
+            {
+                is_grouped = 1;
+                break;
+            }
+        }
+        if (is_grouped)
+        {
+            continue;
+        }
+        /** <b>Local uint8_t variable first:</b> Index in \c grouped of the first MLX90614 Handle of the current group. */
+        uint8_t first = n_grouped;
+        for (uint8_t j=i; j<count; j++)
+        {
+            if (handles[j]->hi2c == handles[i]->hi2c)
+            {
+                grouped[n_grouped] = handles[j];
+                origin[n_grouped++] = j;
+            }
+        }
+        if (add_mlx90614_multi_bus_lane(&mb, &grouped[first], &samples[first], n_grouped - first) != MLX90614_EC_OK)
+        {
+            return MLX90614_EC_ERR;
+        }
+    }
+
+    /* Since each Lane reads its MLX90614 Devices one after the other, the slowest Lane may take the sum of their timeouts. */
+    /** <b>Local uint32_t variable deadline:</b> Time in milliseconds after which the readings still in process are aborted. */
+    uint32_t deadline = 0;
+    lane_start = 0;
+    for (uint8_t i=0; i<mb.lane_count; i++)
+    {
+        /** <b>Local uint32_t variable lane_timeout:</b> Sum of the timeouts of the MLX90614 Handles of the current Lane. */
+        uint32_t lane_timeout = 0;
+        for (uint8_t k=0; k<mb.lane[i].count; k++)
+        {
+            lane_timeout += grouped[lane_start + k]->retry_policy.timeout_ms;
+        }
+        if (lane_timeout > deadline)
+        {
+            deadline = lane_timeout;
+        }
+        lane_start += mb.lane[i].count;
+    }
+
+    /* Read every MLX90614 Device once, with all the Lanes transferring in parallel. */
+    /** <b>Local uint32_t variable tickstart:</b> Value of @ref HAL_GetTick at the moment in which the readings were started. */
+    uint32_t tickstart = HAL_GetTick();
+    /** <b>Local uint8_t variable is_done:</b> Flag indicating whether all the Lanes have read all of their MLX90614 Devices. */
+    uint8_t is_done;
+    do
+    {
+        pump_mlx90614_multi_bus(&mb);
+        is_done = 1;
+        for (uint8_t i=0; i<mb.lane_count; i++)
+        {
+            if (mb.lane[i].sweeps == 0)
+            {
+                is_done = 0;
+                break;
+            }
+        }
+        if (!is_done && ((HAL_GetTick() - tickstart) > deadline))
+        {
+            /* Give up on the Lanes that are still reading, whose remaining MLX90614 Devices are then left out of the statistics. */
+            for (uint8_t i=0; i<mb.lane_count; i++)
+            {
+                /** <b>Local pointer lane:</b> Points to the Lane that is being given up on. */
+                MLX90614_Bus_Lane *lane = &mb.lane[i];
+                if (lane->sweeps != 0)
+                {
+                    continue;
+                }
+                if (lane->is_issued)
+                {
+                    abort_mlx90614_async_reading(lane->p_handles[lane->next]);
+                    lane->is_issued = 0;
+                }
+                lane->valid_mask &= (1UL << lane->next) - 1;
+                lane->sweeps = 1;
+            }
+            break;
+        }
+    } while (!is_done);
+
+    /* Gather the valid Raw Values in ascending order, which is the fastest approach for such a small number of them. */
+    /** <b>Local uint16_t array sorted:</b> Holds the valid Raw Values in ascending order. */
+    uint16_t sorted[MLX90614_AGGREGATE_MAX_HANDLES];
+    /** <b>Local uint8_t variable n:</b> Number of valid Raw Values. */
+    uint8_t n = 0;
+    /** <b>Local uint32_t variable sum:</b> Sum of the valid Raw Values. */
+    uint32_t sum = 0;
+    lane_start = 0;
+    dst->valid_mask = 0;
+    for (uint8_t i=0; i<mb.lane_count; i++)
+    {
+        for (uint8_t k=0; k<mb.lane[i].count; k++)
+        {
+            /** <b>Local uint16_t variable raw:</b> Raw Value of the requested temperature channel of the current MLX90614 Device. */
+            uint16_t raw = samples[lane_start + k].raw[channel];
+            if (!(mb.lane[i].valid_mask & (1UL << k)) || (raw & MLX90614_RAW_ERROR_FLAG))
+            {
+                continue; // Either the MLX90614 Device did not respond, it raised an Error Flag or its PEC validation failed.
+            }
+            dst->valid_mask |= (1UL << origin[lane_start + k]);
+            sum += raw;
+            /** <b>Local uint8_t variable j:</b> Index at which the current Raw Value is being inserted into \c sorted . */
+            uint8_t j = n++;
+            for (; (j > 0) && (sorted[j-1] > raw); j--)
+            {
+                sorted[j] = sorted[j-1];
+            }
+            sorted[j] = raw;
+        }
+        lane_start += mb.lane[i].count;
+    }
+    dst->valid_count = n;
+    if (n == 0)
+    {
+        return MLX90614_EC_NR;
+    }
+
+    dst->mean_raw = (sum + (n >> 1)) / n;
+    dst->median_raw = (sorted[(n - 1) >> 1] + sorted[n >> 1]) >> 1;
+    /* NOTE: Since the Raw Values are sorted, the farthest one from the median is either the smallest or the largest one. */
+    /** <b>Local uint16_t variable below:</b> Distance from the smallest valid Raw Value to the median. */
+    uint16_t below = dst->median_raw - sorted[0];
+    /** <b>Local uint16_t variable above:</b> Distance from the largest valid Raw Value to the median. */
+    uint16_t above = sorted[n - 1] - dst->median_raw;
+    dst->max_deviation_raw = (below > above) ? below : above;
+
+    return MLX90614_EC_OK;
+}
+
+#ifdef HAL_TIM_MODULE_ENABLED
+MLX90614_Status init_mlx90614_pwm(MLX90614_PWM *pwm, TIM_HandleTypeDef *htim, uint32_t period_channel, uint32_t high_channel, uint16_t to_max, uint16_t to_min, MLX90614_Temp_t temp_t)
+{
+    /** <b>Local pointer p_converter:</b> Points to the function that converts a Raw Value into the given Temperature Type. */
+    float (*p_converter)(uint16_t raw_temp) = get_mlx90614_temperature_converter(temp_t);
+    if ((p_converter == NULL) || (to_max <= to_min))
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    pwm->htim = htim;
+    pwm->period_channel = period_channel;
+    pwm->high_channel = high_channel;
+    pwm->to_max = to_max;
+    pwm->to_min = to_min;
+    pwm->temperature_type = temp_t;
+    pwm->p_get_converted_temperature = p_converter;
+    pwm->p_filter = NULL;
+
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = HAL_ret_handler(HAL_TIM_IC_Start(htim, period_channel));
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+
+    return HAL_ret_handler(HAL_TIM_IC_Start(htim, high_channel));
+}
+
+MLX90614_Status stop_mlx90614_pwm(MLX90614_PWM *pwm)
+{
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = HAL_ret_handler(HAL_TIM_IC_Stop(pwm->htim, pwm->high_channel));
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+
+    return HAL_ret_handler(HAL_TIM_IC_Stop(pwm->htim, pwm->period_channel));
+}
+
+void set_mlx90614_pwm_filter(MLX90614_PWM *pwm, MLX90614_Filter *filter)
+{
+    pwm->p_filter = filter;
+}
+
+MLX90614_Status get_mlx90614_pwm_raw_temperature(MLX90614_PWM *pwm, uint16_t *dst)
+{
+    /** <b>Local uint32_t variable period:</b> Period of the latest PWM cycle in ticks of the Hardware Timer. */
+    uint32_t period = HAL_TIM_ReadCapturedValue(pwm->htim, pwm->period_channel);
+    /** <b>Local uint32_t variable high_time:</b> High time of the latest PWM cycle in ticks of the Hardware Timer. */
+    uint32_t high_time = HAL_TIM_ReadCapturedValue(pwm->htim, pwm->high_channel);
+    /** <b>Local uint32_t variable start_mark:</b> Start mark (i.e., \f$t_{1}\f$ ) of the latest PWM cycle in ticks of the Hardware Timer. */
+    uint32_t start_mark = period >> MLX90614_PWM_START_MARK_SHIFT;
+    /** <b>Local uint32_t variable centi_kelvin:</b> Measured temperature in hundredths of Kelvin. */
+    uint32_t centi_kelvin;
+    /** <b>Local uint16_t variable raw_temp:</b> Measured temperature as a Raw Value. */
+    uint16_t raw_temp;
+
+    if (period == 0)
+    {
+        return MLX90614_EC_NA;
+    }
+    /* According to the MLX90614 Datasheet, the temperature is only encoded in the high time that comes after the start mark and up to half of the period. */
+    if ((high_time < start_mark) || ((high_time - start_mark) > (period >> 1)))
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    // NOTE: The product is made in 64 bits since it can exceed 32 bits with a long PWM period and a wide temperature range.
+    centi_kelvin = (uint32_t) ((((uint64_t) (high_time - start_mark)) * 2U * (pwm->to_max - pwm->to_min)) / period) + pwm->to_min;
+    raw_temp = (uint16_t) ((centi_kelvin + (MLX90614_CENTI_KELVIN_PER_RAW_UNIT/2)) / MLX90614_CENTI_KELVIN_PER_RAW_UNIT);
+
+    if (pwm->p_filter != NULL)
+    {
+        raw_temp = update_mlx90614_filter(pwm->p_filter, raw_temp);
+    }
+    *dst = raw_temp;
+
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Status get_mlx90614_pwm_temperature(MLX90614_PWM *pwm, float *dst)
+{
+    /** <b>Local uint16_t variable raw_temp:</b> Measured temperature as a Raw Value. */
+    uint16_t raw_temp;
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = get_mlx90614_pwm_raw_temperature(pwm, &raw_temp);
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+    *dst = MLX90614_CONVERT_RAW_TEMPERATURE(pwm->p_get_converted_temperature, raw_temp);
+
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Status get_mlx90614_pwm_centi_temperature(MLX90614_PWM *pwm, int32_t *dst)
+{
+    /** <b>Local uint16_t variable raw_temp:</b> Measured temperature as a Raw Value. */
+    uint16_t raw_temp;
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = get_mlx90614_pwm_raw_temperature(pwm, &raw_temp);
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+    *dst = get_mlx90614_converted_centi_temperature(raw_temp, pwm->temperature_type);
+
+    return MLX90614_EC_OK;
+}
+#endif
+
+#if (MLX90614_ENABLE_RTOS)
+MLX90614_Status init_mlx90614_rtos_bus(MLX90614_RTOS_Bus *bus, const MLX90614_RTOS_Port *p_port, void *queue)
+{
+    if ((p_port==NULL) || (queue==NULL) || (p_port->p_queue_send==NULL) || (p_port->p_queue_receive==NULL)
+            || (p_port->p_get_current_task==NULL) || (p_port->p_notify_task==NULL) || (p_port->p_wait_notification==NULL))
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    bus->p_port = p_port;
+    bus->queue = queue;
+    bus->serviced = 0;
+
+    return MLX90614_EC_OK;
+}
+
+MLX90614_Status submit_mlx90614_rtos_request(MLX90614_RTOS_Bus *bus, MLX90614_RTOS_Operation p_operation, MLX90614_Handle *hmlx, void *arg, uint32_t timeout)
+{
+    /** <b>Local MLX90614_RTOS_Request variable request:</b> Request that will be serviced by the bus-owner task, which lives in the stack of the calling task until it has been serviced. */
+    MLX90614_RTOS_Request request;
+    request.p_operation = p_operation;
+    request.hmlx = hmlx;
+    request.arg = arg;
+    request.p_task = (*bus->p_port->p_get_current_task)();
+    request.status = MLX90614_EC_ERR;
+    request.is_done = 0;
+
+    if ((*bus->p_port->p_queue_send)(bus->queue, &request, timeout) != MLX90614_EC_OK)
+    {
+        return MLX90614_EC_NR;
+    }
+
+    /* Waiting until the bus-owner task has serviced the Request, since it must not leave the stack before that. */
+    while (!request.is_done)
+    {
+        (*bus->p_port->p_wait_notification)(MLX90614_RTOS_WAIT_FOREVER);
+    }
+
+    return request.status;
+}
+
+MLX90614_Status get_mlx90614_rtos_all_temperatures(MLX90614_RTOS_Bus *bus, MLX90614_Handle *hmlx, MLX90614_Sample *dst, uint32_t timeout)
+{
+    return submit_mlx90614_rtos_request(bus, &get_mlx90614_rtos_all_temperatures_operation, hmlx, dst, timeout);
+}
+
+MLX90614_Status service_mlx90614_rtos_bus(MLX90614_RTOS_Bus *bus, uint32_t timeout)
+{
+    /** <b>Local pointer p_request:</b> Points to the Request to be serviced. */
+    MLX90614_RTOS_Request *p_request;
+    if ((*bus->p_port->p_queue_receive)(bus->queue, &p_request, timeout) != MLX90614_EC_OK)
+    {
+        return MLX90614_EC_NR;
+    }
+
+    p_request->status = (*p_request->p_operation)(p_request->hmlx, p_request->arg);
+    bus->serviced++;
+    /** <b>Local pointer p_task:</b> Handle of the task of the Request, which is fetched before flagging it as serviced since the Request may leave the stack of that task right after. */
+    void *p_task = p_request->p_task;
+    p_request->is_done = 1;
+    (*bus->p_port->p_notify_task)(p_task);
+
+    return MLX90614_EC_OK;
+}
+
+void mlx90614_rtos_bus_task(void *argument)
+{
+    for (;;)
+    {
+        service_mlx90614_rtos_bus((MLX90614_RTOS_Bus *) argument, MLX90614_RTOS_WAIT_FOREVER);
+    }
+}
+
+static MLX90614_Status get_mlx90614_rtos_all_temperatures_operation(MLX90614_Handle *hmlx, void *arg)
+{
+    return get_mlx90614_handle_all_temperatures(hmlx, (MLX90614_Sample *) arg);
+}
+#endif
+
+#if (MLX90614_ENABLE_BENCHMARK)
+MLX90614_Status run_mlx90614_benchmark_case(MLX90614_Handle *hmlx, MLX90614_Benchmark_Case bench_case, uint32_t iterations, MLX90614_Benchmark_Result *dst)
+{
+    if ((hmlx==NULL) || (dst==NULL) || (iterations==0) || (bench_case>=MLX90614_BENCHMARK_NUMBER_OF_CASES))
+    {
+        return MLX90614_EC_ERR;
+    }
+#if (!MLX90614_ENABLE_SCAN)
+    if (bench_case == MLX90614_BENCHMARK_SCAN)
+    {
+        return MLX90614_EC_NA;
+    }
+#else
+    /** <b>Local MLX90614_Scan_Result variable scan:</b> Scan Result filled by each iteration of the scan case. */
+    MLX90614_Scan_Result scan;
+#endif
+    /** <b>Local uint16_t array raw:</b> Raw Values converted by each iteration of the conversion cases. */
+    uint16_t raw[MLX90614_BENCHMARK_BATCH_SIZE];
+    /** <b>Local float array temperatures:</b> Temperatures given back by each iteration of the float conversion case. */
+    float temperatures[MLX90614_BENCHMARK_BATCH_SIZE];
+    /** <b>Local int32_t array centi_temperatures:</b> Temperatures given back by each iteration of the integer conversion case. */
+    int32_t centi_temperatures[MLX90614_BENCHMARK_BATCH_SIZE];
+    /** <b>Local MLX90614_Sample variable sample:</b> Sample filled by each iteration of the burst cases. */
+    MLX90614_Sample sample;
+    /** <b>Local float variable temperature:</b> Temperature given back by each iteration of the single channel cases. */
+    float temperature;
+    /** <b>Local int32_t variable centi_temperature:</b> Temperature given back by each iteration of the integer single channel case. */
+    int32_t centi_temperature;
+    /** <b>Local volatile int32_t variable sink:</b> Receives the last result of every iteration so that the compiler cannot drop any of the conversions being measured. */
+    volatile int32_t sink = 0;
+    /** <b>Local uint32_t variable freshness_window:</b> Freshness Window of \p hmlx , which is restored once the case has concluded. */
+    uint32_t freshness_window = hmlx->freshness_window;
+    /** <b>Local uint32_t variable start:</b> Value of @ref MLX90614_CYCLE_COUNTER at the start of the current iteration. */
+    uint32_t start;
+    /** <b>Local uint32_t variable issued:</b> Value of @ref MLX90614_CYCLE_COUNTER right after an Asynchronous reading has been requested. */
+    uint32_t issued;
+    /** <b>Local uint32_t variable waited:</b> CPU cycles during which the current iteration has been waiting for an Asynchronous reading to conclude (i.e., outside of the @ref mlx90614 ). */
+    uint32_t waited;
+    /** <b>Local uint32_t variable elapsed:</b> CPU cycles that the current iteration took from its start until its temperatures were available. */
+    uint32_t elapsed;
+    /** <b>Local uint32_t variable samples:</b> Number of samples obtained by the current iteration. */
+    uint32_t samples;
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type of the current iteration. */
+    uint8_t ret;
+    /** <b>Local int8_t variable status:</b> @ref MLX90614_Status Exception Code with which this function will conclude, unless no sample is obtained. */
+    uint8_t status = MLX90614_EC_OK;
+
+    for (uint32_t i=0; i<MLX90614_BENCHMARK_BATCH_SIZE; i++)
+    {
+        raw[i] = (uint16_t) (MLX90614_BENCHMARK_FIRST_RAW_VALUE + i);
+    }
+    dst->samples = 0;
+    dst->errors = 0;
+    dst->total_cycles = 0;
+    dst->cpu_cycles = 0;
+    dst->cycles_per_sample = 0;
+    dst->cpu_cycles_per_sample = 0;
+    dst->samples_per_second = 0;
+
+    /* Disabling the Freshness Cache, since otherwise most of the samples would be served without any I2C transaction. */
+    hmlx->freshness_window = 0;
+    for (uint32_t i=0; (i<iterations) && (status==MLX90614_EC_OK); i++)
+    {
+        samples = 1;
+        waited = 0;
+        start = MLX90614_CYCLE_COUNTER();
+        switch (bench_case)
+        {
+            case MLX90614_BENCHMARK_BLOCKING_FLOAT:
+                ret = get_mlx90614_handle_object1_temperature(hmlx, &temperature);
+                break;
+            case MLX90614_BENCHMARK_BLOCKING_CENTI:
+                ret = get_mlx90614_handle_object1_centi_temperature(hmlx, &centi_temperature);
+                sink = centi_temperature;
+                break;
+            case MLX90614_BENCHMARK_BLOCKING_BURST:
+                ret = get_mlx90614_handle_all_temperatures(hmlx, &sample);
+                break;
+            case MLX90614_BENCHMARK_ASYNC_SINGLE:
+                ret = get_mlx90614_handle_object1_temperature_async(hmlx, NULL);
+                if (ret == MLX90614_EC_OK)
+                {
+                    issued = MLX90614_CYCLE_COUNTER();
+                    status = wait_mlx90614_benchmark_async_reading(hmlx, 1);
+                    waited = MLX90614_CYCLE_COUNTER() - issued;
+                    ret = get_mlx90614_handle_async_temperature(hmlx, &temperature);
+                }
+                break;
+            case MLX90614_BENCHMARK_ASYNC_BURST:
+                ret = get_mlx90614_handle_all_temperatures_async(hmlx, &sample, NULL);
+                if (ret == MLX90614_EC_OK)
+                {
+                    issued = MLX90614_CYCLE_COUNTER();
+                    status = wait_mlx90614_benchmark_async_reading(hmlx, MLX90614_NUMBER_OF_CHANNELS);
+                    waited = MLX90614_CYCLE_COUNTER() - issued;
+                    ret = get_mlx90614_handle_async_temperature(hmlx, &temperature);
+                }
+                break;
+            case MLX90614_BENCHMARK_CONVERT_FLOAT:
+                ret = mlx90614_convert_batch(raw, temperatures, MLX90614_BENCHMARK_BATCH_SIZE, hmlx->temperature_type);
+                sink = (int32_t) temperatures[MLX90614_BENCHMARK_BATCH_SIZE - 1];
+                samples = MLX90614_BENCHMARK_BATCH_SIZE;
+                break;
+            case MLX90614_BENCHMARK_CONVERT_CENTI:
+                ret = mlx90614_convert_centi_batch(raw, centi_temperatures, MLX90614_BENCHMARK_BATCH_SIZE, hmlx->temperature_type);
+                sink = centi_temperatures[MLX90614_BENCHMARK_BATCH_SIZE - 1];
+                samples = MLX90614_BENCHMARK_BATCH_SIZE;
+                break;
+            default:
+#if (MLX90614_ENABLE_SCAN)
+                ret = scan_mlx90614_bus(hmlx->hi2c, &scan, MLX90614_SCAN_PROBE_TIMEOUT, 1);
+#else
+                ret = MLX90614_EC_NA;
+#endif
+                break;
+        }
+        elapsed = MLX90614_CYCLE_COUNTER() - start;
+
+        if ((status!=MLX90614_EC_OK) || (ret!=MLX90614_EC_OK))
+        {
+            dst->errors++;
+            continue;
+        }
+        dst->samples += samples;
+        dst->total_cycles += elapsed;
+        dst->cpu_cycles += elapsed - waited;
+    }
+    hmlx->freshness_window = freshness_window;
+    (void) sink;
+
+    if (dst->samples == 0)
+    {
+        return (status == MLX90614_EC_OK) ? MLX90614_EC_NR : status;
+    }
+    dst->cycles_per_sample = (uint32_t) (dst->total_cycles / dst->samples);
+    dst->cpu_cycles_per_sample = (uint32_t) (dst->cpu_cycles / dst->samples);
+    if (dst->total_cycles != 0)
+    {
+        dst->samples_per_second = (uint32_t) ((((uint64_t) MLX90614_BENCHMARK_CORE_CLOCK) * dst->samples) / dst->total_cycles);
+    }
+
+    return status;
+}
+
+#ifdef HAL_UART_MODULE_ENABLED
+MLX90614_Status run_mlx90614_benchmark(MLX90614_Handle *hmlx, UART_HandleTypeDef *huart, uint32_t iterations)
+{
+    /** <b>Local static const uint32_t array clock_speeds:</b> SMBus clocks, in Hertz, at which every case is run, which cover the whole 10kHz to 100kHz range of the SMBus interface of the MLX90614 Device. */
+    static const uint32_t clock_speeds[MLX90614_BENCHMARK_NUMBER_OF_CLOCK_SPEEDS] = {10000, 50000, 100000};
+
+    if ((hmlx==NULL) || (huart==NULL) || (iterations==0))
+    {
+        return MLX90614_EC_ERR;
+    }
+    /** <b>Local I2C_InitTypeDef variable i2c_init:</b> Initialization parameters of the I2C Peripheral of \p hmlx , which are restored once the Benchmark has concluded. */
+    I2C_InitTypeDef i2c_init = hmlx->hi2c->Init;
+    /** <b>Local uint8_t variable is_pec_check_enabled:</b> PEC validation of \p hmlx , which is restored once the Benchmark has concluded. */
+    uint8_t is_pec_check_enabled = hmlx->is_pec_check_enabled;
+    /** <b>Local MLX90614_Benchmark_Result variable result:</b> Measurements of the case being reported. */
+    MLX90614_Benchmark_Result result;
+    /** <b>Local char array line:</b> Buffer into which each line of the report is formatted. */
+    char line[MLX90614_BENCHMARK_LINE_SIZE];
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret;
+    /** <b>Local int8_t variable status:</b> @ref MLX90614_Status Exception Code with which this function will conclude. */
+    uint8_t status;
+
+    status = transmit_mlx90614_benchmark_line(huart, line, snprintf(line, sizeof(line),
+            "# MLX90614 benchmark: core_clock=%lu, pec=%s, async=%s, transport=%s, fixed_unit=%d, iterations=%lu\r\n",
+            (unsigned long) MLX90614_BENCHMARK_CORE_CLOCK, MLX90614_BENCHMARK_PEC_NAME, MLX90614_BENCHMARK_ASYNC_NAME,
+            MLX90614_BENCHMARK_TRANSPORT_NAME, (int) MLX90614_FIXED_UNIT, (unsigned long) iterations));
+    if (status == MLX90614_EC_OK)
+    {
+        status = transmit_mlx90614_benchmark_line(huart, line, snprintf(line, sizeof(line),
+                "clock_hz,case,pec_check,samples,errors,cycles_per_sample,cpu_cycles_per_sample,samples_per_second\r\n"));
+    }
+
+    for (uint8_t s=0; (s<MLX90614_BENCHMARK_NUMBER_OF_CLOCK_SPEEDS) && (status==MLX90614_EC_OK); s++)
+    {
+        MLX90614_BENCHMARK_SET_I2C_CLOCK(hmlx->hi2c, clock_speeds[s]);
+        if (HAL_I2C_Init(hmlx->hi2c) != HAL_OK)
+        {
+            status = MLX90614_EC_ERR;
+            break;
+        }
+
+        for (uint8_t is_pec_check=0; (is_pec_check<2) && (status==MLX90614_EC_OK); is_pec_check++)
+        {
+            set_mlx90614_handle_pec_check(hmlx, is_pec_check);
+            for (uint8_t c=0; (c<MLX90614_BENCHMARK_NUMBER_OF_CASES) && (status==MLX90614_EC_OK); c++)
+            {
+                /* The conversion and scan cases are the last ones and they are not affected by the PEC validation. */
+                if (is_pec_check && (c>=MLX90614_BENCHMARK_CONVERT_FLOAT))
+                {
+                    break;
+                }
+                ret = run_mlx90614_benchmark_case(hmlx, (MLX90614_Benchmark_Case) c, iterations, &result);
+                if (ret == MLX90614_EC_NA)
+                {
+                    continue; // This case is not available in this build.
+                }
+                if (ret == MLX90614_EC_ERR)
+                {
+                    status = MLX90614_EC_ERR;
+                }
+
+                ret = transmit_mlx90614_benchmark_line(huart, line, snprintf(line, sizeof(line),
+                        "%lu,%s,%u,%lu,%lu,%lu,%lu,%lu\r\n", (unsigned long) clock_speeds[s],
+                        get_mlx90614_benchmark_case_name((MLX90614_Benchmark_Case) c), (unsigned) is_pec_check,
+                        (unsigned long) result.samples, (unsigned long) result.errors,
+                        (unsigned long) result.cycles_per_sample, (unsigned long) result.cpu_cycles_per_sample,
+                        (unsigned long) result.samples_per_second));
+                if (ret != MLX90614_EC_OK)
+                {
+                    status = ret;
+                }
+            }
+        }
+    }
+
+    set_mlx90614_handle_pec_check(hmlx, is_pec_check_enabled);
+    hmlx->hi2c->Init = i2c_init;
+    if (HAL_I2C_Init(hmlx->hi2c) != HAL_OK)
+    {
+        status = MLX90614_EC_ERR;
+    }
+
+    return status;
+}
+#endif
+
+static MLX90614_Status wait_mlx90614_benchmark_async_reading(MLX90614_Handle *hmlx, uint32_t transactions)
+{
+    /** <b>Local uint32_t variable tickstart:</b> HAL tick at which the wait started. */
+    uint32_t tickstart = HAL_GetTick();
+    /** <b>Local uint32_t variable timeout:</b> Time in milliseconds that the Asynchronous reading is given to conclude. */
+    uint32_t timeout = transactions * hmlx->retry_policy.timeout_ms;
+
+    while (hmlx->async_state == MLX90614_ASYNC_BUSY)
+    {
+        if ((HAL_GetTick() - tickstart) > timeout)
+        {
+            /* Give up on the Asynchronous reading so that its I2C Peripheral and slot are free for the next iteration. */
+            abort_mlx90614_async_reading(hmlx);
+            return MLX90614_EC_ERR;
+        }
+    }
+
+    return MLX90614_EC_OK;
+}
+
+#ifdef HAL_UART_MODULE_ENABLED
+static const char *get_mlx90614_benchmark_case_name(MLX90614_Benchmark_Case bench_case)
+{
+    switch (bench_case)
+    {
+        case MLX90614_BENCHMARK_BLOCKING_FLOAT:
+            return "blocking_float";
+        case MLX90614_BENCHMARK_BLOCKING_CENTI:
+            return "blocking_centi";
+        case MLX90614_BENCHMARK_BLOCKING_BURST:
+            return "blocking_burst";
+        case MLX90614_BENCHMARK_ASYNC_SINGLE:
+            return "async_single";
+        case MLX90614_BENCHMARK_ASYNC_BURST:
+            return "async_burst";
+        case MLX90614_BENCHMARK_CONVERT_FLOAT:
+            return "convert_float";
+        case MLX90614_BENCHMARK_CONVERT_CENTI:
+            return "convert_centi";
+        case MLX90614_BENCHMARK_SCAN:
+            return "scan";
+        default:
+            return "unknown";
+    }
+}
+
+static MLX90614_Status transmit_mlx90614_benchmark_line(UART_HandleTypeDef *huart, const char *line, int length)
+{
+    if ((length < 0) || (length >= MLX90614_BENCHMARK_LINE_SIZE))
+    {
+        return MLX90614_EC_ERR;
+    }
+
+    return (HAL_UART_Transmit(huart, (uint8_t *) line, (uint16_t) length, MLX90614_BENCHMARK_UART_TIMEOUT) == HAL_OK) ? MLX90614_EC_OK : MLX90614_EC_ERR;
+}
+#endif
+#endif
+
+static float (*get_mlx90614_temperature_converter(MLX90614_Temp_t temp_t))(uint16_t raw_temp)
+{
+    switch (temp_t)
+    {
+#if ((MLX90614_FIXED_UNIT == MLX90614_FIXED_UNIT_NONE) || (MLX90614_FIXED_UNIT == 0))
+        case MLX90614_Temp_K:
+            return &get_mlx90614_converted_temperature_in_kelvin;
+#endif
+#if ((MLX90614_FIXED_UNIT == MLX90614_FIXED_UNIT_NONE) || (MLX90614_FIXED_UNIT == 1))
+        case MLX90614_Temp_C:
+            return &get_mlx90614_converted_temperature_in_celsius;
+#endif
+#if ((MLX90614_FIXED_UNIT == MLX90614_FIXED_UNIT_NONE) || (MLX90614_FIXED_UNIT == 2))
+        case MLX90614_Temp_F:
+            return &get_mlx90614_converted_temperature_in_fahrenheit;
+#endif
+        default:
+            return NULL;
+    }
+}
+
+static MLX90614_Status read_mlx90614_raw_temperature(MLX90614_Handle *hmlx, uint8_t ram_address, uint16_t *dst)
+{
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret;
+    /** <b>Local uint16_t variable raw_temp:</b> Holds the Decimal Value corresponding to the Raw Data read from the MLX90614 Device after requesting to it a temperature value. */
+    uint16_t raw_temp;
+    /** <b>Local uint8_t variable channel:</b> @ref MLX90614_Channel_t of the temperature that wants to be read. */
+    uint8_t channel = ram_address - MLX90614_TA_RAM_ADDRESS;
+    /** <b>Local uint32_t variable now:</b> Value of @ref MLX90614_TIMESTAMP at the moment of this reading. */
+    uint32_t now = MLX90614_TIMESTAMP();
+
+    if ((hmlx->freshness_window != 0) && (hmlx->cache_valid & (1U << channel)) && ((uint32_t) (now - hmlx->cache_timestamp[channel]) < hmlx->freshness_window))
+    {
+        MLX90614_STATS_INCREMENT(cache_hits);
+        *dst = hmlx->cache_raw[channel];
+        return MLX90614_EC_OK;
+    }
+    ret = read_mlx90614_word(hmlx, ram_address, &raw_temp);
+    if (ret != MLX90614_EC_OK)
+    {
+        return ret;
+    }
+    if (raw_temp > 0x7FFF)
+    {
+        MLX90614_STATS_INCREMENT(error_flags);
+        return MLX90614_EC_ERR; // According to the datasheet, if \c raw_temp > 0x7FFF, then this means that the MLX90614 Device has raised an Error Flag. However, I could not find information about the meaning of this or these possible Error Flags.
+    }
+    /** <b>Local pointer p_filter:</b> Points to the MLX90614 Filter attached to the temperature channel that was read, if any. */
+    MLX90614_Filter *p_filter = hmlx->p_filter[channel];
+    *dst = (p_filter == NULL) ? raw_temp : update_mlx90614_filter(p_filter, raw_temp);
+    store_mlx90614_cached_raw_temperature(hmlx, channel, *dst, now);
+
+    return MLX90614_EC_OK;
+}
+
+static void store_mlx90614_cached_raw_temperature(MLX90614_Handle *hmlx, uint8_t channel, uint16_t raw, uint32_t timestamp)
+{
+    if (hmlx->freshness_window == 0)
+    {
+        return;
+    }
+    hmlx->cache_valid &= ~(1U << channel); // The entry is invalidated while being updated, since it can also be updated from an Interrupt context.
+    hmlx->cache_raw[channel] = raw;
+    hmlx->cache_timestamp[channel] = timestamp;
+    hmlx->cache_valid |= (1U << channel);
+}
+
+static MLX90614_Status read_mlx90614_word(MLX90614_Handle *hmlx, uint8_t command, uint16_t *dst)
+{
+    /** <b>Local int8_t variable ret:</b> Return value of either a HAL function or a @ref MLX90614_Status function type. */
+    uint8_t ret;
+    /** <b>Local 3 bytes uint8_t array i2cdata:</b> Used to hold the 2 bytes of data, and the PEC byte if requested, given back by the MLX90614 Device. */
+    uint8_t i2cdata[MLX90614_TEMPERATURE_RESULT_WITH_PEC_SIZE];
+
+    for (uint8_t attempt=0; ; attempt++)
+    {
+        MLX90614_STATS_BEGIN(start);
+        ret = MLX90614_TRANSPORT_READ(hmlx->hi2c, hmlx->slave_address_one_bit_left_shifted, command, i2cdata, hmlx->is_pec_check_enabled ? MLX90614_TEMPERATURE_RESULT_WITH_PEC_SIZE : MLX90614_TEMPERATURE_RESULT_SIZE, hmlx->retry_policy.timeout_ms);
+        if ((ret == HAL_BUSY) && try_mlx90614_bus_recovery(hmlx))
+        {
+            ret = MLX90614_TRANSPORT_READ(hmlx->hi2c, hmlx->slave_address_one_bit_left_shifted, command, i2cdata, hmlx->is_pec_check_enabled ? MLX90614_TEMPERATURE_RESULT_WITH_PEC_SIZE : MLX90614_TEMPERATURE_RESULT_SIZE, hmlx->retry_policy.timeout_ms);
+        }
+        MLX90614_STATS_END(MLX90614_STATS_OP_HAL_MEM_READ, start);
+        ret = HAL_ret_handler(ret);
+        if ((ret == MLX90614_EC_ERR) && !hmlx->is_slave_address_verified)
+        {
+            ret = MLX90614_EC_NR; // A HAL Error (e.g., a NACK) under a slave address that has not been confirmed yet means that no MLX90614 Device responds under it.
+        }
+        if ((ret == MLX90614_EC_OK) && hmlx->is_pec_check_enabled && (calculate_mlx90614_read_pec(hmlx, command, i2cdata) != i2cdata[2]))
+        {
+            MLX90614_STATS_INCREMENT(pec_errors);
+            ret = MLX90614_EC_ERR; // The data received got corrupted.
+        }
+        if (ret == MLX90614_EC_OK)
+        {
+            break;
+        }
+        if (!wait_mlx90614_retry(&hmlx->retry_policy, attempt))
+        {
+            return ret;
+        }
+    }
+    *dst = ((i2cdata[1]<<8) | i2cdata[0]);
+    hmlx->is_slave_address_verified = 1;
+
+    return MLX90614_EC_OK;
+}
+
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+static MLX90614_Status send_mlx90614_write_command(MLX90614_Handle *hmlx, uint8_t command, uint16_t value)
+{
+    /** <b>Local uint8_t 4 bytes array variable write_command:</b> Holds the data that wants to be written into the MLX90614 Device's EEPROM, where the first or least significant byte should stand for the MLX90614's EEPROM value where it is desired to start writing data, the next 2 bytes should contain the actual data that wants to be written into the MLX90614's EEPROM, and the last or most significant byte should stand for the PEC byte of the previously described values as calculated for the MLX90614 device. */
+    uint8_t write_command[MLX90614_I2C_WRITE_COMMAND_SIZE] = {command, value & 0xFF, value >> 8, MLX90614_PEC_RESET_VALUE};
+    // Calculating the PEC byte before sending the corresponding data.
+    write_command[3] = calculate_pec(write_command[3], hmlx->slave_address_one_bit_left_shifted);
+    write_command[3] = calculate_pec(write_command[3], write_command[0]);
+    write_command[3] = calculate_pec(write_command[3], write_command[1]);
+    write_command[3] = calculate_pec(write_command[3], write_command[2]);
+
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret;
+    for (uint8_t attempt=0; ; attempt++)
+    {
+        MLX90614_STATS_BEGIN(start);
+        /** <b>Local HAL_StatusTypeDef variable hal_status:</b> Return value of the HAL function. */
+        HAL_StatusTypeDef hal_status = HAL_I2C_Master_Transmit(hmlx->hi2c, hmlx->slave_address_one_bit_left_shifted, write_command, MLX90614_I2C_WRITE_COMMAND_SIZE, hmlx->retry_policy.timeout_ms);
+        if ((hal_status == HAL_BUSY) && try_mlx90614_bus_recovery(hmlx))
+        {
+            hal_status = HAL_I2C_Master_Transmit(hmlx->hi2c, hmlx->slave_address_one_bit_left_shifted, write_command, MLX90614_I2C_WRITE_COMMAND_SIZE, hmlx->retry_policy.timeout_ms);
+        }
+        ret = HAL_ret_handler(hal_status);
+        MLX90614_STATS_END(MLX90614_STATS_OP_HAL_MASTER_TRANSMIT, start);
+        if ((ret == MLX90614_EC_OK) || !wait_mlx90614_retry(&hmlx->retry_policy, attempt))
+        {
+            return ret;
+        }
+    }
+}
+
+static void prepare_mlx90614_eeprom_write(MLX90614_EEPROM_Write *job, MLX90614_Handle *hmlx, uint8_t command, uint16_t mask, uint16_t value)
+{
+    job->hmlx = hmlx;
+    job->command = command;
+    job->mask = mask;
+    job->value = value & mask;
+    job->is_verify_enabled = 1;
+    job->stage_tick = HAL_GetTick();
+    job->status = MLX90614_EC_NA;
+    job->stage = MLX90614_EEPROM_STAGE_READ;
+}
+
+static MLX90614_Status poll_mlx90614_eeprom_cell(MLX90614_EEPROM_Write *job, uint16_t expected)
+{
+    /** <b>Local uint32_t variable elapsed:</b> Time in milliseconds that has elapsed since the current process of the EEPROM cell was requested. */
+    uint32_t elapsed = HAL_GetTick() - job->stage_tick;
+    if (!job->is_verify_enabled)
+    {
+        return (elapsed >= MLX90614_ERASE_OR_WRITE_CELL_TIME) ? MLX90614_EC_OK : MLX90614_EC_NA;
+    }
+    if (elapsed < MLX90614_EEPROM_CELL_MIN_TIME)
+    {
+        return MLX90614_EC_NA;
+    }
+
+    /** <b>Local uint16_t variable readback:</b> Holds the value read back from the EEPROM cell of interest. */
+    uint16_t readback;
+    // NOTE: The MLX90614 Device may not respond or may give back inconsistent data while its EEPROM is busy, so only a successfully read expected value concludes the current process.
+    if ((read_mlx90614_word(job->hmlx, job->command, &readback) == MLX90614_EC_OK) && (readback == expected))
+    {
+        return MLX90614_EC_OK;
+    }
+
+    return (elapsed >= MLX90614_ERASE_OR_WRITE_CELL_TIME) ? MLX90614_EC_ERR : MLX90614_EC_NA;
+}
+
+static MLX90614_Status update_mlx90614_eeprom_bits(MLX90614_Handle *hmlx, uint8_t command, uint16_t mask, uint16_t value)
+{
+    /** <b>Local MLX90614_EEPROM_Write variable job:</b> EEPROM Write that will be pumped until it concludes. */
+    MLX90614_EEPROM_Write job;
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret;
+
+    prepare_mlx90614_eeprom_write(&job, hmlx, command, mask, value);
+    while ((ret = pump_mlx90614_eeprom_write(&job)) == MLX90614_EC_NA)
+    {
+        if ((job.stage == MLX90614_EEPROM_STAGE_ERASE_WAIT) || (job.stage == MLX90614_EEPROM_STAGE_WRITE_WAIT))
+        {
+            HAL_Delay(1); // Avoids flooding the I2C bus with readbacks while the EEPROM cell is busy.
+        }
+    }
+
+    return ret;
+}
+#endif
+
+static uint8_t get_mlx90614_eeprom_shadow_index(uint8_t command)
+{
+    /** <b>Local uint8_t variable index:</b> Index of the word of the EEPROM Shadow being compared. */
+    uint8_t index = 0;
+    for (; index<MLX90614_EEPROM_SHADOW_SIZE; index++)
+    {
+        if (mlx90614_eeprom_shadow_commands[index] == command)
+        {
+            break;
+        }
+    }
+
+    return index;
+}
+
+static void update_mlx90614_eeprom_shadow(MLX90614_Handle *hmlx, uint8_t command, uint16_t value, uint8_t is_valid)
+{
+    /** <b>Local uint8_t variable index:</b> Index of the word of the EEPROM Shadow that holds the copy of the given EEPROM address. */
+    uint8_t index = get_mlx90614_eeprom_shadow_index(command);
+    if (!hmlx->is_eeprom_shadow_enabled || (index == MLX90614_EEPROM_SHADOW_SIZE))
+    {
+        return;
+    }
+
+    if (is_valid)
+    {
+        hmlx->eeprom_shadow[index] = value;
+        hmlx->eeprom_shadow_valid |= 1U << index;
+    }
+    else
+    {
+        hmlx->eeprom_shadow_valid &= ~(1U << index);
+    }
+}
+
+static MLX90614_Status read_mlx90614_eeprom_word(MLX90614_Handle *hmlx, uint8_t command, uint16_t *dst)
+{
+    /** <b>Local uint8_t variable index:</b> Index of the word of the EEPROM Shadow that holds the copy of the given EEPROM address. */
+    uint8_t index = get_mlx90614_eeprom_shadow_index(command);
+    if (hmlx->is_eeprom_shadow_enabled && (index < MLX90614_EEPROM_SHADOW_SIZE) && (hmlx->eeprom_shadow_valid & (1U << index)))
+    {
+        *dst = hmlx->eeprom_shadow[index];
+        return MLX90614_EC_OK;
+    }
+
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = read_mlx90614_word(hmlx, command, dst);
+    if (ret == MLX90614_EC_OK)
+    {
+        update_mlx90614_eeprom_shadow(hmlx, command, *dst, 1);
+    }
+
+    return ret;
+}
+
+static MLX90614_Status get_mlx90614_handle_channel_centi_temperature(MLX90614_Handle *hmlx, MLX90614_Channel_t channel, int32_t *dst)
+{
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret;
+    /** <b>Local uint16_t variable raw_temp:</b> Holds the Decimal Value corresponding to the Raw Data read from the MLX90614 Device after requesting to it a temperature value. */
+    uint16_t raw_temp;
+    MLX90614_STATS_BEGIN(start);
+
+    ret = read_mlx90614_raw_temperature(hmlx, MLX90614_TA_RAM_ADDRESS + channel, &raw_temp);
+    if (ret != MLX90614_EC_OK)
+    {
+        MLX90614_STATS_END(MLX90614_STATS_OP_GET_AMBIENT + channel, start);
+        return ret;
+    }
+    *dst = get_mlx90614_converted_centi_temperature(raw_temp, hmlx->temperature_type);
+
+    MLX90614_STATS_END(MLX90614_STATS_OP_GET_AMBIENT + channel, start);
+    return MLX90614_EC_OK;
+}
+
+static void convert_mlx90614_sample(MLX90614_Handle *hmlx, MLX90614_Sample *sample)
+{
+    if (hmlx->emissivity_coefficient != 0)
+    {
+        sample->raw[MLX90614_Ch_Tobj1] = compensate_mlx90614_emissivity(sample->raw[MLX90614_Ch_Tobj1], sample->raw[MLX90614_Ch_Ta], hmlx->emissivity_coefficient);
+        sample->raw[MLX90614_Ch_Tobj2] = compensate_mlx90614_emissivity(sample->raw[MLX90614_Ch_Tobj2], sample->raw[MLX90614_Ch_Ta], hmlx->emissivity_coefficient);
+    }
+    for (uint8_t channel=MLX90614_Ch_Ta; channel<MLX90614_NUMBER_OF_CHANNELS; channel++)
+    {
+        sample->temperature[channel] = MLX90614_CONVERT_RAW_TEMPERATURE(hmlx->p_get_converted_temperature, sample->raw[channel]);
+    }
+}
+
+static MLX90614_Handle *find_mlx90614_async_handle(I2C_HandleTypeDef *hi2c, uint8_t *slot)
+{
+    /** <b>Local pointer hmlx:</b> Points to the MLX90614 Handle that is being evaluated. */
+    MLX90614_Handle *hmlx;
+    for (uint8_t i=0; i<MLX90614_MAX_NUMBER_OF_ASYNC_I2C; i++)
+    {
+        hmlx = p_mlx90614_async_handles[i];
+        if ((hmlx != NULL) && (hmlx->hi2c == hi2c) && (hmlx->async_state == MLX90614_ASYNC_BUSY))
+        {
+            *slot = i;
+            return hmlx;
+        }
+    }
+    return NULL;
+}
+
+static uint8_t claim_mlx90614_async_slot(MLX90614_Handle *hmlx)
+{
+    /** <b>Local uint8_t variable free_slot:</b> Index of the free slot of @ref p_mlx90614_async_handles that will be used. */
+    uint8_t free_slot = MLX90614_MAX_NUMBER_OF_ASYNC_I2C;
+    /** <b>Local uint32_t variable primask:</b> Value of the PRIMASK register before masking the interrupts, which is restored once the slots have been updated. */
+    uint32_t primask = __get_PRIMASK();
+
+    /* NOTE: The slots are also claimed from Interrupt context (e.g., via @ref mlx90614_scheduler_tick_handler ), so no interrupt may claim the same free slot between finding it and storing the Handle in it. */
+    __disable_irq();
+    for (uint8_t i=0; i<MLX90614_MAX_NUMBER_OF_ASYNC_I2C; i++)
+    {
+        if (p_mlx90614_async_handles[i] == NULL)
+        {
+            if (free_slot == MLX90614_MAX_NUMBER_OF_ASYNC_I2C)
+            {
+                free_slot = i;
+            }
+        }
+        else if (p_mlx90614_async_handles[i]->hi2c == hmlx->hi2c)
+        {
+            free_slot = MLX90614_MAX_NUMBER_OF_ASYNC_I2C; // There is already an Asynchronous reading in process in this I2C.
+            break;
+        }
+    }
+    if (free_slot != MLX90614_MAX_NUMBER_OF_ASYNC_I2C)
+    {
+        /* The state must be updated before starting the I2C transaction since it may conclude before the HAL function returns. */
+        hmlx->async_state = MLX90614_ASYNC_BUSY;
+        p_mlx90614_async_handles[free_slot] = hmlx;
+    }
+    __set_PRIMASK(primask);
+
+    return free_slot;
+}
+
+static MLX90614_Status issue_mlx90614_async_reading(MLX90614_Handle *hmlx, uint8_t ram_address)
 {
-    /* Validate the given slave address to have a valid value. */
-    if (slave_address > MLX90614_MAX_VALID_SLAVE_ADDRESS_VALUE)
+    /** <b>Local int8_t variable ret:</b> Return value of either a HAL function or a @ref MLX90614_Status function type. */
+    uint8_t ret;
+    MLX90614_STATS_BEGIN(start);
+#if MLX90614_ASYNC_USE_DMA
+    ret = HAL_I2C_Mem_Read_DMA(hmlx->hi2c, hmlx->slave_address_one_bit_left_shifted, ram_address, MLX90614_RAM_OR_EEPROM_ADDRESS_SIZE, hmlx->async_i2cdata, hmlx->is_pec_check_enabled ? MLX90614_TEMPERATURE_RESULT_WITH_PEC_SIZE : MLX90614_TEMPERATURE_RESULT_SIZE);
+#else
+    ret = HAL_I2C_Mem_Read_IT(hmlx->hi2c, hmlx->slave_address_one_bit_left_shifted, ram_address, MLX90614_RAM_OR_EEPROM_ADDRESS_SIZE, hmlx->async_i2cdata, hmlx->is_pec_check_enabled ? MLX90614_TEMPERATURE_RESULT_WITH_PEC_SIZE : MLX90614_TEMPERATURE_RESULT_SIZE);
+#endif
+    MLX90614_STATS_END(MLX90614_STATS_OP_HAL_MEM_READ_ASYNC, start);
+    return HAL_ret_handler(ret);
+}
+
+static void conclude_mlx90614_async_reading(MLX90614_Handle *hmlx, uint8_t slot, MLX90614_Status status)
+{
+    p_mlx90614_async_handles[slot] = NULL;
+    hmlx->async_status = status;
+    hmlx->async_state = (status == MLX90614_EC_OK) ? MLX90614_ASYNC_CPLT : MLX90614_ASYNC_ERR;
+    if (status == MLX90614_EC_OK)
     {
-        return MLX90614_EC_ERR;
+        hmlx->is_slave_address_verified = 1;
     }
 
-    /* Update and persist the slave address in the @ref mlx90614 if requested. */
-    if (slave_address != 0)
+    if (hmlx->p_async_sample != NULL)
     {
-        /** <b>Local uint8_t variable tmp_slave_addr_one_bit_left_shifted:</b> Contains the given slave address, but with one bit left shift. */
-        uint8_t tmp_slave_addr_one_bit_left_shifted = slave_address << 1;
-        if (HAL_I2C_IsDeviceReady(p_hi2c, tmp_slave_addr_one_bit_left_shifted, IS_MLX90614_READY_NUMBER_OF_TRIALS, MLX90614_I2C_TIMEOUT) != HAL_OK)
+        /** <b>Local pointer p_sample:</b> Points to the MLX90614 Sample that the concluded Asynchronous reading was filling. */
+        MLX90614_Sample *p_sample = hmlx->p_async_sample;
+        hmlx->p_async_sample = NULL;
+        if (hmlx->p_async_sample_callback != NULL)
         {
-            return MLX90614_EC_NR;
+            (*hmlx->p_async_sample_callback)(hmlx, status, p_sample);
         }
-        mlx90614_slave_address = slave_address;
-        mlx90614_slave_address_one_bit_left_shifted = tmp_slave_addr_one_bit_left_shifted;
     }
-    else
+    else if (hmlx->p_async_callback != NULL)
     {
-        mlx90614_slave_address_one_bit_left_shifted = mlx90614_slave_address << 1;
+        (*hmlx->p_async_callback)(hmlx, status, hmlx->async_temperature);
     }
+}
 
-    /* Persist the pointer to the I2C that is desired for the MLX90614 module to use. */
-    p_hi2c = hi2c;
+static void abort_mlx90614_async_reading(MLX90614_Handle *hmlx)
+{
+    /** <b>Local uint32_t variable primask:</b> Value of the PRIMASK register before masking the interrupts, which is restored once the slot has been released. */
+    uint32_t primask = __get_PRIMASK();
 
-    /* Initialize the @ref p_get_mlx90614_converted_temperature pointer and update @ref mlx90614_temperature_type . */
-    switch (temp_t)
+    /* NOTE: Otherwise, the reading could conclude and its slot be claimed by another Handle from Interrupt context right before releasing it. */
+    __disable_irq();
+    for (uint8_t i=0; i<MLX90614_MAX_NUMBER_OF_ASYNC_I2C; i++)
     {
-        case MLX90614_Temp_K:
-            p_get_mlx90614_converted_temperature = &get_mlx90614_converted_temperature_in_kelvin;
-            break;
-        case MLX90614_Temp_C:
-            p_get_mlx90614_converted_temperature = &get_mlx90614_converted_temperature_in_celsius;
-            break;
-        case MLX90614_Temp_F:
-            p_get_mlx90614_converted_temperature = &get_mlx90614_converted_temperature_in_fahrenheit;
+        if ((p_mlx90614_async_handles[i] == hmlx) && (hmlx->async_state == MLX90614_ASYNC_BUSY))
+        {
+            HAL_I2C_Master_Abort_IT(hmlx->hi2c, hmlx->slave_address_one_bit_left_shifted);
+            p_mlx90614_async_handles[i] = NULL;
+            hmlx->p_async_sample = NULL;
+            hmlx->async_status = MLX90614_EC_NR;
+            hmlx->async_state = MLX90614_ASYNC_ERR;
             break;
-        default:
-            return MLX90614_EC_ERR; // The requested temperature value type is not recognized. Therefore, send Error Exception Code.
+        }
     }
-    mlx90614_temperature_type = temp_t;
-
-    return MLX90614_EC_OK;
+    __set_PRIMASK(primask);
 }
 
-MLX90614_Status find_mlx90614_slave_address(void)
+static MLX90614_Status start_mlx90614_async_temperature_reading(MLX90614_Handle *hmlx, MLX90614_Channel_t channel, MLX90614_Async_Callback callback)
 {
-    /** <b>Local uint8_t variable current_slave_address:</b> Contains the current slave address with which it is being attempted to get a response from a MLX90614 device. */
-    uint8_t current_slave_address = MLX90614_MIN_VALID_SLAVE_ADDRESS_VALUE;
-    /** <b>Local uint8_t variable current_slave_address_one_bit_left_shifted:</b> Contains the current slave address with which it is being attempted to get a response from a MLX90614 device, but with one bit left shift. */
-    uint8_t current_slave_address_one_bit_left_shifted;
+    /** <b>Local uint8_t variable slot:</b> Index of the slot of @ref p_mlx90614_async_handles assigned to the given MLX90614 Handle. */
+    uint8_t slot = claim_mlx90614_async_slot(hmlx);
+    if (slot == MLX90614_MAX_NUMBER_OF_ASYNC_I2C)
+    {
+        return MLX90614_EC_NR;
+    }
 
-    /*
-     NOTE:  We do not start from mlx90614_slave_address=0, because that value will make @ref HAL_I2C_IsDeviceReady
-            function to give back @ref HAL_OK as long as a single I2C device responds to the I2C protocol on the
-            specified I2C pins of the MCU via the given @ref p_hi2c Pointer, which will not allow us to identify the
-            currently stored slave address of our actual I2C device.
-     */
-    for (; current_slave_address<MLX90614_MAX_VALID_SLAVE_ADDRESS_VALUE_PLUS_ONE; current_slave_address++)
+    hmlx->p_async_sample = NULL;
+    hmlx->p_async_callback = callback;
+    hmlx->async_channel = channel;
+    /** <b>Local int8_t variable ret:</b> Return value of a @ref MLX90614_Status function type. */
+    uint8_t ret = issue_mlx90614_async_reading(hmlx, MLX90614_TA_RAM_ADDRESS + channel);
+    if (ret != MLX90614_EC_OK)
     {
-        current_slave_address_one_bit_left_shifted = current_slave_address<<1;
-        if (HAL_I2C_IsDeviceReady(p_hi2c, current_slave_address_one_bit_left_shifted, IS_MLX90614_READY_NUMBER_OF_TRIALS, MLX90614_I2C_TIMEOUT) == HAL_OK)
-        {
-            mlx90614_slave_address = current_slave_address;
-            mlx90614_slave_address_one_bit_left_shifted = current_slave_address_one_bit_left_shifted;
-            return MLX90614_EC_OK;
-        }
+        p_mlx90614_async_handles[slot] = NULL;
+        hmlx->async_state = MLX90614_ASYNC_IDLE;
+        return ret;
     }
 
-    return MLX90614_EC_NR;
+    return MLX90614_EC_OK;
 }
 
-uint8_t get_mlx90614_module_slave_address(void)
+/* NOTE: The float literals (i.e., with the "f" suffix) avoid promoting these conversions into double precision arithmetic. */
+#if ((MLX90614_FIXED_UNIT == MLX90614_FIXED_UNIT_NONE) || (MLX90614_FIXED_UNIT == 0))
+static float get_mlx90614_converted_temperature_in_kelvin(uint16_t raw_temp)
 {
-    return mlx90614_slave_address;
+    return ((float) raw_temp)*0.02f;
 }
+#endif
 
-MLX90614_Status set_mlx90614_module_slave_address(uint8_t slave_address)
+#if ((MLX90614_FIXED_UNIT == MLX90614_FIXED_UNIT_NONE) || (MLX90614_FIXED_UNIT == 1))
+static float get_mlx90614_converted_temperature_in_celsius(uint16_t raw_temp)
 {
-    /* Validate the given slave address to have a valid value. */
-    if ((slave_address>MLX90614_MAX_VALID_SLAVE_ADDRESS_VALUE) || (slave_address<MLX90614_MIN_VALID_SLAVE_ADDRESS_VALUE))
+    return ((float) raw_temp)*0.02f - 273.15f;
+}
+#endif
+
+#if ((MLX90614_FIXED_UNIT == MLX90614_FIXED_UNIT_NONE) || (MLX90614_FIXED_UNIT == 2))
+static float get_mlx90614_converted_temperature_in_fahrenheit(uint16_t raw_temp)
+{
+    return ((float) raw_temp)*0.036f - 459.67f;
+}
+#endif
+
+int32_t get_mlx90614_converted_centi_temperature(uint16_t raw_temp, MLX90614_Temp_t temp_t)
+{
+    /** <b>Local int32_t variable centi_celsius:</b> Holds the given temperature in hundredths of Celsius. */
+    int32_t centi_celsius;
+    switch (temp_t)
     {
-        return MLX90614_EC_ERR;
+        case MLX90614_Temp_C:
+            return ((int32_t) raw_temp)*MLX90614_CENTI_KELVIN_PER_RAW_UNIT - MLX90614_CENTI_CELSIUS_OFFSET_IN_CENTI_KELVIN;
+        case MLX90614_Temp_F:
+            centi_celsius = ((int32_t) raw_temp)*MLX90614_CENTI_KELVIN_PER_RAW_UNIT - MLX90614_CENTI_CELSIUS_OFFSET_IN_CENTI_KELVIN;
+            // NOTE: Adding or subtracting half of the divisor rounds the result to the nearest integer, since the C division truncates towards zero.
+            return (centi_celsius*9 + ((centi_celsius >= 0) ? 2 : -2))/5 + MLX90614_CENTI_FAHRENHEIT_OFFSET;
+        default:
+            return ((int32_t) raw_temp)*MLX90614_CENTI_KELVIN_PER_RAW_UNIT;
     }
+}
 
-    /* Update and persist the slave address in the @ref mlx90614 . */
-    /** <b>Local uint8_t variable tmp_slave_addr_one_bit_left_shifted:</b> Contains the given slave address, but with one bit left shift. */
-    uint8_t tmp_slave_addr_one_bit_left_shifted = slave_address << 1;
-    if (HAL_I2C_IsDeviceReady(p_hi2c, tmp_slave_addr_one_bit_left_shifted, IS_MLX90614_READY_NUMBER_OF_TRIALS, MLX90614_I2C_TIMEOUT) != HAL_OK)
+MLX90614_Status mlx90614_convert_batch(const uint16_t *raw, float *out, size_t n, MLX90614_Temp_t temp_t)
+{
+    /** <b>Local float variable scale:</b> Temperature units, of the given Temperature Type, that each unit of a Raw Value stands for. */
+    float scale;
+    /** <b>Local float variable offset:</b> Temperature, in the given Temperature Type, that stands for a Raw Value of zero. */
+    float offset;
+    /** <b>Local uint32_t variable flags:</b> Bitwise OR of all the Raw Values given, which is used to validate their Error Flags at once. */
+    uint32_t flags = 0;
+    /** <b>Local size_t variable i:</b> Index of the Raw Value being converted. */
+    size_t i = 0;
+
+    /* Resolving the Temperature Type only once for the whole block. */
+    switch (temp_t)
     {
-        return MLX90614_EC_NR;
+        case MLX90614_Temp_C:
+            scale = 0.02f;
+            offset = -273.15f;
+            break;
+        case MLX90614_Temp_F:
+            scale = 0.036f;
+            offset = -459.67f;
+            break;
+        default:
+            scale = 0.02f;
+            offset = 0.0f;
+            break;
     }
-    mlx90614_slave_address = slave_address;
-    mlx90614_slave_address_one_bit_left_shifted = tmp_slave_addr_one_bit_left_shifted;
 
-    return MLX90614_EC_OK;
+    /* Converting four Raw Values per iteration, so that their multiply-accumulate operations can be pipelined. */
+    for (; (i+4)<=n; i+=4)
+    {
+        flags |= raw[i] | raw[i+1] | raw[i+2] | raw[i+3];
+        out[i] = ((float) raw[i])*scale + offset;
+        out[i+1] = ((float) raw[i+1])*scale + offset;
+        out[i+2] = ((float) raw[i+2])*scale + offset;
+        out[i+3] = ((float) raw[i+3])*scale + offset;
+    }
+    for (; i<n; i++)
+    {
+        flags |= raw[i];
+        out[i] = ((float) raw[i])*scale + offset;
+    }
+
+    return (flags & MLX90614_RAW_ERROR_FLAG) ? MLX90614_EC_ERR : MLX90614_EC_OK;
 }
 
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wdiscarded-qualifiers" // This pragma definition will tell the compiler to ignore an expected Compilation Warning, that should not affect the program at all and that was decided to put this way for performance purposes. For the record, this Warningstates the following: passing argument 5 of 'HAL_I2C_Mem_Write' discards 'const' qualifier from pointer target type
-MLX90614_Status set_mlx90614_device_slave_address(uint8_t new_slave_address)
+MLX90614_Status mlx90614_convert_centi_batch(const uint16_t *raw, int32_t *out, size_t n, MLX90614_Temp_t temp_t)
 {
-    /* Validate the given slave address to have a valid value. */
-    if ((new_slave_address>MLX90614_MAX_VALID_SLAVE_ADDRESS_VALUE) || (new_slave_address<MLX90614_MIN_VALID_SLAVE_ADDRESS_VALUE))
+    /** <b>Local uint32_t variable flags:</b> Bitwise OR of all the Raw Values given, which is used to validate their Error Flags at once. */
+    uint32_t flags = 0;
+    /** <b>Local size_t variable i:</b> Index of the Raw Value being converted. */
+    size_t i = 0;
+    /** <b>Local int32_t variable offset:</b> Temperature, in hundredths of the given Temperature Type, that stands for a Raw Value of zero, whenever the conversion is a plain scaling plus an offset. */
+    int32_t offset;
+
+    switch (temp_t)
     {
-        return MLX90614_EC_ERR;
+        case MLX90614_Temp_F:
+            /* NOTE: The rounding of the Fahrenheit conversion depends on the sign of each intermediate result, so it is left to the scalar conversion. */
+            for (; i<n; i++)
+            {
+                flags |= raw[i];
+                out[i] = get_mlx90614_converted_centi_temperature(raw[i], MLX90614_Temp_F);
+            }
+            return (flags & MLX90614_RAW_ERROR_FLAG) ? MLX90614_EC_ERR : MLX90614_EC_OK;
+        case MLX90614_Temp_C:
+            offset = -MLX90614_CENTI_CELSIUS_OFFSET_IN_CENTI_KELVIN;
+            break;
+        default:
+            offset = 0;
+            break;
     }
 
-    /* STEP 1: Read the currently stored 2 bytes of data in the MLX90614 EEPROM address where the Slave Address is stored in order to get the most significant byte. */
-    /** <b>Local int8_t variable ret:</b> Return value of either a HAL function or a @ref MLX90614_Status function type. */
-    uint8_t ret = 0;
-    /** <b>Local uint8_t variable received_i2cdata:</b> Used to hold 2-bytes of data read from the EEPROM of the MLX90614 Device, received via the I2C Communication Protocol. */
-    uint8_t received_i2cdata[MLX90614_EEPROM_SLAVE_ADDRESS_SIZE] = {0, 0};
-    ret = HAL_I2C_Mem_Read(p_hi2c, mlx90614_slave_address_one_bit_left_shifted, MLX90614_SLAVE_ADDRESS_EEPROM_ADDRESS, MLX90614_RAM_OR_EEPROM_ADDRESS_SIZE, received_i2cdata, MLX90614_EEPROM_SLAVE_ADDRESS_SIZE, MLX90614_I2C_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
+    /* Converting four Raw Values per iteration. */
+    for (; (i+4)<=n; i+=4)
     {
-        return ret;
+        flags |= raw[i] | raw[i+1] | raw[i+2] | raw[i+3];
+        out[i] = ((int32_t) raw[i])*MLX90614_CENTI_KELVIN_PER_RAW_UNIT + offset;
+        out[i+1] = ((int32_t) raw[i+1])*MLX90614_CENTI_KELVIN_PER_RAW_UNIT + offset;
+        out[i+2] = ((int32_t) raw[i+2])*MLX90614_CENTI_KELVIN_PER_RAW_UNIT + offset;
+        out[i+3] = ((int32_t) raw[i+3])*MLX90614_CENTI_KELVIN_PER_RAW_UNIT + offset;
     }
-
-    /* STEP 2: Erase the 2 bytes of data stored corresponding to the Slave Address value in the MLX90614 EEPROM. */
-    /** <b>Local uint8_t 3 bytes array variable new_mlx90614_eeprom_value:</b> Holds the data that wants to be written into the MLX90614 Device's EEPROM, where the first or least significant byte should stand for the MLX90614's EEPROM value where it is desired to start writing data, the next 2 bytes should contain the actual data that wants to be written into the MLX90614's EEPROM, and the last or most significant byte should stand for the PEC byte of the previously described values as calculated for the MLX90614 device. */
-    uint8_t new_mlx90614_eeprom_value[MLX90614_I2C_WRITE_COMMAND_SIZE] = {MLX90614_SLAVE_ADDRESS_EEPROM_ADDRESS, MLX90614_SLAVE_ADDRESS_EEPROM_ERASE_VALUE, MLX90614_SLAVE_ADDRESS_EEPROM_ERASE_VALUE, MLX90614_PEC_RESET_VALUE};
-    // Calculating the PEC byte before sending the corresponding data.
-    new_mlx90614_eeprom_value[3] = calculate_pec(new_mlx90614_eeprom_value[3], mlx90614_slave_address_one_bit_left_shifted);
-    new_mlx90614_eeprom_value[3] = calculate_pec(new_mlx90614_eeprom_value[3], new_mlx90614_eeprom_value[0]);
-    new_mlx90614_eeprom_value[3] = calculate_pec(new_mlx90614_eeprom_value[3], new_mlx90614_eeprom_value[1]);
-    new_mlx90614_eeprom_value[3] = calculate_pec(new_mlx90614_eeprom_value[3], new_mlx90614_eeprom_value[2]);
-    ret = HAL_I2C_Master_Transmit(p_hi2c, mlx90614_slave_address_one_bit_left_shifted, new_mlx90614_eeprom_value, MLX90614_I2C_WRITE_COMMAND_SIZE, MLX90614_I2C_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
+    for (; i<n; i++)
     {
-        return ret;
+        flags |= raw[i];
+        out[i] = ((int32_t) raw[i])*MLX90614_CENTI_KELVIN_PER_RAW_UNIT + offset;
     }
-    HAL_Delay(MLX90614_ERASE_OR_WRITE_CELL_TIME); // Giving time to the MLX90614 Device to Erase its EEPROM Slave Address value.
 
-    /* STEP 3: Writing new Slave Address into MLX90614 EEPROM while keeping its original most significant byte. */
-    new_mlx90614_eeprom_value[1] = new_slave_address;
-    new_mlx90614_eeprom_value[2] = received_i2cdata[1];
-    // Calculating the PEC byte before sending the corresponding data.
-    new_mlx90614_eeprom_value[3] = calculate_pec(MLX90614_PEC_RESET_VALUE, mlx90614_slave_address_one_bit_left_shifted);
-    new_mlx90614_eeprom_value[3] = calculate_pec(new_mlx90614_eeprom_value[3], new_mlx90614_eeprom_value[0]);
-    new_mlx90614_eeprom_value[3] = calculate_pec(new_mlx90614_eeprom_value[3], new_mlx90614_eeprom_value[1]);
-    new_mlx90614_eeprom_value[3] = calculate_pec(new_mlx90614_eeprom_value[3], new_mlx90614_eeprom_value[2]);
-    ret = HAL_I2C_Master_Transmit(p_hi2c, mlx90614_slave_address_one_bit_left_shifted, new_mlx90614_eeprom_value, MLX90614_I2C_WRITE_COMMAND_SIZE, MLX90614_I2C_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
+    return (flags & MLX90614_RAW_ERROR_FLAG) ? MLX90614_EC_ERR : MLX90614_EC_OK;
+}
+
+static uint8_t calculate_mlx90614_log_crc(const uint8_t *data, size_t n)
+{
+    /** <b>Local uint8_t variable crc:</b> CRC-8 of the bytes that have been processed so far. */
+    uint8_t crc = MLX90614_PEC_RESET_VALUE;
+    for (size_t i=0; i<n; i++)
     {
-        return ret;
+        crc = calculate_pec(crc, data[i]);
     }
-    HAL_Delay(MLX90614_ERASE_OR_WRITE_CELL_TIME); // Giving time to the MLX90614 Device to Write the new Slave Address value in its EEPROM.
-
-    /* Updating the MLX90614 Slave Address in the @ref mlx90614 . */
-    mlx90614_slave_address = new_slave_address;
-    mlx90614_slave_address_one_bit_left_shifted = new_slave_address << 1;
+    return crc;
+}
 
-    /* STEP 4: Power Cycle (this must be done by implementer or user of this MLX90614 Driver either by external circuit; or by manually electrically disconnecting the MLX90614 Device and subsequently by manually electrically reconnecting it). */
-    // NOTE: A Software Reset will not be enough; Electrical Power reconnection of the MLX90614 must strictly be made.
-    return MLX90614_EC_OK;
+static uint32_t calculate_mlx90614_isqrt(uint64_t value)
+{
+    /** <b>Local uint64_t variable root:</b> Bits of the square root that have been found so far. */
+    uint64_t root = 0;
+    /** <b>Local uint64_t variable bit:</b> Highest power of four that is not greater than the remainder of the given value. */
+    uint64_t bit = 1ULL << 62;
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t) root;
 }
-#pragma GCC diagnostic pop
 
-MLX90614_Temp_t get_mlx90614_temperature_type(void)
+static uint8_t write_mlx90614_log_varint(uint8_t *dst, int32_t delta)
 {
-    return mlx90614_temperature_type;
+    /** <b>Local uint32_t variable zigzag:</b> Zig-zag encoding of the given difference, which maps small magnitudes of either sign into small unsigned values (i.e., \f$0, -1, 1, -2, ...\f$ into \f$0, 1, 2, 3, ...\f$ ). */
+    uint32_t zigzag = (((uint32_t) delta) << 1) ^ ((delta < 0) ? 0xFFFFFFFFU : 0);
+    /** <b>Local uint8_t variable n:</b> Number of bytes written. */
+    uint8_t n = 0;
+    while (zigzag >= 0x80)
+    {
+        dst[n++] = (zigzag & 0x7F) | 0x80;
+        zigzag >>= 7;
+    }
+    dst[n++] = zigzag;
+    return n;
 }
 
-MLX90614_Status set_mlx90614_temperature_type(MLX90614_Temp_t temp_t)
+static uint8_t read_mlx90614_log_varint(const uint8_t *src, size_t remaining, int32_t *delta)
 {
-    /* Update the @ref p_get_mlx90614_converted_temperature pointer and update @ref mlx90614_temperature_type . */
-    switch (temp_t)
+    /** <b>Local uint32_t variable zigzag:</b> Zig-zag encoding of the difference being read. */
+    uint32_t zigzag = 0;
+    for (uint8_t n=0; (n<MLX90614_VARINT_MAX_SIZE) && (n<remaining); n++)
     {
-        case MLX90614_Temp_K:
-            p_get_mlx90614_converted_temperature = &get_mlx90614_converted_temperature_in_kelvin;
-            break;
-        case MLX90614_Temp_C:
-            p_get_mlx90614_converted_temperature = &get_mlx90614_converted_temperature_in_celsius;
-            break;
-        case MLX90614_Temp_F:
-            p_get_mlx90614_converted_temperature = &get_mlx90614_converted_temperature_in_fahrenheit;
-            break;
-        default:
-            return MLX90614_EC_ERR; // The requested temperature value type is not recognized. Therefore, send Error Exception Code.
+        if ((n == (MLX90614_VARINT_MAX_SIZE - 1)) && (src[n] > 0x0F))
+        {
+            return 0; // The last byte may only hold the 4 most significant bits of the zig-zag encoding.
+        }
+        zigzag |= ((uint32_t) (src[n] & 0x7F)) << (7*n);
+        if (!(src[n] & 0x80))
+        {
+            *delta = (int32_t) ((zigzag >> 1) ^ (0U - (zigzag & 1)));
+            return n + 1;
+        }
     }
-    mlx90614_temperature_type = temp_t;
+    return 0;
+}
 
-    return MLX90614_EC_OK;
+static uint8_t calculate_pec(uint8_t init_pec, uint8_t new_data)
+{
+#if (MLX90614_PEC_IMPLEMENTATION == MLX90614_PEC_BYTE_TABLE)
+    return mlx90614_pec_table[init_pec ^ new_data];
+#elif (MLX90614_PEC_IMPLEMENTATION == MLX90614_PEC_NIBBLE_TABLE)
+    uint8_t data = init_pec ^ new_data;
+    data = (data << 4) ^ mlx90614_pec_nibble_table[data >> 4];
+    return (data << 4) ^ mlx90614_pec_nibble_table[data >> 4];
+#else
+    uint8_t data;
+    uint8_t bit_check;
+    data = init_pec ^ new_data;
+    for (int i=0; i<8; i++ )
+    {
+        bit_check = data & 0x80;
+        data = data << 1;
+
+        if (bit_check != 0)
+        {
+            data = data ^ 0x07;
+        }
+
+    }
+    return data;
+#endif
 }
 
-MLX90614_Status get_mlx90614_ambient_temperature(float *dst)
+static uint8_t calculate_mlx90614_read_pec(MLX90614_Handle *hmlx, uint8_t command, const uint8_t *i2cdata)
 {
-    /** <b>Local int8_t variable ret:</b> Return value of either a HAL function or a @ref MLX90614_Status function type. */
-    uint8_t ret;
-    /** <b>Local 2 bytes uint8_t array i2cdata:</b> Used to hold the Raw Data given back by the MLX90614 Device after requesting it to read temperature. */
-    uint8_t i2cdata[2];
+    /** <b>Local uint8_t variable pec:</b> Holds the PEC byte being calculated. */
+    uint8_t pec = calculate_pec(MLX90614_PEC_RESET_VALUE, hmlx->slave_address_one_bit_left_shifted);
+    pec = calculate_pec(pec, command);
+    pec = calculate_pec(pec, hmlx->slave_address_one_bit_left_shifted | MLX90614_I2C_READ_BIT);
+    pec = calculate_pec(pec, i2cdata[0]);
+    return calculate_pec(pec, i2cdata[1]);
+}
 
-    /* Reading current Ambient Temperature Raw Value from MLX90614 Infra Red Thermometer device. */
-    ret = HAL_I2C_Mem_Read(p_hi2c, mlx90614_slave_address_one_bit_left_shifted, MLX90614_TA_RAM_ADDRESS, MLX90614_RAM_OR_EEPROM_ADDRESS_SIZE, i2cdata, MLX90614_TEMPERATURE_RESULT_SIZE, MLX90614_I2C_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
+static uint8_t wait_mlx90614_retry(const MLX90614_Retry_Policy *policy, uint8_t attempt)
+{
+    if (policy->is_fail_fast || (attempt >= policy->retries))
     {
-        return ret;
+        return 0;
     }
 
-    /* Converting Raw Data read from MLX90614 Infra Red Thermometer into an actual temperature value according to its datasheet. */
-    /** <b>Local uint16_t variable raw_temp:</b> Holds the Decimal Value corresponding to the Raw Data read from the MLX90614 Device after requesting to it a temperature value. */
-    uint16_t raw_temp = ((i2cdata[1]<<8) | i2cdata[0]);
-    if (raw_temp > 0x7FFF)
+    /** <b>Local uint32_t variable backoff:</b> Time in milliseconds to be waited before the requested retry. */
+    uint32_t backoff = policy->backoff_ms;
+    for (uint8_t i=0; (i<attempt) && (backoff<policy->max_backoff_ms); i++)
     {
-        return MLX90614_EC_ERR; // According to the datasheet, if \c raw_temp > 0x7FFF, then this means that the MLX90614 Device has raised an Error Flag. However, I could not find information about the meaning of this or these possible Error Flags.
+        backoff = (backoff > (UINT32_MAX >> 1)) ? UINT32_MAX : (backoff << 1); // Saturating instead of wrapping around to a shorter backoff.
+    }
+    if (backoff > policy->max_backoff_ms)
+    {
+        backoff = policy->max_backoff_ms;
+    }
+    if (backoff != 0)
+    {
+        HAL_Delay(backoff);
     }
-    *dst = (*p_get_mlx90614_converted_temperature)(raw_temp);
 
-    return MLX90614_EC_OK;
+    return 1;
 }
 
-MLX90614_Status get_mlx90614_object1_temperature(float *dst)
+static void wait_mlx90614_bus_recovery_half_period(void)
 {
-    /** <b>Local int8_t variable ret:</b> Return value of either a HAL function or a @ref MLX90614_Status function type. */
-    uint8_t ret;
-    /** <b>Local 2 bytes uint8_t array i2cdata:</b> Used to hold the Raw Data given back by the MLX90614 Device after requesting it to read temperature. */
-    uint8_t i2cdata[2];
+    for (volatile uint32_t i=0; i<MLX90614_BUS_RECOVERY_DELAY_LOOPS; i++);
+}
 
-    /* Reading current Object1 Temperature Raw Value from MLX90614 Infra Red Thermometer device. */
-    ret = HAL_I2C_Mem_Read(p_hi2c, mlx90614_slave_address_one_bit_left_shifted, MLX90614_TOBJ1_RAM_ADDRESS, MLX90614_RAM_OR_EEPROM_ADDRESS_SIZE, i2cdata, MLX90614_TEMPERATURE_RESULT_SIZE, MLX90614_I2C_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
+static void take_mlx90614_bus_pins(I2C_HandleTypeDef *hi2c, const MLX90614_Bus_Recovery *pins)
+{
+    /** <b>Local GPIO_InitTypeDef variable gpio_init:</b> GPIO configuration with which both I2C pins are driven manually. */
+    GPIO_InitTypeDef gpio_init = {0};
+
+    HAL_I2C_DeInit(hi2c);
+    HAL_GPIO_WritePin(pins->scl_port, pins->scl_pin, GPIO_PIN_SET);
+    HAL_GPIO_WritePin(pins->sda_port, pins->sda_pin, GPIO_PIN_SET);
+    gpio_init.Mode = GPIO_MODE_OUTPUT_OD;
+    gpio_init.Pull = GPIO_NOPULL;
+    gpio_init.Speed = GPIO_SPEED_FREQ_HIGH;
+    gpio_init.Pin = pins->scl_pin;
+    HAL_GPIO_Init(pins->scl_port, &gpio_init);
+    gpio_init.Pin = pins->sda_pin;
+    HAL_GPIO_Init(pins->sda_port, &gpio_init);
+}
+
+static HAL_StatusTypeDef give_back_mlx90614_bus_pins(I2C_HandleTypeDef *hi2c, const MLX90614_Bus_Recovery *pins)
+{
+    HAL_GPIO_DeInit(pins->scl_port, pins->scl_pin);
+    HAL_GPIO_DeInit(pins->sda_port, pins->sda_pin);
+#ifdef I2C_CR1_SWRST
+    /* NOTE: Some I2C Peripherals (e.g., the ones of the STM32F1 series) keep their BUSY flag raised after a bus lockup, which is only cleared via their Software Reset. */
+    hi2c->Instance->CR1 |= I2C_CR1_SWRST;
+    hi2c->Instance->CR1 &= ~I2C_CR1_SWRST;
+#endif
+
+    return HAL_I2C_Init(hi2c);
+}
+
+static void begin_mlx90614_wake_pulse(I2C_HandleTypeDef *hi2c, const MLX90614_Bus_Recovery *pins)
+{
+    take_mlx90614_bus_pins(hi2c, pins);
+    HAL_GPIO_WritePin(pins->sda_port, pins->sda_pin, GPIO_PIN_RESET);
+}
+
+static MLX90614_Status end_mlx90614_wake_pulse(I2C_HandleTypeDef *hi2c, const MLX90614_Bus_Recovery *pins)
+{
+    HAL_GPIO_WritePin(pins->sda_port, pins->sda_pin, GPIO_PIN_SET);
+
+    return (give_back_mlx90614_bus_pins(hi2c, pins) == HAL_OK) ? MLX90614_EC_OK : MLX90614_EC_ERR;
+}
+
+static uint8_t try_mlx90614_bus_recovery(MLX90614_Handle *hmlx)
+{
+    /** <b>Local uint8_t variable slot:</b> Index of the slot of @ref p_mlx90614_async_handles that is claimed for the I2C of the given Handle, if any. */
+    uint8_t slot;
+    if (hmlx->p_bus_recovery == NULL)
     {
-        return ret;
+        return 0;
     }
 
-    /* Converting Raw Data read from MLX90614 Infra Red Thermometer into an actual temperature value according to its datasheet. */
-    /** <b>Local uint16_t variable raw_temp:</b> Holds the Decimal Value corresponding to the Raw Data read from the MLX90614 Device after requesting to it a temperature value. */
-    uint16_t raw_temp = ((i2cdata[1]<<8) | i2cdata[0]);
-    if (raw_temp > 0x7FFF)
+    /* NOTE: The HAL also gives back HAL_BUSY while the I2C Peripheral is in use (e.g., by an Asynchronous reading of another Handle), which must be left alone. */
+    if ((hmlx->hi2c->State != HAL_I2C_STATE_READY) || (find_mlx90614_async_handle(hmlx->hi2c, &slot) != NULL) || (HAL_GPIO_ReadPin(hmlx->p_bus_recovery->sda_port, hmlx->p_bus_recovery->sda_pin) != GPIO_PIN_RESET))
     {
-        return MLX90614_EC_ERR; // According to the datasheet, if \c raw_temp > 0x7FFF, then this means that the MLX90614 Device has raised an Error Flag. However, I could not find information about the meaning of this or these possible Error Flags.
+        return 0;
     }
-    *dst = (*p_get_mlx90614_converted_temperature)(raw_temp);
 
-    return MLX90614_EC_OK;
+    return (recover_mlx90614_i2c_bus(hmlx->hi2c, hmlx->p_bus_recovery) == MLX90614_EC_OK);
 }
 
-MLX90614_Status get_mlx90614_object2_temperature(float *dst)
+static HAL_StatusTypeDef probe_mlx90614_slave_address(I2C_HandleTypeDef *hi2c, uint8_t slave_address_one_bit_left_shifted, uint32_t timeout)
 {
-    /** <b>Local int8_t variable ret:</b> Return value of either a HAL function or a @ref MLX90614_Status function type. */
-    uint8_t ret;
-    /** <b>Local 2 bytes uint8_t array i2cdata:</b> Used to hold the Raw Data given back by the MLX90614 Device after requesting it to read temperature. */
-    uint8_t i2cdata[2];
+    MLX90614_STATS_BEGIN(start);
+    /** <b>Local HAL_StatusTypeDef variable ret:</b> Return value of the HAL function. */
+    HAL_StatusTypeDef ret = HAL_I2C_IsDeviceReady(hi2c, slave_address_one_bit_left_shifted, IS_MLX90614_READY_NUMBER_OF_TRIALS, timeout);
+    MLX90614_STATS_END(MLX90614_STATS_OP_HAL_IS_DEVICE_READY, start);
 
-    /* Reading current Object2 Temperature Raw Value from MLX90614 Infra Red Thermometer device. */
-    ret = HAL_I2C_Mem_Read(p_hi2c, mlx90614_slave_address_one_bit_left_shifted, MLX90614_TOBJ2_RAM_ADDRESS, MLX90614_RAM_OR_EEPROM_ADDRESS_SIZE, i2cdata, MLX90614_TEMPERATURE_RESULT_SIZE, MLX90614_I2C_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
+    return ret;
+}
+
+#if (MLX90614_ENABLE_STATS)
+static void record_mlx90614_cycles(MLX90614_Stats_Op op, uint32_t cycles)
+{
+    /** <b>Local pointer p_cycles:</b> Points to the Cycle Statistics of the given instrumented operation. */
+    MLX90614_Cycle_Stats *p_cycles = &mlx90614_stats.cycles[op];
+    if ((p_cycles->count == 0) || (cycles < p_cycles->min))
     {
-        return ret;
+        p_cycles->min = cycles;
     }
-
-    /* Converting Raw Data read from MLX90614 Infra Red Thermometer into an actual temperature value according to its datasheet. */
-    /** <b>Local uint16_t variable raw_temp:</b> Holds the Decimal Value corresponding to the Raw Data read from the MLX90614 Device after requesting to it a temperature value. */
-    uint16_t raw_temp = ((i2cdata[1]<<8) | i2cdata[0]);
-    if (raw_temp > 0x7FFF)
+    if (cycles > p_cycles->max)
     {
-        return MLX90614_EC_ERR; // According to the datasheet, if \c raw_temp > 0x7FFF, then this means that the MLX90614 Device has raised an Error Flag. However, I could not find information about the meaning of this or these possible Error Flags.
+        p_cycles->max = cycles;
     }
-    *dst = (*p_get_mlx90614_converted_temperature)(raw_temp);
+    p_cycles->total += cycles;
+    p_cycles->count++;
+}
 
-    return MLX90614_EC_OK;
+void get_mlx90614_stats(MLX90614_Stats *dst)
+{
+    *dst = mlx90614_stats;
 }
 
-static float get_mlx90614_converted_temperature_in_kelvin(uint16_t raw_temp)
+void reset_mlx90614_stats(void)
 {
-    return ((float) raw_temp)/50.0;
+    /** <b>Local constant MLX90614_Stats variable zeroed_stats:</b> Statistics with all of its members cleared. */
+    static const MLX90614_Stats zeroed_stats = {0};
+    mlx90614_stats = zeroed_stats;
 }
+#endif
 
-static float get_mlx90614_converted_temperature_in_celsius(uint16_t raw_temp)
+#if (MLX90614_TRANSPORT == MLX90614_TRANSPORT_LL)
+static HAL_StatusTypeDef wait_mlx90614_register_flag(I2C_TypeDef *i2c, uint32_t flag)
 {
-    return ((float) raw_temp)/50.0 - 273.15;
+    for (uint32_t poll=0; poll<MLX90614_LL_POLL_LIMIT; poll++)
+    {
+        /** <b>Local uint32_t variable sr1:</b> Snapshot of the \c SR1 register of the I2C Peripheral. */
+        uint32_t sr1 = i2c->SR1;
+        if ((sr1 & flag) != 0)
+        {
+            return HAL_OK;
+        }
+        if ((sr1 & I2C_SR1_AF) != 0)
+        {
+            return HAL_ERROR;
+        }
+    }
+
+    return HAL_TIMEOUT;
 }
 
-static float get_mlx90614_converted_temperature_in_fahrenheit(uint16_t raw_temp)
+static HAL_StatusTypeDef abort_mlx90614_registers_read(I2C_HandleTypeDef *hi2c, HAL_StatusTypeDef status)
 {
-    return (((float) raw_temp)/50.0-273.15)*1.8 + 32.0;
+    if (status == HAL_ERROR)
+    {
+        hi2c->Instance->SR1 &= ~I2C_SR1_AF;
+        hi2c->ErrorCode |= HAL_I2C_ERROR_AF;
+    }
+    hi2c->Instance->CR1 = (hi2c->Instance->CR1 & ~I2C_CR1_POS) | I2C_CR1_STOP;
+    hi2c->State = HAL_I2C_STATE_READY;
+
+    return status;
 }
 
-static uint8_t calculate_pec(uint8_t init_pec, uint8_t new_data)
+static HAL_StatusTypeDef read_mlx90614_registers(I2C_HandleTypeDef *hi2c, uint8_t slave_address_one_bit_left_shifted, uint8_t command, uint8_t *dst, uint16_t size)
 {
-    uint8_t data;
-    uint8_t bit_check;
-    data = init_pec ^ new_data;
-    for (int i=0; i<8; i++ )
+    /** <b>Local pointer i2c:</b> Points to the registers of the I2C Peripheral to be used. */
+    I2C_TypeDef *i2c = hi2c->Instance;
+    /** <b>Local HAL_StatusTypeDef variable ret:</b> Status of the last flag waited for. */
+    HAL_StatusTypeDef ret;
+    /** <b>Local uint32_t variable primask:</b> Value of the PRIMASK register before masking the interrupts, which is restored once the I2C Handle has been marked as busy. */
+    uint32_t primask = __get_PRIMASK();
+
+    /* NOTE: The HAL could otherwise start a transaction from Interrupt context between checking its state and marking it as busy. */
+    __disable_irq();
+    if ((hi2c->State != HAL_I2C_STATE_READY) || ((i2c->SR2 & I2C_SR2_BUSY) != 0))
     {
-        bit_check = data & 0x80;
-        data = data << 1;
+        __set_PRIMASK(primask);
+        return HAL_BUSY;
+    }
+    hi2c->State = HAL_I2C_STATE_BUSY_RX; // Keeps the HAL away from the I2C Peripheral until this reading concludes.
+    __set_PRIMASK(primask);
 
-        if (bit_check != 0)
+    /* Write phase: START, slave address with the write bit and then the command. */
+    i2c->CR1 = (i2c->CR1 & ~I2C_CR1_POS) | I2C_CR1_ACK | I2C_CR1_START;
+    if ((ret = wait_mlx90614_register_flag(i2c, I2C_SR1_SB)) != HAL_OK)
+    {
+        return abort_mlx90614_registers_read(hi2c, ret);
+    }
+    i2c->DR = slave_address_one_bit_left_shifted;
+    if ((ret = wait_mlx90614_register_flag(i2c, I2C_SR1_ADDR)) != HAL_OK)
+    {
+        return abort_mlx90614_registers_read(hi2c, ret);
+    }
+    (void) i2c->SR2; // Reading SR2 right after SR1 clears the ADDR flag.
+    i2c->DR = command;
+    if ((ret = wait_mlx90614_register_flag(i2c, I2C_SR1_BTF)) != HAL_OK)
+    {
+        return abort_mlx90614_registers_read(hi2c, ret);
+    }
+
+    /* Read phase: Repeated START, slave address with the read bit and then the data bytes. */
+    i2c->CR1 |= I2C_CR1_START;
+    if ((ret = wait_mlx90614_register_flag(i2c, I2C_SR1_SB)) != HAL_OK)
+    {
+        return abort_mlx90614_registers_read(hi2c, ret);
+    }
+    i2c->DR = slave_address_one_bit_left_shifted | MLX90614_I2C_READ_BIT;
+    if (size == MLX90614_TEMPERATURE_RESULT_SIZE)
+    {
+        i2c->CR1 |= I2C_CR1_POS;
+    }
+    if ((ret = wait_mlx90614_register_flag(i2c, I2C_SR1_ADDR)) != HAL_OK)
+    {
+        return abort_mlx90614_registers_read(hi2c, ret);
+    }
+    (void) i2c->SR2;
+    if (size == MLX90614_TEMPERATURE_RESULT_SIZE)
+    {
+        i2c->CR1 &= ~I2C_CR1_ACK; // With POS set, this NACKs the second byte, which is the last one.
+        if ((ret = wait_mlx90614_register_flag(i2c, I2C_SR1_BTF)) != HAL_OK)
         {
-            data = data ^ 0x07;
+            return abort_mlx90614_registers_read(hi2c, ret);
         }
-
+        i2c->CR1 |= I2C_CR1_STOP;
+        dst[0] = i2c->DR;
+        dst[1] = i2c->DR;
+        i2c->CR1 &= ~I2C_CR1_POS;
+        hi2c->State = HAL_I2C_STATE_READY;
+        return HAL_OK;
     }
-    return data;
+    if ((ret = wait_mlx90614_register_flag(i2c, I2C_SR1_BTF)) != HAL_OK)
+    {
+        return abort_mlx90614_registers_read(hi2c, ret);
+    }
+    i2c->CR1 &= ~I2C_CR1_ACK; // The first byte is in DR and the second one is in the shift register, so the third one will be NACKed.
+    dst[0] = i2c->DR;
+    if ((ret = wait_mlx90614_register_flag(i2c, I2C_SR1_BTF)) != HAL_OK)
+    {
+        return abort_mlx90614_registers_read(hi2c, ret);
+    }
+    i2c->CR1 |= I2C_CR1_STOP;
+    dst[1] = i2c->DR;
+    if ((ret = wait_mlx90614_register_flag(i2c, I2C_SR1_RXNE)) != HAL_OK)
+    {
+        return abort_mlx90614_registers_read(hi2c, ret);
+    }
+    dst[2] = i2c->DR;
+    hi2c->State = HAL_I2C_STATE_READY;
+
+    return HAL_OK;
 }
+#endif
 
 static MLX90614_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status)
 {
     switch (HAL_status)
     {
         case HAL_BUSY:
+            MLX90614_STATS_INCREMENT(hal_busy);
+            return MLX90614_EC_NR;
         case HAL_TIMEOUT:
+            MLX90614_STATS_INCREMENT(hal_timeout);
             return MLX90614_EC_NR;
         case HAL_ERROR:
+            MLX90614_STATS_INCREMENT(hal_error);
             return MLX90614_EC_ERR;
         default:
-            return HAL_status;
+            return (MLX90614_Status) HAL_status;
     }
 }
 
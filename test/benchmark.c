@@ -0,0 +1,154 @@
+/**@file
+ * @brief	Host-side benchmark runner of the MLX90614 Infra Red Thermometer's driver.
+ *
+ * @details This program reports the conversion throughput, the PEC throughput and the scan time of the @ref mlx90614
+ *          over the @ref mock_hal , so that any performance regression can be spotted in a CI before flashing. Since
+ *          the simulated MLX90614 Devices answer right away, these figures measure only the CPU time spent by the
+ *          @ref mlx90614 itself, which makes them comparable between commits on the same host computer.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#define _POSIX_C_SOURCE 199309L // Exposes the "clock_gettime" function of the "time.h" header file.
+#include <stdio.h>  // Library from which "printf" is located at.
+#include <time.h>   // Library from which "clock_gettime" is located at.
+#include "mock_hal.h"
+#include "mlx90614_ir_thermometer_driver.h"
+#include "mlx90614_whitebox.h"
+
+#define BENCHMARK_BATCH_SIZE            (1024)      /**< @brief Number of Raw Values converted per batch. */
+#define BENCHMARK_CONVERSION_ROUNDS     (2000)      /**< @brief Number of batches converted per conversion benchmark. */
+#define BENCHMARK_PEC_BYTES             (8000000)   /**< @brief Number of bytes fed to the PEC per PEC benchmark. */
+#define BENCHMARK_READINGS              (200000)    /**< @brief Number of readings made per reading benchmark. */
+#define BENCHMARK_SCANS                 (5000)      /**< @brief Number of full I2C bus scans made per scan benchmark. */
+
+static uint16_t raw_values[BENCHMARK_BATCH_SIZE];   /**< @brief Raw Values that are converted. */
+static float float_values[BENCHMARK_BATCH_SIZE];    /**< @brief Temperature values converted into floats. */
+static int32_t centi_values[BENCHMARK_BATCH_SIZE];  /**< @brief Temperature values converted into hundredths of a degree. */
+static volatile int32_t sink;                       /**< @brief Keeps the compiler from optimizing the benchmarked code away. */
+
+/* The application forwards the I2C callbacks of the HAL to the @ref mlx90614 , as stated in its documentation. */
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    mlx90614_i2c_mem_rx_cplt_callback(hi2c);
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+    mlx90614_i2c_error_callback(hi2c);
+}
+
+/**@brief	Gets the time of the monotonic clock of the host computer in seconds. */
+static double get_seconds(void)
+{
+    /** <b>Local struct timespec variable now:</b> Current time of the monotonic clock of the host computer. */
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec + (double) now.tv_nsec*1e-9;
+}
+
+static void benchmark_conversions(void)
+{
+    for (uint32_t i=0; i<BENCHMARK_BATCH_SIZE; i++)
+    {
+        raw_values[i] = (uint16_t) (13000 + i);
+    }
+
+    double start = get_seconds();
+    for (uint32_t round=0; round<BENCHMARK_CONVERSION_ROUNDS; round++)
+    {
+        for (uint32_t i=0; i<BENCHMARK_BATCH_SIZE; i++)
+        {
+            sink += get_mlx90614_converted_centi_temperature(raw_values[i], MLX90614_Temp_C);
+        }
+    }
+    double elapsed = get_seconds() - start;
+    printf("conversion_centi_single: %.2f Msamples/s\n", (double) BENCHMARK_CONVERSION_ROUNDS*BENCHMARK_BATCH_SIZE/elapsed*1e-6);
+
+    start = get_seconds();
+    for (uint32_t round=0; round<BENCHMARK_CONVERSION_ROUNDS; round++)
+    {
+        mlx90614_convert_centi_batch(raw_values, centi_values, BENCHMARK_BATCH_SIZE, MLX90614_Temp_C);
+        sink += centi_values[round % BENCHMARK_BATCH_SIZE];
+    }
+    elapsed = get_seconds() - start;
+    printf("conversion_centi_batch: %.2f Msamples/s\n", (double) BENCHMARK_CONVERSION_ROUNDS*BENCHMARK_BATCH_SIZE/elapsed*1e-6);
+
+    start = get_seconds();
+    for (uint32_t round=0; round<BENCHMARK_CONVERSION_ROUNDS; round++)
+    {
+        mlx90614_convert_batch(raw_values, float_values, BENCHMARK_BATCH_SIZE, MLX90614_Temp_C);
+        sink += (int32_t) float_values[round % BENCHMARK_BATCH_SIZE];
+    }
+    elapsed = get_seconds() - start;
+    printf("conversion_float_batch: %.2f Msamples/s\n", (double) BENCHMARK_CONVERSION_ROUNDS*BENCHMARK_BATCH_SIZE/elapsed*1e-6);
+}
+
+static void benchmark_pec(I2C_HandleTypeDef *hi2c)
+{
+    /** <b>Local uint8_t variable pec:</b> PEC calculated so far. */
+    uint8_t pec = 0;
+    double start = get_seconds();
+    for (uint32_t i=0; i<BENCHMARK_PEC_BYTES; i++)
+    {
+        pec = whitebox_calculate_pec(pec, (uint8_t) i);
+    }
+    double elapsed = get_seconds() - start;
+    sink += pec;
+    printf("pec_throughput: %.2f MB/s\n", (double) BENCHMARK_PEC_BYTES/elapsed*1e-6);
+
+    /* Compare whole Polling Mode readings with and without their PEC validation. */
+    mock_hal_add_device(hi2c, 0x5A);
+    MLX90614_Handle hmlx;
+    uint16_t raw;
+    init_mlx90614_handle(&hmlx, hi2c, 0x5A, MLX90614_Temp_C);
+    for (uint8_t is_pec_check_enabled=0; is_pec_check_enabled<2; is_pec_check_enabled++)
+    {
+        set_mlx90614_handle_pec_check(&hmlx, is_pec_check_enabled);
+        start = get_seconds();
+        for (uint32_t i=0; i<BENCHMARK_READINGS; i++)
+        {
+            get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw);
+        }
+        elapsed = get_seconds() - start;
+        sink += raw;
+        printf("reading_%s_pec: %.2f kreadings/s\n", is_pec_check_enabled ? "with" : "without", (double) BENCHMARK_READINGS/elapsed*1e-3);
+    }
+}
+
+static void benchmark_scan(I2C_HandleTypeDef *hi2c)
+{
+#if (MLX90614_ENABLE_SCAN)
+    mock_hal_add_device(hi2c, 0x10);
+    mock_hal_add_device(hi2c, 0x5B);
+    MLX90614_Scan_Result scan = {0};
+    double start = get_seconds();
+    for (uint32_t i=0; i<BENCHMARK_SCANS; i++)
+    {
+        scan_mlx90614_bus(hi2c, &scan, MLX90614_SCAN_PROBE_TIMEOUT, 1);
+    }
+    double elapsed = get_seconds() - start;
+    sink += scan.count;
+    printf("scan_time: %.2f us/scan (%u devices found)\n", elapsed/BENCHMARK_SCANS*1e6, scan.count);
+#else
+    (void) hi2c;
+    printf("scan_time: disabled\n");
+#endif
+}
+
+int main(void)
+{
+    /** <b>Local I2C_TypeDef variable i2c1_registers:</b> Registers of the I2C Peripheral of \c hi2c1 . */
+    static I2C_TypeDef i2c1_registers;
+    /** <b>Local I2C_HandleTypeDef variable hi2c1:</b> I2C Handle of the simulated bus. */
+    static I2C_HandleTypeDef hi2c1;
+
+    mock_hal_reset();
+    mock_hal_init_i2c(&hi2c1, &i2c1_registers);
+    printf("pec_implementation: %d\n", MLX90614_PEC_IMPLEMENTATION);
+    benchmark_conversions();
+    benchmark_pec(&hi2c1);
+    benchmark_scan(&hi2c1);
+    return 0;
+}
@@ -0,0 +1,47 @@
+/**@file
+ * @brief	Compiles the MLX90614 Infra Red Thermometer's driver together with the functions of the
+ *          "mlx90614_whitebox.h" header file.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "../Src/mlx90614_ir_thermometer_driver.c"
+#include "mlx90614_whitebox.h"
+
+uint8_t whitebox_calculate_pec(uint8_t init_pec, uint8_t new_data)
+{
+    return calculate_pec(init_pec, new_data);
+}
+
+uint8_t whitebox_wait_mlx90614_retry(const MLX90614_Retry_Policy *policy, uint8_t attempt)
+{
+    return wait_mlx90614_retry(policy, attempt);
+}
+
+uint8_t whitebox_calculate_mlx90614_log_crc(const uint8_t *data, size_t n)
+{
+    return calculate_mlx90614_log_crc(data, n);
+}
+
+uint8_t whitebox_write_mlx90614_log_varint(uint8_t *dst, int32_t delta)
+{
+    return write_mlx90614_log_varint(dst, delta);
+}
+
+uint8_t whitebox_read_mlx90614_log_varint(const uint8_t *src, size_t remaining, int32_t *delta)
+{
+    return read_mlx90614_log_varint(src, remaining, delta);
+}
+
+uint32_t whitebox_calculate_mlx90614_isqrt(uint64_t value)
+{
+    return calculate_mlx90614_isqrt(value);
+}
+
+#if (MLX90614_ENABLE_STATS)
+void whitebox_record_mlx90614_cycles(MLX90614_Stats_Op op, uint32_t cycles)
+{
+    record_mlx90614_cycles(op, cycles);
+}
+#endif
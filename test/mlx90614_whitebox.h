@@ -0,0 +1,43 @@
+/**@file
+ * @brief	White-box access of the host-side tests to the static functions of the MLX90614 Infra Red Thermometer's
+ *          driver.
+ *
+ * @details The "mlx90614_whitebox.c" file compiles the @ref mlx90614 by including its source file, so that the
+ *          functions declared here can reach its static functions. Therefore, the tests and the benchmark are linked
+ *          against that file instead of against the source file of the @ref mlx90614 .
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#ifndef MLX90614_WHITEBOX_H_
+#define MLX90614_WHITEBOX_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <stddef.h> // This library contains the alias: size_t.
+#include "mlx90614_ir_thermometer_driver.h"
+
+/**@brief	Calls the static \c calculate_pec function of the @ref mlx90614 . */
+uint8_t whitebox_calculate_pec(uint8_t init_pec, uint8_t new_data);
+
+/**@brief	Calls the static \c wait_mlx90614_retry function of the @ref mlx90614 . */
+uint8_t whitebox_wait_mlx90614_retry(const MLX90614_Retry_Policy *policy, uint8_t attempt);
+
+/**@brief	Calls the static \c calculate_mlx90614_log_crc function of the @ref mlx90614 . */
+uint8_t whitebox_calculate_mlx90614_log_crc(const uint8_t *data, size_t n);
+
+/**@brief	Calls the static \c write_mlx90614_log_varint function of the @ref mlx90614 . */
+uint8_t whitebox_write_mlx90614_log_varint(uint8_t *dst, int32_t delta);
+
+/**@brief	Calls the static \c read_mlx90614_log_varint function of the @ref mlx90614 . */
+uint8_t whitebox_read_mlx90614_log_varint(const uint8_t *src, size_t remaining, int32_t *delta);
+
+/**@brief	Calls the static \c calculate_mlx90614_isqrt function of the @ref mlx90614 . */
+uint32_t whitebox_calculate_mlx90614_isqrt(uint64_t value);
+
+#if (MLX90614_ENABLE_STATS)
+/**@brief	Calls the static \c record_mlx90614_cycles function of the @ref mlx90614 . */
+void whitebox_record_mlx90614_cycles(MLX90614_Stats_Op op, uint32_t cycles);
+#endif
+
+#endif /* MLX90614_WHITEBOX_H_ */
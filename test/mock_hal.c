@@ -0,0 +1,570 @@
+/** @addtogroup mock_hal
+ * @{
+ */
+
+#define _POSIX_C_SOURCE 199309L // Exposes the "clock_gettime" function of the "time.h" header file.
+#include "mock_hal.h"
+#include <string.h> // Library from which "memset" and "memcpy" are located at.
+#include <time.h>   // Library from which "clock_gettime" is located at.
+
+#define MOCK_HAL_I2C_WRITE_BIT          (0x00)      /**< @brief Value of the R/W bit of the SMBus whenever writing. */
+#define MOCK_HAL_I2C_READ_BIT           (0x01)      /**< @brief Value of the R/W bit of the SMBus whenever reading. */
+#define MOCK_HAL_EEPROM_COMMAND         (0x20)      /**< @brief First command of the EEPROM of a MLX90614 Device. */
+#define MOCK_HAL_SLEEP_COMMAND          (0xFF)      /**< @brief Command that sends a MLX90614 Device to its Sleep Mode. */
+#define MOCK_HAL_RAW_AT_25_CELSIUS      (14908)     /**< @brief Raw Value of a MLX90614 Device at 25°C (i.e., \f$298.15K/0.02K\f$ rounded to the nearest integer). */
+
+/**@brief	Asynchronous I2C transaction of the @ref mock_hal that is in process.
+ */
+typedef struct
+{
+    I2C_HandleTypeDef *hi2c;    /**< @brief I2C Handle of the transaction, or \c NULL if this slot is free. */
+    uint16_t dev_address;       /**< @brief Slave address of the transaction, shifted to the left by one bit. */
+    uint8_t command;            /**< @brief Command of the transaction (i.e., the RAM or EEPROM address being read). */
+    uint8_t *p_data;            /**< @brief Buffer into which the read bytes will be stored. */
+    uint16_t size;              /**< @brief Number of bytes that were requested. */
+    uint32_t due_tick;          /**< @brief Value of the HAL tick at which the transaction concludes. */
+} Mock_HAL_Transfer;
+
+volatile uint32_t mock_hal_tick;
+uint32_t mock_hal_tick_step = 1;
+uint32_t mock_hal_delayed_ms;
+uint32_t mock_hal_probes;
+uint32_t mock_hal_i2c_inits;
+uint32_t mock_hal_aborts;
+uint32_t mock_hal_primask;
+uint32_t mock_hal_irq_disables;
+GPIO_PinState mock_hal_gpio_read_state = GPIO_PIN_SET;
+uint32_t mock_hal_tim_capture[2];
+char mock_hal_uart_output[MOCK_HAL_UART_BUFFER_SIZE];
+uint32_t SystemCoreClock = 72000000;
+DWT_Type mock_hal_dwt;
+
+static Mock_MLX90614 devices[MOCK_HAL_MAX_DEVICES];     /**< @brief Simulated MLX90614 Devices, where only the first @ref device_count of them are used. */
+static uint8_t device_count;                            /**< @brief Number of simulated MLX90614 Devices. */
+static Mock_HAL_Transfer transfers[MOCK_HAL_MAX_TRANSFERS]; /**< @brief Asynchronous I2C transactions in process. */
+static uint8_t is_in_interrupt;                         /**< @brief Flag indicating whether an Asynchronous I2C transaction is being concluded, which keeps the callbacks from concluding other ones. */
+static size_t uart_length;                              /**< @brief Number of characters held in @ref mock_hal_uart_output . */
+static uint32_t low_pin_tick;                           /**< @brief Value of the HAL tick at which a GPIO pin was driven low. */
+static uint16_t low_pin;                                /**< @brief GPIO pin that is being driven low, or \c 0 if none. */
+
+/**@brief	Finds the simulated MLX90614 Device that answers to the given slave address on the given bus.
+ *
+ * @param[in] hi2c          I2C Handle of the bus.
+ * @param dev_address       Slave address, shifted to the left by one bit.
+ *
+ * @return  A pointer to the MLX90614 Device, or \c NULL if there is none (in which case the slave address is NACKed).
+ */
+static Mock_MLX90614 *find_device(I2C_HandleTypeDef *hi2c, uint16_t dev_address)
+{
+    /** <b>Local uint8_t variable address:</b> 7-bit slave address of interest. */
+    uint8_t address = (uint8_t) (dev_address >> 1);
+    for (uint8_t i=0; i<device_count; i++)
+    {
+        if (devices[i].is_present && (devices[i].hi2c == hi2c) && ((devices[i].address == address) || (address == 0x00)))
+        {
+            return &devices[i];
+        }
+    }
+    return NULL;
+}
+
+/**@brief	Takes the next I2C transaction addressed to the given MLX90614 Device, by consuming one of its busy or
+ *          NACK counts if it has any.
+ *
+ * @param[in,out] hi2c  I2C Handle of the bus.
+ * @param[in,out] dev   MLX90614 Device addressed, or \c NULL if none answered.
+ *
+ * @retval  HAL_OK      If the MLX90614 Device acknowledges the I2C transaction.
+ * @retval  HAL_BUSY    If the bus was found to be busy.
+ * @retval  HAL_ERROR   If the I2C transaction was NACKed, in which case the \c ErrorCode of \p hi2c is set.
+ */
+static HAL_StatusTypeDef address_device(I2C_HandleTypeDef *hi2c, Mock_MLX90614 *dev)
+{
+    if ((dev != NULL) && (dev->busy_left != 0))
+    {
+        dev->busy_left--;
+        return HAL_BUSY;
+    }
+    if ((dev == NULL) || dev->is_asleep || (dev->nacks_left != 0))
+    {
+        if ((dev != NULL) && !dev->is_asleep)
+        {
+            dev->nacks_left--;
+        }
+        hi2c->ErrorCode = HAL_I2C_ERROR_AF;
+        return HAL_ERROR;
+    }
+    hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+    return HAL_OK;
+}
+
+/**@brief	Gives back the bytes that the given MLX90614 Device sends for the given command, followed by its PEC.
+ *
+ * @param[in,out] dev   MLX90614 Device being read.
+ * @param dev_address   Slave address used, shifted to the left by one bit.
+ * @param command       Command being read.
+ * @param[out] p_data   Buffer into which the bytes will be stored.
+ * @param size          Number of bytes requested, which is at most \c 3 .
+ */
+static void read_device(Mock_MLX90614 *dev, uint16_t dev_address, uint8_t command, uint8_t *p_data, uint16_t size)
+{
+    /** <b>Local uint16_t variable word:</b> Word held at the RAM or EEPROM address given by \p command . */
+    uint16_t word = 0;
+    if (command < MOCK_HAL_EEPROM_COMMAND)
+    {
+        word = dev->ram[command];
+    }
+    else if (command < (MOCK_HAL_EEPROM_COMMAND + 0x20))
+    {
+        word = dev->eeprom[command - MOCK_HAL_EEPROM_COMMAND];
+    }
+    /** <b>Local uint8_t array frame:</b> Every byte of the SMBus Read Word frame, over which the PEC is calculated. */
+    uint8_t frame[6] = {(uint8_t) ((dev_address & 0xFE) | MOCK_HAL_I2C_WRITE_BIT), command, (uint8_t) ((dev_address & 0xFE) | MOCK_HAL_I2C_READ_BIT), (uint8_t) word, (uint8_t) (word >> 8), 0};
+    frame[5] = mock_hal_calculate_pec(frame, 5) ^ (dev->is_pec_corrupted ? 0x01 : 0x00);
+    memcpy(p_data, &frame[3], (size > 3) ? 3 : size);
+    dev->reads++;
+}
+
+/**@brief	Concludes every Asynchronous I2C transaction whose latency has elapsed, by calling its callback.
+ */
+static void conclude_due_transfers(void)
+{
+    if (is_in_interrupt)
+    {
+        return;
+    }
+    is_in_interrupt = 1;
+    for (uint8_t i=0; i<MOCK_HAL_MAX_TRANSFERS; i++)
+    {
+        /** <b>Local pointer t:</b> Points to the Asynchronous I2C transaction being evaluated. */
+        Mock_HAL_Transfer *t = &transfers[i];
+        if ((t->hi2c == NULL) || ((int32_t) (mock_hal_tick - t->due_tick) < 0))
+        {
+            continue;
+        }
+        /** <b>Local pointer hi2c:</b> Points to the I2C Handle of the concluded transaction. */
+        I2C_HandleTypeDef *hi2c = t->hi2c;
+        /** <b>Local pointer dev:</b> Points to the MLX90614 Device addressed by the concluded transaction. */
+        Mock_MLX90614 *dev = find_device(hi2c, t->dev_address);
+        if ((dev != NULL) && dev->is_completion_lost)
+        {
+            continue;
+        }
+        t->hi2c = NULL;
+        hi2c->State = HAL_I2C_STATE_READY;
+        /** <b>Local HAL_StatusTypeDef variable ret:</b> Whether the MLX90614 Device acknowledged the transaction. */
+        HAL_StatusTypeDef ret = address_device(hi2c, dev);
+        if (ret == HAL_OK)
+        {
+            read_device(dev, t->dev_address, t->command, t->p_data, t->size);
+            HAL_I2C_MemRxCpltCallback(hi2c);
+        }
+        else
+        {
+            if (ret == HAL_BUSY)
+            {
+                hi2c->ErrorCode = HAL_I2C_ERROR_TIMEOUT;
+            }
+            HAL_I2C_ErrorCallback(hi2c);
+        }
+    }
+    is_in_interrupt = 0;
+}
+
+/**@brief	Starts an Asynchronous I2C transaction, which is common to the DMA and Interrupt Modes.
+ */
+static HAL_StatusTypeDef start_transfer(I2C_HandleTypeDef *hi2c, uint16_t dev_address, uint16_t command, uint8_t *p_data, uint16_t size)
+{
+    /** <b>Local uint8_t variable free_slot:</b> Index of the slot of @ref transfers that will be used. */
+    uint8_t free_slot = MOCK_HAL_MAX_TRANSFERS;
+    if (hi2c->State != HAL_I2C_STATE_READY)
+    {
+        return HAL_BUSY;
+    }
+    for (uint8_t i=0; i<MOCK_HAL_MAX_TRANSFERS; i++)
+    {
+        if (transfers[i].hi2c == hi2c)
+        {
+            return HAL_BUSY;
+        }
+        if ((transfers[i].hi2c == NULL) && (free_slot == MOCK_HAL_MAX_TRANSFERS))
+        {
+            free_slot = i;
+        }
+    }
+    if (free_slot == MOCK_HAL_MAX_TRANSFERS)
+    {
+        return HAL_BUSY;
+    }
+
+    /** <b>Local pointer dev:</b> Points to the MLX90614 Device addressed, if any. */
+    Mock_MLX90614 *dev = find_device(hi2c, dev_address);
+    transfers[free_slot].dev_address = dev_address;
+    transfers[free_slot].command = (uint8_t) command;
+    transfers[free_slot].p_data = p_data;
+    transfers[free_slot].size = size;
+    transfers[free_slot].due_tick = mock_hal_tick + ((dev != NULL) ? dev->latency_ms : 0);
+    hi2c->State = HAL_I2C_STATE_BUSY_RX;
+    transfers[free_slot].hi2c = hi2c;
+    return HAL_OK;
+}
+
+void mock_hal_reset(void)
+{
+    memset(devices, 0, sizeof(devices));
+    memset(transfers, 0, sizeof(transfers));
+    device_count = 0;
+    is_in_interrupt = 0;
+    mock_hal_tick = 0;
+    mock_hal_tick_step = 1;
+    mock_hal_delayed_ms = 0;
+    mock_hal_probes = 0;
+    mock_hal_i2c_inits = 0;
+    mock_hal_aborts = 0;
+    mock_hal_primask = 0;
+    mock_hal_irq_disables = 0;
+    mock_hal_gpio_read_state = GPIO_PIN_SET;
+    mock_hal_tim_capture[0] = 0;
+    mock_hal_tim_capture[1] = 0;
+    mock_hal_uart_output[0] = '\0';
+    uart_length = 0;
+    low_pin = 0;
+}
+
+void mock_hal_init_i2c(I2C_HandleTypeDef *hi2c, I2C_TypeDef *instance)
+{
+    memset(hi2c, 0, sizeof(*hi2c));
+    memset((void *) instance, 0, sizeof(*instance));
+    hi2c->Instance = instance;
+    hi2c->Init.ClockSpeed = 100000;
+    hi2c->State = HAL_I2C_STATE_READY;
+}
+
+Mock_MLX90614 *mock_hal_add_device(I2C_HandleTypeDef *hi2c, uint8_t address)
+{
+    if (device_count >= MOCK_HAL_MAX_DEVICES)
+    {
+        return NULL;
+    }
+
+    /** <b>Local pointer dev:</b> Points to the MLX90614 Device being added. */
+    Mock_MLX90614 *dev = &devices[device_count++];
+    memset(dev, 0, sizeof(*dev));
+    dev->hi2c = hi2c;
+    dev->address = address;
+    dev->is_present = 1;
+    dev->ram[0x06] = MOCK_HAL_RAW_AT_25_CELSIUS;
+    dev->ram[0x07] = MOCK_HAL_RAW_AT_25_CELSIUS;
+    dev->ram[0x08] = MOCK_HAL_RAW_AT_25_CELSIUS;
+    dev->eeprom[0x00] = 0x9993;     // T_O,MAX of the PWM output.
+    dev->eeprom[0x01] = 0x62E3;     // T_O,MIN of the PWM output.
+    dev->eeprom[0x04] = 0xFFFF;     // Emissivity of 1.0.
+    dev->eeprom[0x05] = 0x9FB4;     // "ConfigRegister1" Register.
+    dev->eeprom[0x0E] = (uint16_t) (0xBE00 | address);
+    return dev;
+}
+
+void mock_hal_advance(uint32_t ms)
+{
+    mock_hal_tick += ms;
+    conclude_due_transfers();
+}
+
+uint8_t mock_hal_pending(void)
+{
+    /** <b>Local uint8_t variable count:</b> Number of Asynchronous I2C transactions in process. */
+    uint8_t count = 0;
+    for (uint8_t i=0; i<MOCK_HAL_MAX_TRANSFERS; i++)
+    {
+        count += (transfers[i].hi2c != NULL);
+    }
+    return count;
+}
+
+uint8_t mock_hal_calculate_pec(const uint8_t *data, size_t size)
+{
+    /** <b>Local uint8_t variable crc:</b> CRC-8 calculated so far. */
+    uint8_t crc = 0x00;
+    for (size_t i=0; i<size; i++)
+    {
+        crc ^= data[i];
+        for (uint8_t bit=0; bit<8; bit++)
+        {
+            crc = (crc & 0x80) ? (uint8_t) ((crc << 1) ^ 0x07) : (uint8_t) (crc << 1);
+        }
+    }
+    return crc;
+}
+
+uint32_t mock_hal_get_cycles(void)
+{
+    /** <b>Local struct timespec variable now:</b> Current time of the monotonic clock of the host computer. */
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t) ((uint64_t) now.tv_sec*1000000000ULL + (uint64_t) now.tv_nsec);
+}
+
+uint32_t __get_PRIMASK(void)
+{
+    return mock_hal_primask;
+}
+
+void __set_PRIMASK(uint32_t priMask)
+{
+    mock_hal_primask = priMask;
+}
+
+void __disable_irq(void)
+{
+    mock_hal_primask = 1;
+    mock_hal_irq_disables++;
+}
+
+uint32_t HAL_GetTick(void)
+{
+    /** <b>Local uint32_t variable tick:</b> Value of the HAL tick before advancing it. */
+    uint32_t tick = mock_hal_tick;
+    mock_hal_tick += mock_hal_tick_step;
+    conclude_due_transfers();
+    return tick;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    mock_hal_delayed_ms += Delay;
+    mock_hal_advance(Delay);
+}
+
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c)
+{
+    mock_hal_i2c_inits++;
+    hi2c->State = HAL_I2C_STATE_READY;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef *hi2c)
+{
+    hi2c->State = HAL_I2C_STATE_RESET;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Trials, uint32_t Timeout)
+{
+    (void) Timeout;
+    mock_hal_probes++;
+    /** <b>Local pointer dev:</b> Points to the MLX90614 Device addressed, if any. */
+    Mock_MLX90614 *dev = find_device(hi2c, DevAddress);
+    /** <b>Local HAL_StatusTypeDef variable ret:</b> Result of the last trial. */
+    HAL_StatusTypeDef ret = HAL_ERROR;
+    for (uint32_t i=0; (i<Trials) && (ret != HAL_OK); i++)
+    {
+        ret = address_device(hi2c, dev);
+    }
+    return ret;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    (void) MemAddSize;
+    if (hi2c->State != HAL_I2C_STATE_READY)
+    {
+        return HAL_BUSY;
+    }
+    /** <b>Local pointer dev:</b> Points to the MLX90614 Device addressed, if any. */
+    Mock_MLX90614 *dev = find_device(hi2c, DevAddress);
+    if ((dev != NULL) && (dev->latency_ms > Timeout))
+    {
+        mock_hal_advance(Timeout);
+        hi2c->ErrorCode = HAL_I2C_ERROR_TIMEOUT;
+        return HAL_TIMEOUT;
+    }
+    /** <b>Local HAL_StatusTypeDef variable ret:</b> Whether the MLX90614 Device acknowledged the transaction. */
+    HAL_StatusTypeDef ret = address_device(hi2c, dev);
+    if (ret != HAL_OK)
+    {
+        return ret;
+    }
+    mock_hal_advance(dev->latency_ms);
+    read_device(dev, DevAddress, (uint8_t) MemAddress, pData, Size);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size)
+{
+    (void) MemAddSize;
+    return start_transfer(hi2c, DevAddress, MemAddress, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size)
+{
+    (void) MemAddSize;
+    return start_transfer(hi2c, DevAddress, MemAddress, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    (void) Timeout;
+    if (hi2c->State != HAL_I2C_STATE_READY)
+    {
+        return HAL_BUSY;
+    }
+    /** <b>Local pointer dev:</b> Points to the MLX90614 Device addressed, if any. */
+    Mock_MLX90614 *dev = find_device(hi2c, DevAddress);
+    /** <b>Local HAL_StatusTypeDef variable ret:</b> Whether the MLX90614 Device acknowledged the transaction. */
+    HAL_StatusTypeDef ret = address_device(hi2c, dev);
+    if (ret != HAL_OK)
+    {
+        return ret;
+    }
+
+    /* A MLX90614 Device NACKs the PEC byte of any write whose PEC is wrong, in which case it ignores that write. */
+    /** <b>Local uint8_t array frame:</b> Slave address followed by every byte sent, except for the PEC. */
+    uint8_t frame[4] = {(uint8_t) ((DevAddress & 0xFE) | MOCK_HAL_I2C_WRITE_BIT), 0, 0, 0};
+    if ((Size < 2) || (Size > 4))
+    {
+        hi2c->ErrorCode = HAL_I2C_ERROR_AF;
+        return HAL_ERROR;
+    }
+    memcpy(&frame[1], pData, Size - 1);
+    if (mock_hal_calculate_pec(frame, Size) != pData[Size - 1])
+    {
+        hi2c->ErrorCode = HAL_I2C_ERROR_AF;
+        return HAL_ERROR;
+    }
+    mock_hal_advance(dev->latency_ms);
+
+    if ((Size == 2) && (pData[0] == MOCK_HAL_SLEEP_COMMAND))
+    {
+        dev->is_asleep = 1;
+        dev->sleeps++;
+    }
+    else if ((Size == 4) && (pData[0] >= MOCK_HAL_EEPROM_COMMAND) && (pData[0] < (MOCK_HAL_EEPROM_COMMAND + 0x20)))
+    {
+        /** <b>Local pointer cell:</b> Points to the EEPROM word being either erased or written. */
+        uint16_t *cell = &dev->eeprom[pData[0] - MOCK_HAL_EEPROM_COMMAND];
+        /** <b>Local uint16_t variable word:</b> Word being written. */
+        uint16_t word = (uint16_t) (pData[1] | (pData[2] << 8));
+        if ((word != 0x0000) && (*cell != 0x0000))
+        {
+            dev->writes_without_erase++;
+        }
+        *cell = word;
+        dev->writes++;
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Abort_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress)
+{
+    (void) DevAddress;
+    for (uint8_t i=0; i<MOCK_HAL_MAX_TRANSFERS; i++)
+    {
+        if (transfers[i].hi2c == hi2c)
+        {
+            transfers[i].hi2c = NULL;
+            hi2c->State = HAL_I2C_STATE_READY;
+            mock_hal_aborts++;
+            return HAL_OK;
+        }
+    }
+    return HAL_ERROR;
+}
+
+uint32_t HAL_I2C_GetError(I2C_HandleTypeDef *hi2c)
+{
+    return hi2c->ErrorCode;
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+    (void) GPIOx;
+    (void) GPIO_Init;
+}
+
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin)
+{
+    (void) GPIOx;
+    (void) GPIO_Pin;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    (void) GPIOx;
+    if (PinState == GPIO_PIN_RESET)
+    {
+        low_pin = GPIO_Pin;
+        low_pin_tick = mock_hal_tick;
+        return;
+    }
+
+    /* Releasing SDA after having held it low for long enough is taken as the wake up pulse of every MLX90614 Device. */
+    if ((GPIO_Pin == MOCK_HAL_SDA_PIN) && (low_pin == GPIO_Pin) && ((mock_hal_tick - low_pin_tick) >= MOCK_HAL_WAKE_PULSE_TIME))
+    {
+        for (uint8_t i=0; i<device_count; i++)
+        {
+            devices[i].is_asleep = 0;
+        }
+    }
+    /* A clock pulse on SCL makes every MLX90614 Device that keeps the bus busy release SDA. */
+    if ((GPIO_Pin != MOCK_HAL_SDA_PIN) && (low_pin == GPIO_Pin))
+    {
+        for (uint8_t i=0; i<device_count; i++)
+        {
+            devices[i].busy_left = 0;
+        }
+    }
+    if (low_pin == GPIO_Pin)
+    {
+        low_pin = 0;
+    }
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+    (void) GPIOx;
+    if (GPIO_Pin == MOCK_HAL_SDA_PIN)
+    {
+        for (uint8_t i=0; i<device_count; i++)
+        {
+            if (devices[i].is_present && (devices[i].busy_left != 0))
+            {
+                return GPIO_PIN_RESET; // This MLX90614 Device holds SDA low, which keeps the bus busy.
+            }
+        }
+    }
+    return mock_hal_gpio_read_state;
+}
+
+HAL_StatusTypeDef HAL_TIM_IC_Start(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    (void) htim;
+    (void) Channel;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_IC_Stop(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    (void) htim;
+    (void) Channel;
+    return HAL_OK;
+}
+
+uint32_t HAL_TIM_ReadCapturedValue(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    (void) htim;
+    return mock_hal_tim_capture[(Channel == TIM_CHANNEL_1) ? 0 : 1];
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    (void) huart;
+    (void) Timeout;
+    for (uint16_t i=0; (i<Size) && (uart_length < (MOCK_HAL_UART_BUFFER_SIZE - 1)); i++)
+    {
+        mock_hal_uart_output[uart_length++] = (char) pData[i];
+    }
+    mock_hal_uart_output[uart_length] = '\0';
+    return HAL_OK;
+}
+
+/** @} */
@@ -0,0 +1,286 @@
+/**@file
+ * @brief	Host-side mock of the STM32 HAL functions used by the MLX90614 Infra Red Thermometer's driver.
+ *
+ * @defgroup mock_hal Mock HAL module
+ * @{
+ *
+ * @brief   This module provides the HAL types and functions that the @ref mlx90614 uses, but implemented on a host
+ *          computer over one or more simulated MLX90614 Devices, so that the @ref mlx90614 can be unit tested and
+ *          benchmarked without any hardware. It is included by the @ref mlx90614 instead of the
+ *          "stm32f1xx_hal.h" header file via <tt>-DMLX90614_HAL_HEADER='"mock_hal.h"'</tt> .
+ *
+ * @details Each simulated MLX90614 Device is a @ref Mock_MLX90614 , which is added via @ref mock_hal_add_device and
+ *          which answers to its slave address on the I2C Handle to which it was wired with the values of its RAM and
+ *          EEPROM, followed by the PEC that a real MLX90614 Device would send. Its latency, the NACKs that it gives,
+ *          the Error Flags of its RAM values and the corruption of its PEC can all be configured by editing its
+ *          members, and the HAL tick can be advanced via @ref mock_hal_advance .
+ * @details The Asynchronous I2C transactions (i.e., via @ref HAL_I2C_Mem_Read_IT or @ref HAL_I2C_Mem_Read_DMA )
+ *          conclude once their latency has elapsed, by calling the \c HAL_I2C_MemRxCpltCallback or the
+ *          \c HAL_I2C_ErrorCallback functions, which must be defined by the program that uses this module in the same
+ *          way as they are defined by any application of the @ref mlx90614 . This happens from within
+ *          @ref HAL_GetTick , @ref HAL_Delay and @ref mock_hal_advance , which is how a busy-waiting loop sees an
+ *          Interrupt come in.
+ *
+ * @note    Every call to @ref HAL_GetTick advances the HAL tick by @ref mock_hal_tick_step milliseconds (\c 1 by
+ *          default), so that any busy-waiting loop of the @ref mlx90614 ends up reaching its timeout.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#ifndef MOCK_HAL_H_
+#define MOCK_HAL_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <stddef.h> // This library contains the alias: size_t.
+
+#define HAL_TIM_MODULE_ENABLED              /**< @brief Enables the PWM Reader of the @ref mlx90614 , as the "stm32f1xx_hal_conf.h" header file does whenever the TIM module is used. */
+#define HAL_UART_MODULE_ENABLED             /**< @brief Enables the UART report of the Benchmark of the @ref mlx90614 , as the "stm32f1xx_hal_conf.h" header file does whenever the UART module is used. */
+#define HAL_MAX_DELAY                       (0xFFFFFFFFU)
+#define HAL_I2C_ERROR_NONE                  (0x00000000U)
+#define HAL_I2C_ERROR_AF                    (0x00000004U)
+#define HAL_I2C_ERROR_TIMEOUT               (0x00000020U)
+
+#define GPIO_PIN_6                          ((uint16_t) 0x0040)
+#define GPIO_PIN_7                          ((uint16_t) 0x0080)
+#define GPIO_MODE_OUTPUT_OD                 (0x00000011U)
+#define GPIO_NOPULL                         (0x00000000U)
+#define GPIO_SPEED_FREQ_HIGH                (0x00000003U)
+
+#define TIM_CHANNEL_1                       (0x00000000U)
+#define TIM_CHANNEL_2                       (0x00000004U)
+
+#define I2C_CR1_START                       (1U << 8)
+#define I2C_CR1_STOP                        (1U << 9)
+#define I2C_CR1_ACK                         (1U << 10)
+#define I2C_CR1_POS                         (1U << 11)
+#define I2C_CR1_SWRST                       (1U << 15)
+#define I2C_SR1_SB                          (1U << 0)
+#define I2C_SR1_ADDR                        (1U << 1)
+#define I2C_SR1_BTF                         (1U << 2)
+#define I2C_SR1_RXNE                        (1U << 6)
+#define I2C_SR1_AF                          (1U << 10)
+#define I2C_SR2_BUSY                        (1U << 1)
+
+#define __DMB()                             __sync_synchronize()
+
+#define MOCK_HAL_MAX_DEVICES                (8)      /**< @brief Maximum number of @ref Mock_MLX90614 that can be simulated at the same time. */
+#define MOCK_HAL_MAX_TRANSFERS              (4)      /**< @brief Maximum number of Asynchronous I2C transactions that can be in process at the same time, where there can only be one of them per I2C Handle. */
+#define MOCK_HAL_UART_BUFFER_SIZE           (4096)   /**< @brief Size in bytes of @ref mock_hal_uart_output . */
+#define MOCK_HAL_WAKE_PULSE_TIME            (33)     /**< @brief Minimum time in milliseconds during which @ref MOCK_HAL_SDA_PIN has to be held low for the @ref Mock_MLX90614 in Sleep Mode to wake up, which is the \f$t_{DDQ}\f$ of the MLX90614 Datasheet. */
+#define MOCK_HAL_SDA_PIN                    (GPIO_PIN_7) /**< @brief GPIO pin that is taken as the SDA of every simulated I2C bus, whereas holding any other one low (e.g., SCL during the Sleep Mode) never wakes up a @ref Mock_MLX90614 . */
+
+typedef enum
+{
+    HAL_OK      = 0x00U,
+    HAL_ERROR   = 0x01U,
+    HAL_BUSY    = 0x02U,
+    HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+    HAL_I2C_STATE_RESET   = 0x00U,
+    HAL_I2C_STATE_READY   = 0x20U,
+    HAL_I2C_STATE_BUSY_RX = 0x22U
+} HAL_I2C_StateTypeDef;
+
+typedef enum
+{
+    GPIO_PIN_RESET = 0U,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+typedef struct
+{
+    volatile uint32_t CR1, CR2, OAR1, OAR2, DR, SR1, SR2, CCR, TRISE;
+} I2C_TypeDef;
+
+typedef struct
+{
+    uint32_t ClockSpeed;
+    uint32_t DutyCycle;
+    uint32_t OwnAddress1;
+    uint32_t AddressingMode;
+} I2C_InitTypeDef;
+
+typedef struct
+{
+    I2C_TypeDef *Instance;
+    I2C_InitTypeDef Init;
+    volatile HAL_I2C_StateTypeDef State;
+    volatile uint32_t ErrorCode;
+} I2C_HandleTypeDef;
+
+typedef struct
+{
+    volatile uint32_t CRL, CRH, IDR, ODR, BSRR, BRR, LCKR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+    uint32_t Pin;
+    uint32_t Mode;
+    uint32_t Pull;
+    uint32_t Speed;
+} GPIO_InitTypeDef;
+
+typedef struct
+{
+    void *Instance;
+} TIM_HandleTypeDef;
+
+typedef struct
+{
+    void *Instance;
+} UART_HandleTypeDef;
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+/**@brief	Simulated MLX90614 Device Structure definition.
+ *
+ * @note    All the members of this structure can be freely edited by the tests in order to configure how the simulated
+ *          MLX90614 Device behaves, except for the counters, which are only updated by the @ref mock_hal .
+ */
+typedef struct
+{
+    I2C_HandleTypeDef *hi2c;    /**< @brief I2C Handle of the bus to which this MLX90614 Device is wired. */
+    uint8_t address;            /**< @brief 7-bit slave address to which this MLX90614 Device answers, besides the \c 0x00 one that every MLX90614 Device answers to. */
+    uint8_t is_present;         /**< @brief Flag indicating whether this MLX90614 Device is wired to its bus ( \c 1 ) or not ( \c 0 ). */
+    uint8_t is_asleep;          /**< @brief Flag indicating whether this MLX90614 Device is in its Sleep Mode ( \c 1 ), in which it NACKs everything until a wake up pulse is given, or not ( \c 0 ). */
+    uint8_t is_pec_corrupted;   /**< @brief Flag indicating whether this MLX90614 Device sends a wrong PEC ( \c 1 ) or not ( \c 0 ). */
+    uint8_t is_completion_lost; /**< @brief Flag indicating whether the Asynchronous I2C transactions to this MLX90614 Device never conclude ( \c 1 ), as if their Interrupt was lost, or whether they do ( \c 0 ). */
+    uint32_t latency_ms;        /**< @brief Time in milliseconds that each I2C transaction to this MLX90614 Device takes, where a blocking one times out if this is greater than its timeout. */
+    uint32_t nacks_left;        /**< @brief Number of the upcoming I2C transactions that this MLX90614 Device will NACK. */
+    uint32_t busy_left;         /**< @brief Number of the upcoming I2C transactions to this MLX90614 Device that will find the bus busy, while any of which are left this MLX90614 Device holds @ref MOCK_HAL_SDA_PIN low, until a clock pulse is given on any other pin (i.e., on SCL). */
+    uint16_t ram[0x20];         /**< @brief RAM words of this MLX90614 Device, where \c 0x06 , \c 0x07 and \c 0x08 hold the Raw Values of the Ambient, Object1 and Object2 Temperatures. */
+    uint16_t eeprom[0x20];      /**< @brief EEPROM words of this MLX90614 Device, indexed by their offset from the \c 0x20 command. */
+    uint32_t reads;             /**< @brief Number of words that have been read from this MLX90614 Device. */
+    uint32_t writes;            /**< @brief Number of EEPROM words that have been either erased or written into this MLX90614 Device. */
+    uint32_t writes_without_erase; /**< @brief Number of EEPROM words that were written without having been erased first. */
+    uint32_t sleeps;            /**< @brief Number of times that this MLX90614 Device has been sent to its Sleep Mode. */
+} Mock_MLX90614;
+
+extern volatile uint32_t mock_hal_tick;         /**< @brief Current value of the HAL tick, in milliseconds. */
+extern uint32_t mock_hal_tick_step;             /**< @brief Milliseconds that the HAL tick advances on every call to @ref HAL_GetTick . */
+extern uint32_t mock_hal_delayed_ms;            /**< @brief Sum of all the milliseconds waited via @ref HAL_Delay . */
+extern uint32_t mock_hal_probes;                /**< @brief Number of calls made to @ref HAL_I2C_IsDeviceReady . */
+extern uint32_t mock_hal_i2c_inits;             /**< @brief Number of calls made to @ref HAL_I2C_Init . */
+extern uint32_t mock_hal_aborts;                /**< @brief Number of Asynchronous I2C transactions aborted via @ref HAL_I2C_Master_Abort_IT . */
+extern uint32_t mock_hal_primask;               /**< @brief Value of the simulated PRIMASK register, which is \c 1 while the interrupts are masked. */
+extern uint32_t mock_hal_irq_disables;          /**< @brief Number of calls made to @ref __disable_irq . */
+extern GPIO_PinState mock_hal_gpio_read_state;  /**< @brief Value given back by @ref HAL_GPIO_ReadPin (e.g., \c GPIO_PIN_RESET simulates a device holding SDA low). */
+extern uint32_t mock_hal_tim_capture[2];        /**< @brief Values given back by @ref HAL_TIM_ReadCapturedValue for the \c TIM_CHANNEL_1 and \c TIM_CHANNEL_2 channels. */
+extern char mock_hal_uart_output[MOCK_HAL_UART_BUFFER_SIZE]; /**< @brief Null terminated text sent so far via @ref HAL_UART_Transmit . */
+extern uint32_t SystemCoreClock;                /**< @brief Core clock in Hertz, as defined by the CMSIS "system_stm32f1xx.c" file. */
+extern DWT_Type mock_hal_dwt;                   /**< @brief Registers of the simulated DWT unit. */
+#define DWT                                 (&mock_hal_dwt)
+
+/**@brief	Removes all the @ref Mock_MLX90614 , cancels all the Asynchronous I2C transactions in process and resets
+ *          the HAL tick and all the counters of the @ref mock_hal .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void mock_hal_reset(void);
+
+/**@brief	Initializes the given I2C Handle as if it had been generated by the STM32CubeMX for a 100kHz bus, whose
+ *          I2C Peripheral registers are left as they are after a reset.
+ *
+ * @param[out] hi2c         Pointer to the I2C Handle that wants to be initialized.
+ * @param[out] instance     Pointer to the registers of the I2C Peripheral of \p hi2c .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void mock_hal_init_i2c(I2C_HandleTypeDef *hi2c, I2C_TypeDef *instance);
+
+/**@brief	Adds a @ref Mock_MLX90614 wired to the given I2C Handle, whose RAM and EEPROM are initialized with the
+ *          factory defaults (i.e., 25°C on every temperature channel, an Emissivity of \c 1.0 and a "ConfigRegister1"
+ *          Register of \c 0x9FB4 ).
+ *
+ * @param[in] hi2c      Pointer to the I2C Handle of the bus to which the MLX90614 Device is wired.
+ * @param address       7-bit slave address of the MLX90614 Device.
+ *
+ * @return  A pointer to the added @ref Mock_MLX90614 , or \c NULL if there are already
+ *          @ref MOCK_HAL_MAX_DEVICES of them.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+Mock_MLX90614 *mock_hal_add_device(I2C_HandleTypeDef *hi2c, uint8_t address);
+
+/**@brief	Advances the HAL tick by the given time, concluding every Asynchronous I2C transaction whose latency
+ *          elapses meanwhile.
+ *
+ * @param ms    Milliseconds that the HAL tick wants to be advanced.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void mock_hal_advance(uint32_t ms);
+
+/**@brief	Gets the number of Asynchronous I2C transactions that are in process.
+ *
+ * @return  The number of Asynchronous I2C transactions in process.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint8_t mock_hal_pending(void);
+
+/**@brief	Calculates, bit by bit, the SMBus PEC (i.e., the CRC-8 with the \f$x^8+x^2+x+1\f$ polynomial) of the
+ *          given bytes, which is the reference against which the PEC of the @ref mlx90614 is tested.
+ *
+ * @param[in] data  Pointer to the bytes whose PEC wants to be calculated.
+ * @param size      Number of bytes in \p data .
+ *
+ * @return  The PEC of the given bytes.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint8_t mock_hal_calculate_pec(const uint8_t *data, size_t size);
+
+/**@brief	Gets a free-running count of nanoseconds of the host computer, which stands for the DWT Cycle Counter of a
+ *          1GHz core (see @ref MLX90614_CYCLE_COUNTER ).
+ *
+ * @return  The current count, which wraps around every \f$2^{32}\f$ nanoseconds.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+uint32_t mock_hal_get_cycles(void);
+
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t priMask);
+void __disable_irq(void);
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Trials, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Master_Abort_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress);
+uint32_t HAL_I2C_GetError(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c);
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+HAL_StatusTypeDef HAL_TIM_IC_Start(TIM_HandleTypeDef *htim, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_IC_Stop(TIM_HandleTypeDef *htim, uint32_t Channel);
+uint32_t HAL_TIM_ReadCapturedValue(TIM_HandleTypeDef *htim, uint32_t Channel);
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout);
+
+#endif /* MOCK_HAL_H_ */
+
+/** @} */
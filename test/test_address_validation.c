@@ -0,0 +1,158 @@
+/**@file
+ * @brief	Tests of the Slave Address Validations with which a @ref MLX90614_Handle accepts each new slave address,
+ *          which either probe it, defer it to the first successful reading or look it up in a cached scan.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+static void test_probe_validation_probes_every_new_address(void)
+{
+    MLX90614_Handle hmlx;
+
+    mock_hal_add_device(&test_hi2c1, 0x5A);
+    mock_hal_add_device(&test_hi2c1, 0x10);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+#if (MLX90614_DEFAULT_ADDRESS_VALIDATION == MLX90614_ADDRESS_VALIDATION_PROBE)
+    UNIT_TEST_ASSERT_EQUAL(1, mock_hal_probes);
+    UNIT_TEST_ASSERT(is_mlx90614_handle_slave_address_verified(&hmlx));
+#else
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_probes);
+    UNIT_TEST_ASSERT(!is_mlx90614_handle_slave_address_verified(&hmlx));
+#endif
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_address_validation(&hmlx, MLX90614_ADDRESS_VALIDATION_PROBE));
+    mock_hal_probes = 0;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, set_mlx90614_handle_slave_address(&hmlx, 0x5B));
+    UNIT_TEST_ASSERT_EQUAL(0x5A, hmlx.slave_address);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_slave_address(&hmlx, 0x10));
+    UNIT_TEST_ASSERT_EQUAL(0x10, hmlx.slave_address);
+    UNIT_TEST_ASSERT(is_mlx90614_handle_slave_address_verified(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(2, mock_hal_probes);
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, set_mlx90614_handle_slave_address(&hmlx, 0x00));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, set_mlx90614_handle_slave_address(&hmlx, 0x7F));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, set_mlx90614_handle_address_validation(&hmlx, MLX90614_ADDRESS_VALIDATION_SCAN));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, set_mlx90614_handle_address_validation(&hmlx, 7));
+    UNIT_TEST_ASSERT_EQUAL(2, mock_hal_probes);
+}
+
+static void test_lazy_validation_trusts_the_first_successful_reading(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Sample sample;
+    uint16_t raw;
+
+    mock_hal_add_device(&test_hi2c1, 0x10);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_address_validation(&hmlx, MLX90614_ADDRESS_VALIDATION_LAZY));
+    mock_hal_probes = 0;
+
+    /* Switching between known MLX90614 Devices is a pure RAM operation. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_slave_address(&hmlx, 0x5B));
+    UNIT_TEST_ASSERT(!is_mlx90614_handle_slave_address_verified(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT(!is_mlx90614_handle_slave_address_verified(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_slave_address(&hmlx, 0x10));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_slave_address(&hmlx, 0x5A));
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_probes);
+    UNIT_TEST_ASSERT_EQUAL(0, dev->reads);
+
+    /* Once a reading has succeeded, a NACK is a HAL Error instead of a missing MLX90614 Device. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT(is_mlx90614_handle_slave_address_verified(&hmlx));
+    dev->nacks_left = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+
+    /* An Asynchronous reading also confirms a new slave address. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_slave_address(&hmlx, 0x10));
+    UNIT_TEST_ASSERT(!is_mlx90614_handle_slave_address_verified(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_all_temperatures_async(&hmlx, &sample, NULL));
+    while (mock_hal_pending() != 0)
+    {
+        mock_hal_advance(1);
+    }
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_CPLT, get_mlx90614_handle_async_state(&hmlx));
+    UNIT_TEST_ASSERT(is_mlx90614_handle_slave_address_verified(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_probes);
+}
+
+static void test_found_slave_address_is_verified(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    uint16_t raw;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_address_validation(&hmlx, MLX90614_ADDRESS_VALIDATION_LAZY));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_slave_address(&hmlx, 0x10));
+    UNIT_TEST_ASSERT(!is_mlx90614_handle_slave_address_verified(&hmlx));
+
+    /* The slave address that has been found has already acknowledged its MLX90614 Device. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, find_mlx90614_handle_slave_address(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(0x5A, hmlx.slave_address);
+    UNIT_TEST_ASSERT(is_mlx90614_handle_slave_address_verified(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(0, dev->reads);
+    dev->nacks_left = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+}
+
+static void test_scan_validation_looks_up_the_cached_scan(void)
+{
+#if (MLX90614_ENABLE_SCAN)
+    MLX90614_Handle hmlx;
+    MLX90614_Scan_Result scan = {0};
+
+    mock_hal_add_device(&test_hi2c1, 0x5A);
+    mock_hal_add_device(&test_hi2c1, 0x10);
+    mock_hal_add_device(&test_hi2c2, 0x5B);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, set_mlx90614_handle_address_scan(&hmlx, NULL));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, scan_mlx90614_bus(&test_hi2c1, &scan, MLX90614_SCAN_PROBE_TIMEOUT, 0));
+    UNIT_TEST_ASSERT_EQUAL(2, scan.count);
+    UNIT_TEST_ASSERT(is_mlx90614_address_in_scan(&scan, 0x10));
+    UNIT_TEST_ASSERT(!is_mlx90614_address_in_scan(&scan, 0x5B));
+
+    /* A completed scan is reused unless a rescan is forced. */
+    mock_hal_probes = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, scan_mlx90614_bus(&test_hi2c1, &scan, MLX90614_SCAN_PROBE_TIMEOUT, 0));
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_probes);
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_address_scan(&hmlx, &scan));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, set_mlx90614_handle_slave_address(&hmlx, 0x5B));
+    UNIT_TEST_ASSERT_EQUAL(0x5A, hmlx.slave_address);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_slave_address(&hmlx, 0x10));
+    UNIT_TEST_ASSERT(is_mlx90614_handle_slave_address_verified(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_probes);
+
+    /* An invalidated scan cannot tell anything, so the new slave addresses are probed instead. */
+    invalidate_mlx90614_scan(&scan);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, set_mlx90614_handle_slave_address(&hmlx, 0x5B));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_slave_address(&hmlx, 0x5A));
+    UNIT_TEST_ASSERT_EQUAL(2, mock_hal_probes);
+
+    /* A forced rescan picks up the MLX90614 Devices that came up since the last one. */
+    mock_hal_add_device(&test_hi2c1, 0x5B);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, scan_mlx90614_bus(&test_hi2c1, &scan, MLX90614_SCAN_PROBE_TIMEOUT, 1));
+    UNIT_TEST_ASSERT_EQUAL(3, scan.count);
+    mock_hal_probes = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_slave_address(&hmlx, 0x5B));
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_probes);
+
+    /* A bus without any MLX90614 Device still gives a completed scan. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, scan_mlx90614_bus(&test_hi2c3, &scan, MLX90614_SCAN_PROBE_TIMEOUT, 1));
+    UNIT_TEST_ASSERT(scan.is_valid);
+    UNIT_TEST_ASSERT_EQUAL(0, scan.count);
+#endif
+}
+
+void run_address_validation_tests(void)
+{
+    UNIT_TEST_RUN(test_probe_validation_probes_every_new_address);
+    UNIT_TEST_RUN(test_lazy_validation_trusts_the_first_successful_reading);
+    UNIT_TEST_RUN(test_found_slave_address_is_verified);
+    UNIT_TEST_RUN(test_scan_validation_looks_up_the_cached_scan);
+}
@@ -0,0 +1,139 @@
+/**@file
+ * @brief	Tests of the aggregation of the readings of several redundant MLX90614 Devices, which are spread over
+ *          several I2C Peripherals and may NACK, raise Error Flags, corrupt their PEC or never conclude a reading.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+#define TEST_AGGREGATE_DEVICES  (5) /**< @brief Number of redundant MLX90614 Devices under test. */
+
+static Mock_MLX90614 *devs[TEST_AGGREGATE_DEVICES];         /**< @brief Simulated redundant MLX90614 Devices. */
+static MLX90614_Handle hmlx[TEST_AGGREGATE_DEVICES];        /**< @brief Handles of each of @ref devs . */
+static MLX90614_Handle *handles[TEST_AGGREGATE_DEVICES];    /**< @brief Pointers to each of @ref hmlx . */
+
+/**@brief	Adds three Object1 readings of the given Raw Values on @ref test_hi2c1 and the other two on
+ *          @ref test_hi2c2 , so that both I2C Peripherals are read in parallel. */
+static void add_redundant_devices(const uint16_t *raws)
+{
+    for (uint8_t i=0; i<TEST_AGGREGATE_DEVICES; i++)
+    {
+        I2C_HandleTypeDef *hi2c = (i < 3) ? &test_hi2c1 : &test_hi2c2;
+        uint8_t address = (uint8_t) (0x5A + i);
+        devs[i] = mock_hal_add_device(hi2c, address);
+        devs[i]->ram[0x07] = raws[i];
+        UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx[i], hi2c, address, MLX90614_Temp_C));
+        handles[i] = &hmlx[i];
+    }
+}
+
+static void test_aggregate_gives_mean_median_and_deviation(void)
+{
+    const uint16_t raws[TEST_AGGREGATE_DEVICES] = {15000, 15010, 14990, 15100, 15004};
+    MLX90614_Aggregate aggregate;
+
+    add_redundant_devices(raws);
+    devs[3]->latency_ms = 2;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, aggregate_mlx90614_handles(handles, TEST_AGGREGATE_DEVICES, MLX90614_Ch_Tobj1, &aggregate));
+    UNIT_TEST_ASSERT_EQUAL(5, aggregate.valid_count);
+    UNIT_TEST_ASSERT_EQUAL(0x1F, aggregate.valid_mask);
+    UNIT_TEST_ASSERT_EQUAL(15021, aggregate.mean_raw);     // 75104/5 = 15020.8 .
+    UNIT_TEST_ASSERT_EQUAL(15004, aggregate.median_raw);
+    UNIT_TEST_ASSERT_EQUAL(96, aggregate.max_deviation_raw);
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_pending());
+    for (uint8_t i=0; i<TEST_AGGREGATE_DEVICES; i++)
+    {
+        UNIT_TEST_ASSERT_EQUAL(3, devs[i]->reads); // Each MLX90614 Device is read exactly once, with all of its channels.
+    }
+
+    /* Any other temperature channel is aggregated in the same way. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, aggregate_mlx90614_handles(handles, TEST_AGGREGATE_DEVICES, MLX90614_Ch_Ta, &aggregate));
+    UNIT_TEST_ASSERT_EQUAL(14908, aggregate.mean_raw);
+    UNIT_TEST_ASSERT_EQUAL(14908, aggregate.median_raw);
+    UNIT_TEST_ASSERT_EQUAL(0, aggregate.max_deviation_raw);
+}
+
+static void test_aggregate_excludes_failed_devices(void)
+{
+    const uint16_t raws[TEST_AGGREGATE_DEVICES] = {15000, 0x8000 | 15000, 15007, 15200, 15004};
+    MLX90614_Aggregate aggregate;
+
+    add_redundant_devices(raws);
+    devs[3]->is_pec_corrupted = 1;
+    set_mlx90614_handle_pec_check(&hmlx[3], 1);
+    devs[4]->nacks_left = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, aggregate_mlx90614_handles(handles, TEST_AGGREGATE_DEVICES, MLX90614_Ch_Tobj1, &aggregate));
+    UNIT_TEST_ASSERT_EQUAL(2, aggregate.valid_count);
+    UNIT_TEST_ASSERT_EQUAL(0x05, aggregate.valid_mask);
+    UNIT_TEST_ASSERT_EQUAL(15004, aggregate.mean_raw);     // 30007/2 = 15003.5 .
+    UNIT_TEST_ASSERT_EQUAL(15003, aggregate.median_raw);   // The mean of the two middle ones, rounded down.
+    UNIT_TEST_ASSERT_EQUAL(4, aggregate.max_deviation_raw);
+
+    /* Without any valid Raw Value, only the number and the mask of the valid ones are given. */
+    devs[0]->ram[0x07] = 0x8000;
+    devs[2]->is_present = 0;
+    devs[4]->is_present = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, aggregate_mlx90614_handles(handles, TEST_AGGREGATE_DEVICES, MLX90614_Ch_Tobj1, &aggregate));
+    UNIT_TEST_ASSERT_EQUAL(0, aggregate.valid_count);
+    UNIT_TEST_ASSERT_EQUAL(0, aggregate.valid_mask);
+}
+
+static void test_aggregate_aborts_readings_at_its_deadline(void)
+{
+    const uint16_t raws[TEST_AGGREGATE_DEVICES] = {15000, 15010, 14990, 15100, 15004};
+    MLX90614_Aggregate aggregate;
+
+    add_redundant_devices(raws);
+    devs[1]->is_completion_lost = 1;
+    /** <b>Local uint32_t variable tickstart:</b> Value of the HAL tick before aggregating. */
+    uint32_t tickstart = mock_hal_tick;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, aggregate_mlx90614_handles(handles, TEST_AGGREGATE_DEVICES, MLX90614_Ch_Tobj1, &aggregate));
+    UNIT_TEST_ASSERT(mock_hal_tick - tickstart <= 3*hmlx[0].retry_policy.timeout_ms + 10);
+    UNIT_TEST_ASSERT_EQUAL(1, mock_hal_aborts);
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_pending());
+
+    /* The MLX90614 Devices after the one that never concluded its reading are left out on its Lane only. */
+    UNIT_TEST_ASSERT_EQUAL(3, aggregate.valid_count);
+    UNIT_TEST_ASSERT_EQUAL(0x19, aggregate.valid_mask);
+    UNIT_TEST_ASSERT_EQUAL(15004, aggregate.median_raw);
+    UNIT_TEST_ASSERT_EQUAL(0, devs[2]->reads);
+
+    /* The aborted reading must not keep its I2C Peripheral from being read again. */
+    devs[1]->is_completion_lost = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, aggregate_mlx90614_handles(handles, TEST_AGGREGATE_DEVICES, MLX90614_Ch_Tobj1, &aggregate));
+    UNIT_TEST_ASSERT_EQUAL(0x1F, aggregate.valid_mask);
+}
+
+static void test_aggregate_rejects_invalid_arguments(void)
+{
+    const uint16_t raws[TEST_AGGREGATE_DEVICES] = {15000, 15010, 14990, 15100, 15004};
+    /** <b>Local I2C_TypeDef variable i2c4_registers:</b> Registers of the I2C Peripheral of \c hi2c4 . */
+    static I2C_TypeDef i2c4_registers;
+    /** <b>Local I2C_HandleTypeDef variable hi2c4:</b> I2C Handle of a fourth I2C Peripheral. */
+    static I2C_HandleTypeDef hi2c4;
+    MLX90614_Aggregate aggregate;
+
+    add_redundant_devices(raws);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, aggregate_mlx90614_handles(handles, 0, MLX90614_Ch_Tobj1, &aggregate));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, aggregate_mlx90614_handles(handles, MLX90614_AGGREGATE_MAX_HANDLES + 1, MLX90614_Ch_Tobj1, &aggregate));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, aggregate_mlx90614_handles(handles, TEST_AGGREGATE_DEVICES, (MLX90614_Channel_t) 3, &aggregate));
+
+    /* More I2C Peripherals than those that can be read asynchronously at once. */
+    mock_hal_init_i2c(&hi2c4, &i2c4_registers);
+    mock_hal_add_device(&test_hi2c3, 0x5A);
+    mock_hal_add_device(&hi2c4, 0x5A);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx[1], &test_hi2c3, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx[2], &hi2c4, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, aggregate_mlx90614_handles(handles, TEST_AGGREGATE_DEVICES, MLX90614_Ch_Tobj1, &aggregate));
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_pending());
+}
+
+void run_aggregate_tests(void)
+{
+    UNIT_TEST_RUN(test_aggregate_gives_mean_median_and_deviation);
+    UNIT_TEST_RUN(test_aggregate_excludes_failed_devices);
+    UNIT_TEST_RUN(test_aggregate_aborts_readings_at_its_deadline);
+    UNIT_TEST_RUN(test_aggregate_rejects_invalid_arguments);
+}
@@ -0,0 +1,165 @@
+/**@file
+ * @brief	Tests of the Asynchronous temperature readings of the @ref mlx90614 (see
+ *          @ref get_mlx90614_handle_object1_temperature_async ), whose outcome is either reported by their callbacks
+ *          or polled via @ref get_mlx90614_handle_async_state .
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+static MLX90614_Status last_status;     /**< @brief Exception Code passed to the last call of @ref record_temperature . */
+static float last_temperature;          /**< @brief Temperature passed to the last call of @ref record_temperature . */
+static uint8_t calls;                   /**< @brief Number of calls made to @ref record_temperature . */
+
+/**@brief	@ref MLX90614_Async_Callback that records the Asynchronous readings that conclude. */
+static void record_temperature(MLX90614_Handle *hmlx, MLX90614_Status status, float temperature)
+{
+    (void) hmlx;
+    last_status = status;
+    last_temperature = temperature;
+    calls++;
+}
+
+/**@brief	Lets the simulated time run until every Asynchronous I2C transaction has concluded. */
+static void conclude_transfers(void)
+{
+    while (mock_hal_pending() != 0)
+    {
+        mock_hal_advance(1);
+    }
+}
+
+static void test_async_reading_is_polled_until_collected(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    float temperature;
+    int32_t centi_temperature;
+
+    dev->ram[0x06] = 14908;     // 25°C.
+    dev->ram[0x08] = 13658;     // 0°C.
+    dev->latency_ms = 2;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_IDLE, get_mlx90614_handle_async_state(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, get_mlx90614_handle_async_temperature(&hmlx, &temperature));
+
+    /* Nothing can be collected, nor requested again, while the I2C transaction is in process. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_ambient_temperature_async(&hmlx, NULL));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_BUSY, get_mlx90614_handle_async_state(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, get_mlx90614_handle_async_temperature(&hmlx, &temperature));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_object2_temperature_async(&hmlx, NULL));
+    mock_hal_advance(1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_BUSY, get_mlx90614_handle_async_state(&hmlx));
+    mock_hal_advance(1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_CPLT, get_mlx90614_handle_async_state(&hmlx));
+
+    /* Collecting the result takes the Handle back to its idle state. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_async_temperature(&hmlx, &temperature));
+    UNIT_TEST_ASSERT_FLOAT(25.01, temperature, 0.001);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_IDLE, get_mlx90614_handle_async_state(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, get_mlx90614_handle_async_temperature(&hmlx, &temperature));
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object2_temperature_async(&hmlx, NULL));
+    conclude_transfers();
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_async_centi_temperature(&hmlx, &centi_temperature));
+    UNIT_TEST_ASSERT_EQUAL(1, centi_temperature);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_IDLE, get_mlx90614_handle_async_state(&hmlx));
+}
+
+static void test_async_reading_calls_its_callback(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    float temperature;
+
+    calls = 0;
+    dev->ram[0x07] = 15658;     // 40°C.
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature_async(&hmlx, record_temperature));
+    UNIT_TEST_ASSERT_EQUAL(0, calls);
+    conclude_transfers();
+    UNIT_TEST_ASSERT_EQUAL(1, calls);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, last_status);
+    UNIT_TEST_ASSERT_FLOAT(40.01, last_temperature, 0.001);
+
+    /* An Error Flag, a NACK and a corrupted PEC are all reported to the callback and then collected once. */
+    dev->ram[0x07] = 0x8000 | 15658;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature_async(&hmlx, record_temperature));
+    conclude_transfers();
+    UNIT_TEST_ASSERT_EQUAL(2, calls);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, last_status);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_ERR, get_mlx90614_handle_async_state(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_async_temperature(&hmlx, &temperature));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_IDLE, get_mlx90614_handle_async_state(&hmlx));
+
+    dev->ram[0x07] = 15658;
+    dev->nacks_left = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature_async(&hmlx, record_temperature));
+    conclude_transfers();
+    UNIT_TEST_ASSERT_EQUAL(3, calls);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, last_status);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_async_temperature(&hmlx, &temperature));
+
+    set_mlx90614_handle_pec_check(&hmlx, 1);
+    dev->is_pec_corrupted = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature_async(&hmlx, record_temperature));
+    conclude_transfers();
+    UNIT_TEST_ASSERT_EQUAL(4, calls);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, last_status);
+    dev->is_pec_corrupted = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature_async(&hmlx, record_temperature));
+    conclude_transfers();
+    UNIT_TEST_ASSERT_EQUAL(5, calls);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, last_status);
+    UNIT_TEST_ASSERT_FLOAT(40.01, last_temperature, 0.001);
+}
+
+static void test_foreign_i2c_completions_are_ignored(void)
+{
+    mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+
+    calls = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature_async(&hmlx, record_temperature));
+    mlx90614_i2c_mem_rx_cplt_callback(&test_hi2c2);
+    mlx90614_i2c_error_callback(&test_hi2c2);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_BUSY, get_mlx90614_handle_async_state(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(0, calls);
+    conclude_transfers();
+    UNIT_TEST_ASSERT_EQUAL(1, calls);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, last_status);
+}
+
+static void test_async_slot_is_claimed_with_the_interrupts_masked(void)
+{
+    mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature_async(&hmlx, NULL));
+    UNIT_TEST_ASSERT_EQUAL(1, mock_hal_irq_disables);
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_primask);
+
+    /* A slot that cannot be claimed unmasks the interrupts too, whereas already masked ones are left masked. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_object1_temperature_async(&hmlx, NULL));
+    UNIT_TEST_ASSERT_EQUAL(2, mock_hal_irq_disables);
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_primask);
+    conclude_transfers();
+    mock_hal_primask = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object2_temperature_async(&hmlx, NULL));
+    UNIT_TEST_ASSERT_EQUAL(1, mock_hal_primask);
+    mock_hal_primask = 0;
+    conclude_transfers();
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_CPLT, get_mlx90614_handle_async_state(&hmlx));
+}
+
+void run_async_reading_tests(void)
+{
+    UNIT_TEST_RUN(test_async_reading_is_polled_until_collected);
+    UNIT_TEST_RUN(test_async_reading_calls_its_callback);
+    UNIT_TEST_RUN(test_foreign_i2c_completions_are_ignored);
+    UNIT_TEST_RUN(test_async_slot_is_claimed_with_the_interrupts_masked);
+}
@@ -0,0 +1,123 @@
+/**@file
+ * @brief	Tests of the batch conversions of Raw Values, whose results must be identical to those of their scalar
+ *          counterparts, and whose Error Flag validation must catch a flagged Raw Value at any position of the block.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+#define TEST_BATCH_SIZE     (0x8000)    /**< @brief Number of Raw Values converted by the exhaustive tests, which covers every valid Raw Value. */
+
+static uint16_t raw_values[TEST_BATCH_SIZE];    /**< @brief Raw Values to be converted. */
+static float float_values[TEST_BATCH_SIZE];     /**< @brief Results of the @ref mlx90614_convert_batch function. */
+static int32_t centi_values[TEST_BATCH_SIZE];   /**< @brief Results of the @ref mlx90614_convert_centi_batch function. */
+
+static void fill_raw_values(void)
+{
+    for (uint32_t i=0; i<TEST_BATCH_SIZE; i++)
+    {
+        raw_values[i] = (uint16_t) i;
+    }
+}
+
+static void test_centi_batch_matches_the_scalar_conversion(void)
+{
+    const MLX90614_Temp_t types[] = {MLX90614_Temp_K, MLX90614_Temp_C, MLX90614_Temp_F, (MLX90614_Temp_t) 7};
+    fill_raw_values();
+    for (uint8_t t=0; t<sizeof(types)/sizeof(types[0]); t++)
+    {
+        /** <b>Local unsigned int variable mismatches:</b> Number of Raw Values whose batch and scalar results differ. */
+        unsigned int mismatches = 0;
+        UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, mlx90614_convert_centi_batch(raw_values, centi_values, TEST_BATCH_SIZE, types[t]));
+        for (uint32_t i=0; i<TEST_BATCH_SIZE; i++)
+        {
+            mismatches += (centi_values[i] != get_mlx90614_converted_centi_temperature(raw_values[i], types[t]));
+        }
+        UNIT_TEST_ASSERT_EQUAL(0, mismatches);
+    }
+}
+
+static void test_float_batch_matches_the_scalar_conversion(void)
+{
+    /* NOTE: These are the same float expressions that the scalar conversion functions of the @ref mlx90614 evaluate. */
+    fill_raw_values();
+    /** <b>Local unsigned int variable mismatches:</b> Number of Raw Values whose batch and scalar results differ. */
+    unsigned int mismatches = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, mlx90614_convert_batch(raw_values, float_values, TEST_BATCH_SIZE, MLX90614_Temp_C));
+    for (uint32_t i=0; i<TEST_BATCH_SIZE; i++)
+    {
+        mismatches += (float_values[i] != ((float) raw_values[i])*0.02f - 273.15f);
+    }
+    UNIT_TEST_ASSERT_EQUAL(0, mismatches);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, mlx90614_convert_batch(raw_values, float_values, TEST_BATCH_SIZE, MLX90614_Temp_F));
+    for (uint32_t i=0; i<TEST_BATCH_SIZE; i++)
+    {
+        mismatches += (float_values[i] != ((float) raw_values[i])*0.036f - 459.67f);
+    }
+    UNIT_TEST_ASSERT_EQUAL(0, mismatches);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, mlx90614_convert_batch(raw_values, float_values, TEST_BATCH_SIZE, MLX90614_Temp_K));
+    for (uint32_t i=0; i<TEST_BATCH_SIZE; i++)
+    {
+        mismatches += (float_values[i] != ((float) raw_values[i])*0.02f);
+    }
+    UNIT_TEST_ASSERT_EQUAL(0, mismatches);
+}
+
+static void test_float_batch_matches_the_readings_of_the_device(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    float temperature;
+
+    fill_raw_values();
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, mlx90614_convert_batch(raw_values, float_values, TEST_BATCH_SIZE, MLX90614_Temp_C));
+    for (uint32_t i=0; i<TEST_BATCH_SIZE; i+=997)
+    {
+        dev->ram[0x07] = raw_values[i];
+        UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature(&hmlx, &temperature));
+        UNIT_TEST_ASSERT(temperature == float_values[i]);
+    }
+}
+
+static void test_batches_flag_an_error_at_any_position_and_any_length(void)
+{
+    for (size_t n=0; n<=9; n++)
+    {
+        for (size_t i=0; i<n; i++)
+        {
+            raw_values[i] = (uint16_t) (14000 + i);
+        }
+        UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, mlx90614_convert_centi_batch(raw_values, centi_values, n, MLX90614_Temp_C));
+        UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, mlx90614_convert_batch(raw_values, float_values, n, MLX90614_Temp_C));
+        for (size_t i=0; i<n; i++)
+        {
+            UNIT_TEST_ASSERT_EQUAL(2*(14000 + (int32_t) i) - 27315, centi_values[i]);
+        }
+
+        /* A flagged Raw Value must be caught both within the unrolled loop and within its remainder. */
+        for (size_t flagged=0; flagged<n; flagged++)
+        {
+            raw_values[flagged] |= 0x8000;
+            UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, mlx90614_convert_centi_batch(raw_values, centi_values, n, MLX90614_Temp_F));
+            UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, mlx90614_convert_centi_batch(raw_values, centi_values, n, MLX90614_Temp_K));
+            UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, mlx90614_convert_batch(raw_values, float_values, n, MLX90614_Temp_C));
+            raw_values[flagged] &= 0x7FFF;
+        }
+    }
+
+    /* The results past the given length must be left untouched. */
+    centi_values[5] = -1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, mlx90614_convert_centi_batch(raw_values, centi_values, 5, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(-1, centi_values[5]);
+}
+
+void run_batch_conversion_tests(void)
+{
+    UNIT_TEST_RUN(test_centi_batch_matches_the_scalar_conversion);
+    UNIT_TEST_RUN(test_float_batch_matches_the_scalar_conversion);
+    UNIT_TEST_RUN(test_float_batch_matches_the_readings_of_the_device);
+    UNIT_TEST_RUN(test_batches_flag_an_error_at_any_position_and_any_length);
+}
@@ -0,0 +1,136 @@
+/**@file
+ * @brief	Tests of the on-target Benchmark of the @ref mlx90614 (see @ref run_mlx90614_benchmark_case ), which are
+ *          only compiled whenever @ref MLX90614_ENABLE_BENCHMARK is enabled.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include <string.h> // Library from which "strchr" and "strstr" are located at.
+#include "unit_test.h"
+
+#if (MLX90614_ENABLE_BENCHMARK)
+#define TEST_ITERATIONS     (5)     /**< @brief Number of times that each Benchmark case is run. */
+#endif
+
+static void test_benchmark_case_is_validated(void)
+{
+#if (MLX90614_ENABLE_BENCHMARK)
+    mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Benchmark_Result result;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, run_mlx90614_benchmark_case(NULL, MLX90614_BENCHMARK_BLOCKING_FLOAT, TEST_ITERATIONS, &result));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, run_mlx90614_benchmark_case(&hmlx, MLX90614_BENCHMARK_BLOCKING_FLOAT, 0, &result));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, run_mlx90614_benchmark_case(&hmlx, MLX90614_BENCHMARK_NUMBER_OF_CASES, TEST_ITERATIONS, &result));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, run_mlx90614_benchmark_case(&hmlx, MLX90614_BENCHMARK_BLOCKING_FLOAT, TEST_ITERATIONS, NULL));
+#endif
+}
+
+static void test_benchmark_cases_count_their_samples(void)
+{
+#if (MLX90614_ENABLE_BENCHMARK)
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Benchmark_Result result;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    set_mlx90614_handle_freshness_window(&hmlx, 1000);
+
+    /* Every sample goes through the I2C bus, even though the Freshness Cache of the Handle would serve most of them. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, run_mlx90614_benchmark_case(&hmlx, MLX90614_BENCHMARK_BLOCKING_BURST, TEST_ITERATIONS, &result));
+    UNIT_TEST_ASSERT_EQUAL(TEST_ITERATIONS, result.samples);
+    UNIT_TEST_ASSERT_EQUAL(0, result.errors);
+    UNIT_TEST_ASSERT_EQUAL(TEST_ITERATIONS * MLX90614_NUMBER_OF_CHANNELS, dev->reads);
+    UNIT_TEST_ASSERT_EQUAL(1000, hmlx.freshness_window);
+    UNIT_TEST_ASSERT(result.cpu_cycles <= result.total_cycles);
+    UNIT_TEST_ASSERT_EQUAL(result.total_cycles / result.samples, result.cycles_per_sample);
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, run_mlx90614_benchmark_case(&hmlx, MLX90614_BENCHMARK_ASYNC_BURST, TEST_ITERATIONS, &result));
+    UNIT_TEST_ASSERT_EQUAL(TEST_ITERATIONS, result.samples);
+    UNIT_TEST_ASSERT_EQUAL(2 * TEST_ITERATIONS * MLX90614_NUMBER_OF_CHANNELS, dev->reads);
+    UNIT_TEST_ASSERT(result.cpu_cycles <= result.total_cycles);
+
+    /* Each iteration of the conversion cases gives a whole batch of samples without any I2C transaction. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, run_mlx90614_benchmark_case(&hmlx, MLX90614_BENCHMARK_CONVERT_CENTI, TEST_ITERATIONS, &result));
+    UNIT_TEST_ASSERT_EQUAL(TEST_ITERATIONS * MLX90614_BENCHMARK_BATCH_SIZE, result.samples);
+    UNIT_TEST_ASSERT_EQUAL(2 * TEST_ITERATIONS * MLX90614_NUMBER_OF_CHANNELS, dev->reads);
+
+    /* The iterations that fail are only counted as errors. */
+    dev->nacks_left = 2;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, run_mlx90614_benchmark_case(&hmlx, MLX90614_BENCHMARK_BLOCKING_FLOAT, TEST_ITERATIONS, &result));
+    UNIT_TEST_ASSERT_EQUAL(TEST_ITERATIONS - 2, result.samples);
+    UNIT_TEST_ASSERT_EQUAL(2, result.errors);
+    dev->nacks_left = TEST_ITERATIONS;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, run_mlx90614_benchmark_case(&hmlx, MLX90614_BENCHMARK_BLOCKING_CENTI, TEST_ITERATIONS, &result));
+    UNIT_TEST_ASSERT_EQUAL(0, result.samples);
+    UNIT_TEST_ASSERT_EQUAL(TEST_ITERATIONS, result.errors);
+    UNIT_TEST_ASSERT_EQUAL(0, result.samples_per_second);
+#endif
+}
+
+static void test_benchmark_report_restores_the_handle(void)
+{
+#if (MLX90614_ENABLE_BENCHMARK)
+    mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    UART_HandleTypeDef huart;
+    /** <b>Local uint32_t variable lines:</b> Number of lines in the report. */
+    uint32_t lines = 0;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    test_hi2c1.Init.ClockSpeed = 20000;
+    set_mlx90614_handle_pec_check(&hmlx, 1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, run_mlx90614_benchmark(&hmlx, NULL, 1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, run_mlx90614_benchmark(&hmlx, &huart, 0));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, run_mlx90614_benchmark(&hmlx, &huart, 1));
+    UNIT_TEST_ASSERT_EQUAL(20000, test_hi2c1.Init.ClockSpeed);
+    UNIT_TEST_ASSERT_EQUAL(1, hmlx.is_pec_check_enabled);
+
+    /* It holds its two heading lines plus one per case and SMBus clock, where only the I2C readings are reported with the PEC validation enabled too. */
+    for (const char *p=strchr(mock_hal_uart_output, '\n'); p!=NULL; p=strchr(p + 1, '\n'))
+    {
+        lines++;
+    }
+    UNIT_TEST_ASSERT_EQUAL('#', mock_hal_uart_output[0]);
+    UNIT_TEST_ASSERT_EQUAL(2 + 3*(2*MLX90614_BENCHMARK_CONVERT_FLOAT + (MLX90614_BENCHMARK_NUMBER_OF_CASES - MLX90614_BENCHMARK_CONVERT_FLOAT) - !MLX90614_ENABLE_SCAN), lines);
+    UNIT_TEST_ASSERT(strstr(mock_hal_uart_output, "\r\n100000,blocking_burst,1,1,0,") != NULL);
+#endif
+}
+
+static void test_benchmark_aborts_lost_async_readings(void)
+{
+#if (MLX90614_ENABLE_BENCHMARK)
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Benchmark_Result result;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+
+    /* The iteration whose completion is lost times out and ends the case, but its reading is aborted rather than left in process. */
+    dev->is_completion_lost = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, run_mlx90614_benchmark_case(&hmlx, MLX90614_BENCHMARK_ASYNC_SINGLE, TEST_ITERATIONS, &result));
+    UNIT_TEST_ASSERT_EQUAL(0, result.samples);
+    UNIT_TEST_ASSERT_EQUAL(1, result.errors);
+    UNIT_TEST_ASSERT_EQUAL(1, mock_hal_aborts);
+    UNIT_TEST_ASSERT(get_mlx90614_handle_async_state(&hmlx) != MLX90614_ASYNC_BUSY);
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_pending());
+    UNIT_TEST_ASSERT_EQUAL(HAL_I2C_STATE_READY, test_hi2c1.State);
+
+    dev->is_completion_lost = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, run_mlx90614_benchmark_case(&hmlx, MLX90614_BENCHMARK_ASYNC_SINGLE, TEST_ITERATIONS, &result));
+    UNIT_TEST_ASSERT_EQUAL(TEST_ITERATIONS, result.samples);
+    UNIT_TEST_ASSERT_EQUAL(0, result.errors);
+    UNIT_TEST_ASSERT_EQUAL(1, mock_hal_aborts);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_IDLE, get_mlx90614_handle_async_state(&hmlx));
+#endif
+}
+
+void run_benchmark_tests(void)
+{
+    UNIT_TEST_RUN(test_benchmark_case_is_validated);
+    UNIT_TEST_RUN(test_benchmark_cases_count_their_samples);
+    UNIT_TEST_RUN(test_benchmark_report_restores_the_handle);
+    UNIT_TEST_RUN(test_benchmark_aborts_lost_async_readings);
+}
@@ -0,0 +1,116 @@
+/**@file
+ * @brief	Tests of the burst readings of the @ref mlx90614 (see @ref get_mlx90614_handle_all_temperatures ), which
+ *          give the Ambient, Object1 and Object2 temperatures of a MLX90614 Device in a single @ref MLX90614_Sample .
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+static MLX90614_Status last_status;     /**< @brief Exception Code passed to the last call of @ref record_sample . */
+static MLX90614_Sample *last_sample;    /**< @brief Sample passed to the last call of @ref record_sample . */
+static uint8_t calls;                   /**< @brief Number of calls made to @ref record_sample . */
+
+/**@brief	@ref MLX90614_Sample_Callback that records the Asynchronous burst readings that conclude. */
+static void record_sample(MLX90614_Handle *hmlx, MLX90614_Status status, MLX90614_Sample *sample)
+{
+    (void) hmlx;
+    last_status = status;
+    last_sample = sample;
+    calls++;
+}
+
+/**@brief	Sets the Raw Values of the Ambient, Object1 and Object2 temperatures of the given MLX90614 Device. */
+static void set_raw_temperatures(Mock_MLX90614 *dev, uint16_t ta, uint16_t tobj1, uint16_t tobj2)
+{
+    dev->ram[0x06] = ta;
+    dev->ram[0x07] = tobj1;
+    dev->ram[0x08] = tobj2;
+}
+
+static void test_burst_read_gives_every_channel(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Sample sample;
+
+    set_raw_temperatures(dev, 14908, 15658, 13658);     // 25°C, 40°C and 0°C.
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_all_temperatures(&hmlx, &sample));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_NUMBER_OF_CHANNELS, dev->reads);
+    UNIT_TEST_ASSERT_EQUAL(14908, sample.raw[MLX90614_Ch_Ta]);
+    UNIT_TEST_ASSERT_EQUAL(15658, sample.raw[MLX90614_Ch_Tobj1]);
+    UNIT_TEST_ASSERT_EQUAL(13658, sample.raw[MLX90614_Ch_Tobj2]);
+    UNIT_TEST_ASSERT_FLOAT(25.01, sample.temperature[MLX90614_Ch_Ta], 0.001);
+    UNIT_TEST_ASSERT_FLOAT(40.01, sample.temperature[MLX90614_Ch_Tobj1], 0.001);
+    UNIT_TEST_ASSERT_FLOAT(0.01, sample.temperature[MLX90614_Ch_Tobj2], 0.001);
+
+    /* The first channel that fails ends the burst reading without reading the rest of them. */
+    dev->reads = 0;
+    dev->ram[0x07] = 0x8000 | 15658;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_all_temperatures(&hmlx, &sample));
+    UNIT_TEST_ASSERT_EQUAL(2, dev->reads);
+    dev->nacks_left = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_all_temperatures(&hmlx, &sample));
+    UNIT_TEST_ASSERT_EQUAL(2, dev->reads);
+}
+
+static void test_async_burst_read_chains_every_channel(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Sample sample;
+
+    calls = 0;
+    dev->latency_ms = 1;
+    set_raw_temperatures(dev, 14908, 15658, 13658);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_all_temperatures_async(&hmlx, &sample, record_sample));
+
+    /* Each channel is requested as soon as the previous one is received, and the callback is called only once. */
+    for (uint8_t channel=MLX90614_Ch_Ta; channel<MLX90614_NUMBER_OF_CHANNELS; channel++)
+    {
+        UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_BUSY, get_mlx90614_handle_async_state(&hmlx));
+        UNIT_TEST_ASSERT_EQUAL(1, mock_hal_pending());
+        UNIT_TEST_ASSERT_EQUAL(0, calls);
+        mock_hal_advance(1);
+        UNIT_TEST_ASSERT_EQUAL(channel + 1, dev->reads);
+    }
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_pending());
+    UNIT_TEST_ASSERT_EQUAL(1, calls);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, last_status);
+    UNIT_TEST_ASSERT(last_sample == &sample);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_CPLT, get_mlx90614_handle_async_state(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(13658, sample.raw[MLX90614_Ch_Tobj2]);
+    UNIT_TEST_ASSERT_FLOAT(40.01, sample.temperature[MLX90614_Ch_Tobj1], 0.001);
+
+    /* A channel that fails in the middle of the chain concludes the whole burst reading with its error. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_all_temperatures_async(&hmlx, &sample, record_sample));
+    mock_hal_advance(1);
+    dev->nacks_left = 1;
+    mock_hal_advance(1);
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_pending());
+    UNIT_TEST_ASSERT_EQUAL(2, calls);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, last_status);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_ERR, get_mlx90614_handle_async_state(&hmlx));
+
+    /* A burst reading that cannot be started leaves its I2C Peripheral free for the next one. */
+    test_hi2c1.State = HAL_I2C_STATE_BUSY_RX;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_all_temperatures_async(&hmlx, &sample, record_sample));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_IDLE, get_mlx90614_handle_async_state(&hmlx));
+    test_hi2c1.State = HAL_I2C_STATE_READY;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_all_temperatures_async(&hmlx, &sample, record_sample));
+    while (mock_hal_pending() != 0)
+    {
+        mock_hal_advance(1);
+    }
+    UNIT_TEST_ASSERT_EQUAL(3, calls);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, last_status);
+}
+
+void run_burst_read_tests(void)
+{
+    UNIT_TEST_RUN(test_burst_read_gives_every_channel);
+    UNIT_TEST_RUN(test_async_burst_read_chains_every_channel);
+}
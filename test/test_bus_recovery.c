@@ -0,0 +1,135 @@
+/**@file
+ * @brief	Tests of the recovery of a stuck I2C bus, either requested via @ref recover_mlx90614_i2c_bus or triggered
+ *          by the transactions of a @ref MLX90614_Handle that the HAL rejects with @ref HAL_BUSY .
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+static GPIO_TypeDef gpio_port;                                                          /**< @brief GPIO Port of both pins of the I2C bus under test. */
+static const MLX90614_Bus_Recovery recovery = {&gpio_port, GPIO_PIN_6, &gpio_port, MOCK_HAL_SDA_PIN}; /**< @brief Pins of the I2C bus under test. */
+
+static void test_recovery_reinitializes_the_peripheral(void)
+{
+    test_hi2c1.State = HAL_I2C_STATE_BUSY_RX;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, recover_mlx90614_i2c_bus(&test_hi2c1, &recovery));
+    UNIT_TEST_ASSERT_EQUAL(HAL_I2C_STATE_READY, test_hi2c1.State);
+    UNIT_TEST_ASSERT_EQUAL(1, mock_hal_i2c_inits);
+    UNIT_TEST_ASSERT_EQUAL(0, test_hi2c1.Instance->CR1 & I2C_CR1_SWRST);
+
+    /* A slave device that keeps holding SDA low is reported, although the I2C Peripheral is initialized again anyway. */
+    mock_hal_gpio_read_state = GPIO_PIN_RESET;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, recover_mlx90614_i2c_bus(&test_hi2c1, &recovery));
+    UNIT_TEST_ASSERT_EQUAL(HAL_I2C_STATE_READY, test_hi2c1.State);
+    UNIT_TEST_ASSERT_EQUAL(2, mock_hal_i2c_inits);
+#if (MLX90614_ENABLE_STATS)
+    MLX90614_Stats stats;
+    get_mlx90614_stats(&stats);
+    UNIT_TEST_ASSERT(stats.bus_recoveries >= 2);
+#endif
+}
+
+static void test_busy_reading_is_recovered_and_retried_once(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    uint16_t raw;
+
+    dev->ram[0x07] = 15000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    dev->busy_left = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_i2c_inits);
+
+    /* The MLX90614 Device that still holds SDA low after the rejected transaction releases it once SCL is clocked. */
+    set_mlx90614_handle_bus_recovery(&hmlx, &recovery);
+    dev->busy_left = 2;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(15000, raw);
+    UNIT_TEST_ASSERT_EQUAL(1, mock_hal_i2c_inits);
+    UNIT_TEST_ASSERT_EQUAL(1, dev->reads);
+
+    /* Only HAL_BUSY triggers a recovery, and the transaction is retried only once after it. */
+    dev->nacks_left = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(1, mock_hal_i2c_inits);
+    dev->busy_left = 2;
+    dev->nacks_left = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(2, mock_hal_i2c_inits);
+    UNIT_TEST_ASSERT_EQUAL(1, dev->reads);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+
+    /* A failed recovery is not followed by any retry. */
+    mock_hal_gpio_read_state = GPIO_PIN_RESET;
+    dev->busy_left = 2;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(3, mock_hal_i2c_inits);
+    UNIT_TEST_ASSERT_EQUAL(2, dev->reads);
+    mock_hal_gpio_read_state = GPIO_PIN_SET;
+
+    set_mlx90614_handle_bus_recovery(&hmlx, NULL);
+    dev->busy_left = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(3, mock_hal_i2c_inits);
+}
+
+static void test_bus_in_use_is_not_recovered(void)
+{
+    Mock_MLX90614 *dev1 = mock_hal_add_device(&test_hi2c1, 0x5A);
+    mock_hal_add_device(&test_hi2c1, 0x5B);
+    MLX90614_Handle hmlx1, hmlx2;
+    uint16_t raw;
+
+    dev1->ram[0x07] = 15000;
+    dev1->latency_ms = 5;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx1, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx2, &test_hi2c1, 0x5B, MLX90614_Temp_C));
+    set_mlx90614_handle_bus_recovery(&hmlx2, &recovery);
+
+    /* The HAL_BUSY given back while the Asynchronous reading of another Handle is in flight leaves that reading alone. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature_async(&hmlx1, NULL));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_raw_temperature(&hmlx2, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_i2c_inits);
+    UNIT_TEST_ASSERT_EQUAL(1, mock_hal_pending());
+    mock_hal_advance(5);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_CPLT, get_mlx90614_handle_async_state(&hmlx1));
+    UNIT_TEST_ASSERT_EQUAL(15000, hmlx1.async_raw);
+}
+
+static void test_busy_write_is_recovered_and_retried_once(void)
+{
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_EEPROM_Write job;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    set_mlx90614_handle_bus_recovery(&hmlx, &recovery);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, start_mlx90614_handle_eeprom_write(&job, &hmlx, 0x04, 0xFFFF, 0x8000, 0));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_mlx90614_eeprom_write(&job));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EEPROM_STAGE_ERASE, job.stage);
+
+    /* The erase command finds the I2C bus stuck. */
+    dev->busy_left = 2;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_mlx90614_eeprom_write(&job));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EEPROM_STAGE_ERASE_WAIT, job.stage);
+    UNIT_TEST_ASSERT_EQUAL(1, mock_hal_i2c_inits);
+    UNIT_TEST_ASSERT_EQUAL(0x0000, dev->eeprom[0x04]);
+    while (pump_mlx90614_eeprom_write(&job) == MLX90614_EC_NA)
+    {
+        mock_hal_advance(1);
+    }
+    UNIT_TEST_ASSERT_EQUAL(0x8000, dev->eeprom[0x04]);
+#endif
+}
+
+void run_bus_recovery_tests(void)
+{
+    UNIT_TEST_RUN(test_recovery_reinitializes_the_peripheral);
+    UNIT_TEST_RUN(test_busy_reading_is_recovered_and_retried_once);
+    UNIT_TEST_RUN(test_bus_in_use_is_not_recovered);
+    UNIT_TEST_RUN(test_busy_write_is_recovered_and_retried_once);
+}
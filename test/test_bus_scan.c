@@ -0,0 +1,77 @@
+/**@file
+ * @brief	Tests of the scan of all the valid slave addresses of an I2C bus into a @ref MLX90614_Scan_Result , and of
+ *          the iteration through the MLX90614 Devices that it found.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+static void test_scan_records_every_responding_address(void)
+{
+#if (MLX90614_ENABLE_SCAN)
+    MLX90614_Scan_Result scan = {0};
+    const uint8_t addresses[] = {0x03, 0x1F, 0x20, 0x5A, 0x7E};
+
+    for (uint8_t i=0; i<sizeof(addresses); i++)
+    {
+        mock_hal_add_device(&test_hi2c1, addresses[i]);
+    }
+    mock_hal_add_device(&test_hi2c2, 0x40);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, scan_mlx90614_bus(&test_hi2c1, &scan, MLX90614_SCAN_PROBE_TIMEOUT, 1));
+    UNIT_TEST_ASSERT(scan.is_valid);
+    UNIT_TEST_ASSERT_EQUAL(5, scan.count);
+    UNIT_TEST_ASSERT_EQUAL(124, mock_hal_probes); // Every valid slave address, i.e. 3 up to 126, is probed once.
+    UNIT_TEST_ASSERT_EQUAL((1UL << 0x03) | (1UL << 0x1F), scan.bitmap[0]);
+    UNIT_TEST_ASSERT_EQUAL(1UL << (0x20 - 32), scan.bitmap[1]);
+    UNIT_TEST_ASSERT_EQUAL(1UL << (0x5A - 64), scan.bitmap[2]);
+    UNIT_TEST_ASSERT_EQUAL(1UL << (0x7E - 96), scan.bitmap[3]);
+    UNIT_TEST_ASSERT(!is_mlx90614_address_in_scan(&scan, 0x40));
+    UNIT_TEST_ASSERT(!is_mlx90614_address_in_scan(&scan, 0x7F));
+    UNIT_TEST_ASSERT(!is_mlx90614_address_in_scan(&scan, 0xFF));
+
+    /* The MLX90614 Devices found are iterated in ascending order of their slave addresses. */
+    /** <b>Local uint8_t variable n:</b> Number of slave addresses iterated through. */
+    uint8_t n = 0;
+    for (uint8_t address=get_mlx90614_next_scanned_address(&scan, 0); address!=0; address=get_mlx90614_next_scanned_address(&scan, address + 1))
+    {
+        UNIT_TEST_ASSERT_EQUAL(addresses[n], address);
+        n++;
+    }
+    UNIT_TEST_ASSERT_EQUAL(5, n);
+
+    /* An invalidated scan finds nothing until it is done again. */
+    invalidate_mlx90614_scan(&scan);
+    UNIT_TEST_ASSERT(!is_mlx90614_address_in_scan(&scan, 0x5A));
+    UNIT_TEST_ASSERT_EQUAL(0, get_mlx90614_next_scanned_address(&scan, 0));
+    mock_hal_probes = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, scan_mlx90614_bus(&test_hi2c1, &scan, MLX90614_SCAN_PROBE_TIMEOUT, 0));
+    UNIT_TEST_ASSERT_EQUAL(124, mock_hal_probes);
+    UNIT_TEST_ASSERT_EQUAL(5, scan.count);
+#endif
+}
+
+static void test_scan_skips_devices_that_nack(void)
+{
+#if (MLX90614_ENABLE_SCAN)
+    MLX90614_Scan_Result scan = {0};
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+
+    mock_hal_add_device(&test_hi2c1, 0x5B)->is_present = 0;
+    dev->is_asleep = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, scan_mlx90614_bus(&test_hi2c1, &scan, MLX90614_SCAN_PROBE_TIMEOUT, 1));
+    UNIT_TEST_ASSERT(scan.is_valid);
+    UNIT_TEST_ASSERT_EQUAL(0, scan.count);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, scan_mlx90614_bus(&test_hi2c1, &scan, MLX90614_SCAN_PROBE_TIMEOUT, 0));
+    dev->is_asleep = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, scan_mlx90614_bus(&test_hi2c1, &scan, MLX90614_SCAN_PROBE_TIMEOUT, 1));
+    UNIT_TEST_ASSERT_EQUAL(1, scan.count);
+#endif
+}
+
+void run_bus_scan_tests(void)
+{
+    UNIT_TEST_RUN(test_scan_records_every_responding_address);
+    UNIT_TEST_RUN(test_scan_skips_devices_that_nack);
+}
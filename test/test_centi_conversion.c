@@ -0,0 +1,80 @@
+/**@file
+ * @brief	Tests of the integer conversion of Raw Values into hundredths of Kelvin, Celsius and Fahrenheit, which
+ *          must round to the nearest integer on both sides of zero.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include <math.h> // Library from which "llround" is located at.
+#include "unit_test.h"
+
+static void test_centi_kelvin_and_celsius_are_exact(void)
+{
+    UNIT_TEST_ASSERT_EQUAL(0, get_mlx90614_converted_centi_temperature(0, MLX90614_Temp_K));
+    UNIT_TEST_ASSERT_EQUAL(29816, get_mlx90614_converted_centi_temperature(14908, MLX90614_Temp_K));
+    UNIT_TEST_ASSERT_EQUAL(-27315, get_mlx90614_converted_centi_temperature(0, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(-1, get_mlx90614_converted_centi_temperature(13657, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(1, get_mlx90614_converted_centi_temperature(13658, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(38219, get_mlx90614_converted_centi_temperature(0x7FFF, MLX90614_Temp_C));
+}
+
+static void test_centi_fahrenheit_rounds_to_nearest_for_negative_temperatures(void)
+{
+    /* -13.15°C is exactly 8.33°F, whereas -13.13°C and -13.17°C are 8.366°F and 8.294°F respectively. */
+    UNIT_TEST_ASSERT_EQUAL(833, get_mlx90614_converted_centi_temperature(13000, MLX90614_Temp_F));
+    UNIT_TEST_ASSERT_EQUAL(837, get_mlx90614_converted_centi_temperature(13001, MLX90614_Temp_F));
+    UNIT_TEST_ASSERT_EQUAL(829, get_mlx90614_converted_centi_temperature(12999, MLX90614_Temp_F));
+    /* -0.01°C is 31.982°F whereas 0.01°C is 32.018°F , so neither of them may be truncated towards 0°C. */
+    UNIT_TEST_ASSERT_EQUAL(3198, get_mlx90614_converted_centi_temperature(13657, MLX90614_Temp_F));
+    UNIT_TEST_ASSERT_EQUAL(3202, get_mlx90614_converted_centi_temperature(13658, MLX90614_Temp_F));
+    UNIT_TEST_ASSERT_EQUAL(-45967, get_mlx90614_converted_centi_temperature(0, MLX90614_Temp_F));
+    /* -17.79°C is -0.022°F , whose rounding must keep its sign below 0°F . */
+    UNIT_TEST_ASSERT_EQUAL(-2, get_mlx90614_converted_centi_temperature(12768, MLX90614_Temp_F));
+}
+
+static void test_centi_fahrenheit_matches_the_exact_value_over_every_raw_value(void)
+{
+    /** <b>Local unsigned int variable mismatches:</b> Number of Raw Values whose conversion was not the nearest integer. */
+    unsigned int mismatches = 0;
+    for (uint32_t raw=0; raw<=0x7FFF; raw++)
+    {
+        /** <b>Local double variable exact:</b> Exact temperature in hundredths of Fahrenheit. */
+        double exact = ((double) raw*2.0 - 27315.0)*9.0/5.0 + 3200.0;
+        if (get_mlx90614_converted_centi_temperature((uint16_t) raw, MLX90614_Temp_F) != (int32_t) llround(exact))
+        {
+            mismatches++;
+        }
+    }
+    UNIT_TEST_ASSERT_EQUAL(0, mismatches);
+}
+
+static void test_centi_readings_are_converted_into_the_handle_temperature_type(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    int32_t centi;
+
+    dev->ram[0x06] = 14908;
+    dev->ram[0x07] = 13001;
+    dev->ram[0x08] = 0x8000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_ambient_centi_temperature(&hmlx, &centi));
+    UNIT_TEST_ASSERT_EQUAL(2501, centi);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_centi_temperature(&hmlx, &centi));
+    UNIT_TEST_ASSERT_EQUAL(-1313, centi);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_object2_centi_temperature(&hmlx, &centi));
+#if (MLX90614_FIXED_UNIT == MLX90614_FIXED_UNIT_NONE)
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_F));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_centi_temperature(&hmlx, &centi));
+    UNIT_TEST_ASSERT_EQUAL(837, centi);
+#endif
+}
+
+void run_centi_conversion_tests(void)
+{
+    UNIT_TEST_RUN(test_centi_kelvin_and_celsius_are_exact);
+    UNIT_TEST_RUN(test_centi_fahrenheit_rounds_to_nearest_for_negative_temperatures);
+    UNIT_TEST_RUN(test_centi_fahrenheit_matches_the_exact_value_over_every_raw_value);
+    UNIT_TEST_RUN(test_centi_readings_are_converted_into_the_handle_temperature_type);
+}
@@ -0,0 +1,104 @@
+/**@file
+ * @brief	Tests of the IIR, FIR and Amplifier Gain settings of the "ConfigRegister1" Register of the EEPROM of a
+ *          MLX90614 Device, and of the settling time that was estimated from them.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+static void test_config_register1_fields_are_decoded(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_IIR_t iir;
+    MLX90614_FIR_t fir;
+    MLX90614_Gain_t gain;
+    uint16_t config_register1;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_config_register1(&hmlx, &config_register1));
+    UNIT_TEST_ASSERT_EQUAL(0x9FB4, config_register1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_iir(&hmlx, &iir));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_IIR_100, iir);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_fir(&hmlx, &fir));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_FIR_1024, fir);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_gain(&hmlx, &gain));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_GAIN_12_5, gain);
+
+    dev->eeprom[0x05] = 0x9FB4 & ~0x3F07;
+    dev->eeprom[0x05] |= (MLX90614_GAIN_100 << 11) | (MLX90614_FIR_128 << 8) | MLX90614_IIR_57;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_iir(&hmlx, &iir));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_IIR_57, iir);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_fir(&hmlx, &fir));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_FIR_128, fir);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_gain(&hmlx, &gain));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_GAIN_100, gain);
+
+    /* A corrupted EEPROM word is rejected by the PEC validation. */
+    set_mlx90614_handle_pec_check(&hmlx, 1);
+    dev->is_pec_corrupted = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_iir(&hmlx, &iir));
+}
+
+static void test_config_register1_fields_are_written_alone(void)
+{
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_iir(&hmlx, MLX90614_IIR_50));
+    UNIT_TEST_ASSERT_EQUAL(0x9FB0, dev->eeprom[0x05]);
+    UNIT_TEST_ASSERT_EQUAL(2, dev->writes); // An erase followed by a write.
+    UNIT_TEST_ASSERT_EQUAL(0, dev->writes_without_erase);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_fir(&hmlx, MLX90614_FIR_256));
+    UNIT_TEST_ASSERT_EQUAL(0x9DB0, dev->eeprom[0x05]);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_gain(&hmlx, MLX90614_GAIN_1));
+    UNIT_TEST_ASSERT_EQUAL(0x85B0, dev->eeprom[0x05]);
+    UNIT_TEST_ASSERT_EQUAL(6, dev->writes);
+
+    /* A setting that is already stored is not written again, and an invalid one is never written. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_fir(&hmlx, MLX90614_FIR_256));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, set_mlx90614_handle_iir(&hmlx, (MLX90614_IIR_t) 8));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, set_mlx90614_handle_fir(&hmlx, (MLX90614_FIR_t) 8));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, set_mlx90614_handle_gain(&hmlx, (MLX90614_Gain_t) 7));
+    UNIT_TEST_ASSERT_EQUAL(6, dev->writes);
+    UNIT_TEST_ASSERT_EQUAL(0x85B0, dev->eeprom[0x05]);
+#endif
+}
+
+static void test_settling_time_follows_the_filters(void)
+{
+    UNIT_TEST_ASSERT_EQUAL(100, get_mlx90614_settling_time(MLX90614_IIR_100, MLX90614_FIR_1024));
+    UNIT_TEST_ASSERT_EQUAL(500, get_mlx90614_settling_time(MLX90614_IIR_50, MLX90614_FIR_1024));
+    UNIT_TEST_ASSERT_EQUAL(2300, get_mlx90614_settling_time(MLX90614_IIR_13, MLX90614_FIR_1024));
+    UNIT_TEST_ASSERT_EQUAL(550, get_mlx90614_settling_time(MLX90614_IIR_25, MLX90614_FIR_512));
+    UNIT_TEST_ASSERT_EQUAL(13, get_mlx90614_settling_time(MLX90614_IIR_100, MLX90614_FIR_128)); // Rounded up from 12.5 .
+
+    /* A longer FIR Filter or a slower IIR Filter never settles sooner. */
+    /** <b>Local unsigned int variable mismatches:</b> Number of settings that settle sooner than a faster one. */
+    unsigned int mismatches = 0;
+    const MLX90614_IIR_t slower_iir[] = {MLX90614_IIR_100, MLX90614_IIR_80, MLX90614_IIR_67, MLX90614_IIR_57, MLX90614_IIR_50, MLX90614_IIR_25, MLX90614_IIR_17, MLX90614_IIR_13};
+    for (uint8_t fir=MLX90614_FIR_128; fir<=MLX90614_FIR_1024; fir++)
+    {
+        for (uint8_t i=1; i<sizeof(slower_iir)/sizeof(slower_iir[0]); i++)
+        {
+            mismatches += get_mlx90614_settling_time(slower_iir[i], (MLX90614_FIR_t) fir) < get_mlx90614_settling_time(slower_iir[i-1], (MLX90614_FIR_t) fir);
+            mismatches += (fir > MLX90614_FIR_128) && (get_mlx90614_settling_time(slower_iir[i], (MLX90614_FIR_t) fir) < get_mlx90614_settling_time(slower_iir[i], (MLX90614_FIR_t) (fir - 1)));
+        }
+    }
+    UNIT_TEST_ASSERT_EQUAL(0, mismatches);
+
+    UNIT_TEST_ASSERT_EQUAL(0, get_mlx90614_settling_time((MLX90614_IIR_t) 8, MLX90614_FIR_1024));
+    UNIT_TEST_ASSERT_EQUAL(0, get_mlx90614_settling_time(MLX90614_IIR_100, (MLX90614_FIR_t) 3));
+    UNIT_TEST_ASSERT_EQUAL(0, get_mlx90614_settling_time(MLX90614_IIR_100, (MLX90614_FIR_t) 8));
+}
+
+void run_config_register_tests(void)
+{
+    UNIT_TEST_RUN(test_config_register1_fields_are_decoded);
+    UNIT_TEST_RUN(test_config_register1_fields_are_written_alone);
+    UNIT_TEST_RUN(test_settling_time_follows_the_filters);
+}
@@ -0,0 +1,151 @@
+/**@file
+ * @brief	Tests of the @ref MLX90614_Duty_Cycle , which keeps a MLX90614 Device in its Sleep Mode between samples and
+ *          wakes it up early enough for its IIR and FIR Filters to settle before each one of them.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+#define TEST_LEAD_TIME  (100)   /**< @brief Settling time in milliseconds of the IIR and FIR Filters that the @ref Mock_MLX90614 has by default. */
+
+static GPIO_TypeDef gpio_port;                                                          /**< @brief GPIO Port of both pins of the I2C bus under test. */
+static const MLX90614_Bus_Recovery pins = {&gpio_port, GPIO_PIN_6, &gpio_port, MOCK_HAL_SDA_PIN}; /**< @brief Pins of the I2C bus under test. */
+static MLX90614_Status last_status;                                                     /**< @brief Exception Code passed to the last call of @ref record_sample . */
+static uint8_t calls;                                                                   /**< @brief Number of calls made to @ref record_sample . */
+
+/**@brief	@ref MLX90614_Sample_Callback that records the samples of a Duty Cycle. */
+static void record_sample(MLX90614_Handle *hmlx, MLX90614_Status status, MLX90614_Sample *sample)
+{
+    (void) hmlx;
+    (void) sample;
+    last_status = status;
+    calls++;
+}
+
+static void test_duty_cycle_is_validated(void)
+{
+    mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Duty_Cycle dc;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_duty_cycle(&dc, &hmlx, NULL, 1000, NULL));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_duty_cycle(&dc, &hmlx, &pins, MLX90614_WAKE_PULSE_TIME + TEST_LEAD_TIME, NULL));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_duty_cycle(&dc, &hmlx, &pins, MLX90614_WAKE_PULSE_TIME + TEST_LEAD_TIME + 1, NULL));
+    UNIT_TEST_ASSERT_EQUAL(TEST_LEAD_TIME, dc.lead_time_ms);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_DUTY_CYCLE_STAGE_STOPPED, dc.stage);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_STOP, pump_mlx90614_duty_cycle(&dc));
+
+    /* The lead time follows the filters configured in the MLX90614 Device. */
+    mock_hal_add_device(&test_hi2c2, 0x5A)->eeprom[0x05] = 0x9FB3;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c2, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_duty_cycle(&dc, &hmlx, &pins, 5000, NULL));
+    UNIT_TEST_ASSERT_EQUAL(get_mlx90614_settling_time(MLX90614_IIR_13, MLX90614_FIR_1024), dc.lead_time_ms);
+}
+
+static void test_device_sleeps_between_samples(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Duty_Cycle dc;
+
+    calls = 0;
+    mock_hal_tick_step = 0;
+    dev->ram[0x07] = 15000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_duty_cycle(&dc, &hmlx, &pins, 1000, record_sample));
+    /** <b>Local uint32_t variable start:</b> Value of the HAL tick at which the Duty Cycle was started. */
+    uint32_t start = mock_hal_tick;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, start_mlx90614_duty_cycle(&dc));
+    UNIT_TEST_ASSERT_EQUAL(1, dev->sleeps);
+    UNIT_TEST_ASSERT_EQUAL(1, dev->is_asleep);
+    UNIT_TEST_ASSERT_EQUAL(start + 1000, dc.next_sample_tick);
+
+    /* The wake up pulse starts only once the lead time and the pulse itself fit before the next sample. */
+    mock_hal_advance(1000 - TEST_LEAD_TIME - MLX90614_WAKE_PULSE_TIME - 1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_mlx90614_duty_cycle(&dc));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_DUTY_CYCLE_STAGE_SLEEPING, dc.stage);
+    mock_hal_advance(1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_mlx90614_duty_cycle(&dc));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_DUTY_CYCLE_STAGE_WAKING, dc.stage);
+    mock_hal_advance(MLX90614_WAKE_PULSE_TIME - 1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_mlx90614_duty_cycle(&dc));
+    UNIT_TEST_ASSERT_EQUAL(1, dev->is_asleep);
+    mock_hal_advance(1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_mlx90614_duty_cycle(&dc));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_DUTY_CYCLE_STAGE_SETTLING, dc.stage);
+    UNIT_TEST_ASSERT_EQUAL(0, dev->is_asleep);
+    UNIT_TEST_ASSERT_EQUAL(0, calls);
+
+    /* The sample is taken on time, after which the MLX90614 Device is put back to sleep. */
+    mock_hal_advance(TEST_LEAD_TIME - 1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_mlx90614_duty_cycle(&dc));
+    mock_hal_advance(1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, pump_mlx90614_duty_cycle(&dc));
+    UNIT_TEST_ASSERT_EQUAL(1, calls);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, last_status);
+    UNIT_TEST_ASSERT_EQUAL(15000, dc.sample.raw[MLX90614_Ch_Tobj1]);
+    UNIT_TEST_ASSERT_EQUAL(1, dc.completed);
+    UNIT_TEST_ASSERT_EQUAL(0, dc.failed);
+    UNIT_TEST_ASSERT_EQUAL(2, dev->sleeps);
+    UNIT_TEST_ASSERT_EQUAL(1, dev->is_asleep);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_DUTY_CYCLE_STAGE_SLEEPING, dc.stage);
+    UNIT_TEST_ASSERT_EQUAL(start + 2000, dc.next_sample_tick);
+
+    /* Missed sampling periods are skipped instead of being caught up. */
+    mock_hal_advance(5000);
+    while (calls == 1)
+    {
+        pump_mlx90614_duty_cycle(&dc);
+        mock_hal_advance(1);
+    }
+    UNIT_TEST_ASSERT_EQUAL(2, dc.completed);
+    UNIT_TEST_ASSERT_EQUAL(mock_hal_tick - 1 + 1000, dc.next_sample_tick);
+
+    /* Stopping the Duty Cycle leaves the MLX90614 Device awake. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, stop_mlx90614_duty_cycle(&dc));
+    UNIT_TEST_ASSERT_EQUAL(0, dev->is_asleep);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_DUTY_CYCLE_STAGE_STOPPED, dc.stage);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_STOP, pump_mlx90614_duty_cycle(&dc));
+    UNIT_TEST_ASSERT_EQUAL(HAL_I2C_STATE_READY, test_hi2c1.State);
+}
+
+static void test_failed_sample_is_reported(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Duty_Cycle dc;
+
+    calls = 0;
+    mock_hal_tick_step = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_duty_cycle(&dc, &hmlx, &pins, 1000, record_sample));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, start_mlx90614_duty_cycle(&dc));
+    dev->ram[0x07] = 0x8000;
+    while (calls == 0)
+    {
+        pump_mlx90614_duty_cycle(&dc);
+        mock_hal_advance(1);
+    }
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, last_status);
+    UNIT_TEST_ASSERT_EQUAL(0, dc.completed);
+    UNIT_TEST_ASSERT_EQUAL(1, dc.failed);
+    UNIT_TEST_ASSERT_EQUAL(1, dev->is_asleep); // The MLX90614 Device is put back to sleep anyway.
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_DUTY_CYCLE_STAGE_SLEEPING, dc.stage);
+
+    /* Stopping the Duty Cycle in the middle of the wake up pulse gives a whole one. */
+    mock_hal_advance(1000 - TEST_LEAD_TIME - MLX90614_WAKE_PULSE_TIME);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_mlx90614_duty_cycle(&dc));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_DUTY_CYCLE_STAGE_WAKING, dc.stage);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, stop_mlx90614_duty_cycle(&dc));
+    UNIT_TEST_ASSERT_EQUAL(0, dev->is_asleep);
+}
+
+void run_duty_cycle_tests(void)
+{
+    UNIT_TEST_RUN(test_duty_cycle_is_validated);
+    UNIT_TEST_RUN(test_device_sleeps_between_samples);
+    UNIT_TEST_RUN(test_failed_sample_is_reported);
+}
@@ -0,0 +1,144 @@
+/**@file
+ * @brief	Tests of the EEPROM Shadow of the @ref MLX90614_Handle , which serves the EEPROM words used by the
+ *          @ref mlx90614 from the RAM of our MCU/MPU instead of reading them again from the MLX90614 Device.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+static void test_disabled_shadow_reads_the_device_every_time(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    uint16_t config_register1;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(0, get_mlx90614_handle_eeprom_shadow(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, load_mlx90614_handle_eeprom_shadow(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(0, dev->reads);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_config_register1(&hmlx, &config_register1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_config_register1(&hmlx, &config_register1));
+    UNIT_TEST_ASSERT_EQUAL(0x9FB4, config_register1);
+    UNIT_TEST_ASSERT_EQUAL(2, dev->reads);
+}
+
+static void test_enabled_shadow_reads_each_word_only_once(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    uint16_t config_register1;
+    uint16_t to_max, to_min;
+    float emissivity;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    set_mlx90614_handle_eeprom_shadow(&hmlx, 1);
+    UNIT_TEST_ASSERT_EQUAL(1, get_mlx90614_handle_eeprom_shadow(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_config_register1(&hmlx, &config_register1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_config_register1(&hmlx, &config_register1));
+    UNIT_TEST_ASSERT_EQUAL(0x9FB4, config_register1);
+    UNIT_TEST_ASSERT_EQUAL(1, dev->reads);
+
+    /* Loading the EEPROM Shadow reads all of its words again, after which none of them makes an I2C transaction. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, load_mlx90614_handle_eeprom_shadow(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(1 + MLX90614_EEPROM_SHADOW_SIZE, dev->reads);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_config_register1(&hmlx, &config_register1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_pwm_range(&hmlx, &to_max, &to_min));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_emissivity(&hmlx, &emissivity));
+    UNIT_TEST_ASSERT_EQUAL(1 + MLX90614_EEPROM_SHADOW_SIZE, dev->reads);
+    UNIT_TEST_ASSERT_EQUAL(0x9993, to_max);
+    UNIT_TEST_ASSERT_EQUAL(0x62E3, to_min);
+    UNIT_TEST_ASSERT_FLOAT(1.0, emissivity, 0.0001);
+
+    /* A change made by other means than the Handle goes unnoticed until the EEPROM Shadow is invalidated. */
+    dev->eeprom[0x05] = 0x9FB0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_config_register1(&hmlx, &config_register1));
+    UNIT_TEST_ASSERT_EQUAL(0x9FB4, config_register1);
+    set_mlx90614_handle_eeprom_shadow(&hmlx, 1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_config_register1(&hmlx, &config_register1));
+    UNIT_TEST_ASSERT_EQUAL(0x9FB0, config_register1);
+    UNIT_TEST_ASSERT_EQUAL(2 + MLX90614_EEPROM_SHADOW_SIZE, dev->reads);
+}
+
+static void test_failed_reads_are_not_shadowed(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    uint16_t config_register1;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    set_mlx90614_handle_eeprom_shadow(&hmlx, 1);
+    set_mlx90614_handle_pec_check(&hmlx, 1);
+    dev->is_pec_corrupted = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, load_mlx90614_handle_eeprom_shadow(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(1, dev->reads); // The loading stops at the first failed word.
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_config_register1(&hmlx, &config_register1));
+    dev->is_pec_corrupted = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_config_register1(&hmlx, &config_register1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_config_register1(&hmlx, &config_register1));
+    UNIT_TEST_ASSERT_EQUAL(0x9FB4, config_register1);
+    UNIT_TEST_ASSERT_EQUAL(3, dev->reads);
+}
+
+static void test_eeprom_writes_keep_the_shadow_up_to_date(void)
+{
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    float emissivity;
+    MLX90614_IIR_t iir;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    set_mlx90614_handle_eeprom_shadow(&hmlx, 1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, load_mlx90614_handle_eeprom_shadow(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_emissivity(&hmlx, 0.5f));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_iir(&hmlx, MLX90614_IIR_50));
+    uint32_t reads = dev->reads;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_emissivity(&hmlx, &emissivity));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_iir(&hmlx, &iir));
+    UNIT_TEST_ASSERT_EQUAL(reads, dev->reads);
+    UNIT_TEST_ASSERT_FLOAT(0.5, emissivity, 0.0001);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_IIR_50, iir);
+    UNIT_TEST_ASSERT_EQUAL(0x9FB0, dev->eeprom[0x05]);
+#endif
+}
+
+static void test_changing_the_slave_address_invalidates_the_shadow(void)
+{
+    Mock_MLX90614 *dev1 = mock_hal_add_device(&test_hi2c1, 0x5A);
+    Mock_MLX90614 *dev2 = mock_hal_add_device(&test_hi2c1, 0x5B);
+    Mock_MLX90614 *dev3 = mock_hal_add_device(&test_hi2c1, 0x10);
+    MLX90614_Handle hmlx;
+    uint16_t config_register1;
+
+    dev2->eeprom[0x05] = 0x9FB0;
+    dev3->eeprom[0x05] = 0x9DB0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    set_mlx90614_handle_eeprom_shadow(&hmlx, 1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, load_mlx90614_handle_eeprom_shadow(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EEPROM_SHADOW_SIZE, dev1->reads);
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_slave_address(&hmlx, 0x5B));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_config_register1(&hmlx, &config_register1));
+    UNIT_TEST_ASSERT_EQUAL(0x9FB0, config_register1);
+    UNIT_TEST_ASSERT_EQUAL(1, dev2->reads);
+
+    /* The lowest slave address that responds is found, whose device is not the one that was shadowed. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, find_mlx90614_handle_slave_address(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(0x10, hmlx.slave_address);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_config_register1(&hmlx, &config_register1));
+    UNIT_TEST_ASSERT_EQUAL(0x9DB0, config_register1);
+    UNIT_TEST_ASSERT_EQUAL(1, dev3->reads);
+    UNIT_TEST_ASSERT(get_mlx90614_handle_eeprom_shadow(&hmlx)); // Only the copies are dropped, not the setting.
+}
+
+void run_eeprom_shadow_tests(void)
+{
+    UNIT_TEST_RUN(test_disabled_shadow_reads_the_device_every_time);
+    UNIT_TEST_RUN(test_enabled_shadow_reads_each_word_only_once);
+    UNIT_TEST_RUN(test_failed_reads_are_not_shadowed);
+    UNIT_TEST_RUN(test_eeprom_writes_keep_the_shadow_up_to_date);
+    UNIT_TEST_RUN(test_changing_the_slave_address_invalidates_the_shadow);
+}
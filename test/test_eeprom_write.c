@@ -0,0 +1,164 @@
+/**@file
+ * @brief	Tests of the non-blocking @ref MLX90614_EEPROM_Write state machine, with and without the readback
+ *          verification of its erase and write stages.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+/**@brief	Pumps the given @ref MLX90614_EEPROM_Write once and checks that it made at most one I2C transaction. */
+static MLX90614_Status pump_once(MLX90614_EEPROM_Write *job, Mock_MLX90614 *dev)
+{
+    /** <b>Local uint32_t variable transactions:</b> Number of I2C transactions made by the given MLX90614 Device so far. */
+    uint32_t transactions = dev->reads + dev->writes;
+    /** <b>Local MLX90614_Status variable ret:</b> Exception Code given back by the pumped EEPROM Write. */
+    MLX90614_Status ret = pump_mlx90614_eeprom_write(job);
+    UNIT_TEST_ASSERT(dev->reads + dev->writes <= transactions + 1);
+    return ret;
+}
+#endif
+
+static void test_verified_write_concludes_as_soon_as_the_cell_is_done(void)
+{
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_EEPROM_Write job;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    mock_hal_tick_step = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, start_mlx90614_handle_eeprom_write(&job, &hmlx, 0x20, 0xFFFF, 0, 1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, start_mlx90614_handle_eeprom_write(&job, &hmlx, 0x04, 0xFFFF, 0x8000, 1));
+    UNIT_TEST_ASSERT_EQUAL(0, dev->reads + dev->writes);
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_once(&job, dev));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EEPROM_STAGE_ERASE, job.stage);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_once(&job, dev));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EEPROM_STAGE_ERASE_WAIT, job.stage);
+    UNIT_TEST_ASSERT_EQUAL(0x0000, dev->eeprom[0x04]);
+
+    /* The cell is not read back before the typical erase time has elapsed. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_once(&job, dev));
+    UNIT_TEST_ASSERT_EQUAL(1, dev->reads);
+    mock_hal_advance(MLX90614_EEPROM_CELL_MIN_TIME);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_once(&job, dev));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EEPROM_STAGE_WRITE, job.stage);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_once(&job, dev));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EEPROM_STAGE_WRITE_WAIT, job.stage);
+    mock_hal_advance(MLX90614_EEPROM_CELL_MIN_TIME);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, pump_once(&job, dev));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EEPROM_STAGE_DONE, job.stage);
+    UNIT_TEST_ASSERT_EQUAL(0x8000, dev->eeprom[0x04]);
+    UNIT_TEST_ASSERT_EQUAL(2, dev->writes);
+    UNIT_TEST_ASSERT_EQUAL(0, dev->writes_without_erase);
+    UNIT_TEST_ASSERT_EQUAL(2*MLX90614_EEPROM_CELL_MIN_TIME, mock_hal_tick);
+
+    /* A concluded EEPROM Write keeps giving back its Exception Code without any I2C transaction. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, pump_once(&job, dev));
+    UNIT_TEST_ASSERT_EQUAL(3, dev->reads);
+
+    /* Only the bits of interest are changed, and a value that is already stored is not written again. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, start_mlx90614_handle_eeprom_write(&job, &hmlx, 0x04, 0x00FF, 0x0012, 1));
+    while (pump_once(&job, dev) == MLX90614_EC_NA)
+    {
+        mock_hal_advance(1);
+    }
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, job.status);
+    UNIT_TEST_ASSERT_EQUAL(0x8012, dev->eeprom[0x04]);
+    UNIT_TEST_ASSERT_EQUAL(4, dev->writes);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, start_mlx90614_handle_eeprom_write(&job, &hmlx, 0x04, 0x00FF, 0x0012, 1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, pump_once(&job, dev));
+    UNIT_TEST_ASSERT_EQUAL(4, dev->writes);
+#endif
+}
+
+static void test_unverified_write_waits_the_whole_cell_time(void)
+{
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_EEPROM_Write job;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    mock_hal_tick_step = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, start_mlx90614_handle_eeprom_write(&job, &hmlx, 0x04, 0xFFFF, 0x8000, 0));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_once(&job, dev));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_once(&job, dev));
+    mock_hal_advance(MLX90614_ERASE_OR_WRITE_CELL_TIME - 1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_once(&job, dev));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EEPROM_STAGE_ERASE_WAIT, job.stage);
+    mock_hal_advance(1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_once(&job, dev));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_once(&job, dev));
+    mock_hal_advance(MLX90614_ERASE_OR_WRITE_CELL_TIME);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, pump_once(&job, dev));
+    UNIT_TEST_ASSERT_EQUAL(0x8000, dev->eeprom[0x04]);
+    UNIT_TEST_ASSERT_EQUAL(1, dev->reads); // The cell is never read back.
+#endif
+}
+
+static void test_write_failures_conclude_the_eeprom_write(void)
+{
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_EEPROM_Write job;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    mock_hal_tick_step = 0;
+
+    /* A readback that never holds the expected value times out. */
+    set_mlx90614_handle_pec_check(&hmlx, 1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, start_mlx90614_handle_eeprom_write(&job, &hmlx, 0x04, 0xFFFF, 0x8000, 1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_once(&job, dev));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_once(&job, dev));
+    dev->is_pec_corrupted = 1;
+    mock_hal_advance(MLX90614_EEPROM_CELL_MIN_TIME);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_once(&job, dev));
+    mock_hal_advance(MLX90614_ERASE_OR_WRITE_CELL_TIME);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, pump_once(&job, dev));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EEPROM_STAGE_DONE, job.stage);
+    UNIT_TEST_ASSERT_EQUAL(1, dev->writes);
+    dev->is_pec_corrupted = 0;
+
+    /* A NACK of the write command concludes right away. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, start_mlx90614_handle_eeprom_write(&job, &hmlx, 0x04, 0xFFFF, 0x8000, 1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, pump_once(&job, dev));
+    dev->nacks_left = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, pump_once(&job, dev));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EEPROM_STAGE_DONE, job.stage);
+    UNIT_TEST_ASSERT_EQUAL(1, dev->writes);
+#endif
+}
+
+static void test_slave_address_write_updates_the_handle(void)
+{
+#if (MLX90614_ENABLE_EEPROM_WRITE)
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_EEPROM_Write job;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, start_mlx90614_handle_device_slave_address_write(&job, &hmlx, 0x7F, 1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, start_mlx90614_handle_device_slave_address_write(&job, &hmlx, 0x02, 1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, start_mlx90614_handle_device_slave_address_write(&job, &hmlx, 0x3C, 1));
+    while (pump_once(&job, dev) == MLX90614_EC_NA)
+    {
+        UNIT_TEST_ASSERT_EQUAL(0x5A, hmlx.slave_address);
+    }
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, job.status);
+    UNIT_TEST_ASSERT_EQUAL(0xBE3C, dev->eeprom[0x0E]); // The most significant byte is kept.
+    UNIT_TEST_ASSERT_EQUAL(0x3C, hmlx.slave_address);
+#endif
+}
+
+void run_eeprom_write_tests(void)
+{
+    UNIT_TEST_RUN(test_verified_write_concludes_as_soon_as_the_cell_is_done);
+    UNIT_TEST_RUN(test_unverified_write_waits_the_whole_cell_time);
+    UNIT_TEST_RUN(test_write_failures_conclude_the_eeprom_write);
+    UNIT_TEST_RUN(test_slave_address_write_updates_the_handle);
+}
@@ -0,0 +1,120 @@
+/**@file
+ * @brief	Tests of the software Emissivity compensation of a @ref MLX90614_Handle , from the integer square root
+ *          that it relies on up to the compensated readings of all the temperature channels.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include <math.h> // Library from which "sqrt" and "pow" are located at.
+#include "unit_test.h"
+#include "mlx90614_whitebox.h"
+
+#define TEST_Q16_ONE    (1UL << 16)     /**< @brief Emissivity compensation coefficient of \c 1.0 in Q16 fixed-point. */
+
+/**@brief	Compensates the given Raw Values in double precision, as a reference of @ref compensate_mlx90614_emissivity . */
+static double compensate_reference(uint16_t raw_obj, uint16_t raw_ta, uint32_t coefficient)
+{
+    double ta4 = pow(raw_ta, 4);
+    return pow(ta4 + (pow(raw_obj, 4) - ta4)*coefficient/TEST_Q16_ONE, 0.25);
+}
+
+static void test_isqrt_rounds_down(void)
+{
+    const uint64_t values[] = {0, 1, 2, 3, 4, 8, 9, 15, 16, 99, 100, 0xFFFFFFFFULL, 0x100000000ULL, 0xFFFFFFFE00000001ULL, 0xFFFFFFFFFFFFFFFFULL};
+    const uint32_t roots[] = {0, 1, 1, 1, 2, 2, 3, 3, 4, 9, 10, 0xFFFF, 0x10000, 0xFFFFFFFF, 0xFFFFFFFF};
+    for (uint8_t i=0; i<sizeof(values)/sizeof(values[0]); i++)
+    {
+        UNIT_TEST_ASSERT_EQUAL(roots[i], whitebox_calculate_mlx90614_isqrt(values[i]));
+    }
+
+    /** <b>Local unsigned int variable mismatches:</b> Number of values whose root is not the greatest one whose square does not exceed them. */
+    unsigned int mismatches = 0;
+    /** <b>Local uint64_t variable value:</b> Pseudo-random value whose square root is checked. */
+    uint64_t value = 0x9E3779B97F4A7C15ULL;
+    for (uint32_t i=0; i<20000; i++)
+    {
+        value = value*6364136223846793005ULL + 1442695040888963407ULL;
+        uint64_t v = value >> (i % 64);
+        uint64_t root = whitebox_calculate_mlx90614_isqrt(v);
+        mismatches += (root*root > v) || ((root + 1)*(root + 1) <= v && root != 0xFFFFFFFF);
+    }
+    UNIT_TEST_ASSERT_EQUAL(0, mismatches);
+}
+
+static void test_compensation_matches_the_reference(void)
+{
+    /* A coefficient of 1.0 must give back the very same Raw Value. */
+    /** <b>Local unsigned int variable mismatches:</b> Number of compensations that were off by more than one Raw Value unit. */
+    unsigned int mismatches = 0;
+    for (uint16_t raw_obj=11000; raw_obj<0x7FFF; raw_obj+=7)
+    {
+        mismatches += (compensate_mlx90614_emissivity(raw_obj, 14908, TEST_Q16_ONE) != raw_obj);
+    }
+    UNIT_TEST_ASSERT_EQUAL(0, mismatches);
+
+    const uint32_t coefficients[] = {TEST_Q16_ONE/2, TEST_Q16_ONE*10/9, 2*TEST_Q16_ONE, 10*TEST_Q16_ONE};
+    mismatches = 0;
+    for (uint8_t c=0; c<sizeof(coefficients)/sizeof(coefficients[0]); c++)
+    {
+        for (uint16_t raw_obj=13000; raw_obj<20000; raw_obj+=13)
+        {
+            double expected = compensate_reference(raw_obj, 14908, coefficients[c]);
+            uint16_t actual = compensate_mlx90614_emissivity(raw_obj, 14908, coefficients[c]);
+            mismatches += (expected < 0x7FFF) && ((actual > expected + 1.0) || (actual < expected - 1.0));
+        }
+    }
+    UNIT_TEST_ASSERT_EQUAL(0, mismatches);
+
+    /* An object as hot as the ambient is never compensated, whereas the fourth power saturates at both ends. */
+    UNIT_TEST_ASSERT_EQUAL(14908, compensate_mlx90614_emissivity(14908, 14908, 10*TEST_Q16_ONE));
+    UNIT_TEST_ASSERT_EQUAL(0x7FFF, compensate_mlx90614_emissivity(0x7FFF, 14908, 10*TEST_Q16_ONE));
+    UNIT_TEST_ASSERT_EQUAL(0, compensate_mlx90614_emissivity(0, 0x7FFF, 10*TEST_Q16_ONE));
+}
+
+static void test_compensation_coefficient_and_readings(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Sample sample;
+
+    dev->ram[0x06] = 14908;
+    dev->ram[0x07] = 16000;
+    dev->ram[0x08] = 14000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, set_mlx90614_handle_emissivity_compensation(&hmlx, 0.05f));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, set_mlx90614_handle_emissivity_compensation(&hmlx, 1.5f));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, set_mlx90614_handle_emissivity_compensation(&hmlx, NAN));
+    UNIT_TEST_ASSERT_EQUAL(0, hmlx.emissivity_coefficient);
+
+    /* A 0.5 device Emissivity over a 0.25 target doubles the difference of the fourth powers. */
+    dev->eeprom[0x04] = 0x8000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_emissivity_compensation(&hmlx, 0.25f));
+    UNIT_TEST_ASSERT_FLOAT(2.0, (double) hmlx.emissivity_coefficient/TEST_Q16_ONE, 0.001);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_all_temperatures(&hmlx, &sample));
+    UNIT_TEST_ASSERT_EQUAL(14908, sample.raw[MLX90614_Ch_Ta]);
+    UNIT_TEST_ASSERT_FLOAT(compensate_reference(16000, 14908, hmlx.emissivity_coefficient), sample.raw[MLX90614_Ch_Tobj1], 1.0);
+    UNIT_TEST_ASSERT_FLOAT(compensate_reference(14000, 14908, hmlx.emissivity_coefficient), sample.raw[MLX90614_Ch_Tobj2], 1.0);
+    UNIT_TEST_ASSERT_FLOAT((sample.raw[MLX90614_Ch_Tobj1]*0.02 - 273.15), sample.temperature[MLX90614_Ch_Tobj1], 0.001);
+
+    /* A single temperature channel is never compensated. */
+    uint16_t raw;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(16000, raw);
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_emissivity_compensation(&hmlx, 0.0f));
+    UNIT_TEST_ASSERT_EQUAL(0, hmlx.emissivity_coefficient);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_all_temperatures(&hmlx, &sample));
+    UNIT_TEST_ASSERT_EQUAL(16000, sample.raw[MLX90614_Ch_Tobj1]);
+
+    /* The device Emissivity is read with the PEC validation of the Handle. */
+    dev->nacks_left = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, set_mlx90614_handle_emissivity_compensation(&hmlx, 0.5f));
+}
+
+void run_emissivity_tests(void)
+{
+    UNIT_TEST_RUN(test_isqrt_rounds_down);
+    UNIT_TEST_RUN(test_compensation_matches_the_reference);
+    UNIT_TEST_RUN(test_compensation_coefficient_and_readings);
+}
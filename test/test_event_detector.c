@@ -0,0 +1,141 @@
+/**@file
+ * @brief	Tests of the @ref MLX90614_Event_Detector , whose threshold crossings must be debounced by its hysteresis
+ *          and whose delta must be measured from the last reported Raw Value of each channel.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+static unsigned int callback_calls;             /**< @brief Number of times that @ref count_event has been called. */
+static uint8_t callback_events;                 /**< @brief Events given to the last call of @ref count_event . */
+static MLX90614_Channel_t callback_channel;     /**< @brief Channel given to the last call of @ref count_event . */
+static uint16_t callback_raw;                   /**< @brief Raw Value given to the last call of @ref count_event . */
+
+static void count_event(MLX90614_Handle *hmlx, MLX90614_Channel_t channel, uint8_t events, uint16_t raw)
+{
+    (void) hmlx;
+    callback_calls++;
+    callback_channel = channel;
+    callback_events = events;
+    callback_raw = raw;
+}
+
+static void test_event_detector_rejects_invalid_thresholds(void)
+{
+    MLX90614_Event_Detector det;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_event_detector(&det, 0x7, 15000, 14999, 0, 0, NULL));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_event_detector(&det, 0x7, 0, 0x8000, 0, 0, NULL));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_event_detector(&det, 0x7, 15000, 15000, 0, 0, NULL));
+}
+
+static void test_threshold_crossings_are_debounced_by_the_hysteresis(void)
+{
+    MLX90614_Event_Detector det;
+
+    callback_calls = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_event_detector(&det, 1U << MLX90614_Ch_Tobj1, 14000, 15000, 100, 0, count_event));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_IN_RANGE, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Tobj1, 14500));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_NONE, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Tobj1, 15000));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_ABOVE_HIGH, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Tobj1, 15001));
+    UNIT_TEST_ASSERT_EQUAL(2, callback_calls);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_ABOVE_HIGH, callback_events);
+    UNIT_TEST_ASSERT_EQUAL(15001, callback_raw);
+
+    /* Hovering around the high threshold must not raise a burst of events. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_NONE, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Tobj1, 14950));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_NONE, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Tobj1, 15002));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_NONE, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Tobj1, 14901));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_IN_RANGE, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Tobj1, 14900));
+
+    /* And the same goes for the low threshold. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_BELOW_LOW, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Tobj1, 13999));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_NONE, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Tobj1, 14099));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_IN_RANGE, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Tobj1, 14100));
+
+    /* Jumping across both thresholds at once reports the new zone right away. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_ABOVE_HIGH, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Tobj1, 16000));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_BELOW_LOW, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Tobj1, 13000));
+    UNIT_TEST_ASSERT_EQUAL(7, det.raised);
+    UNIT_TEST_ASSERT_EQUAL(5, det.suppressed);
+    UNIT_TEST_ASSERT_EQUAL(7, callback_calls);
+}
+
+static void test_first_raw_value_outside_the_thresholds_is_reported(void)
+{
+    MLX90614_Event_Detector det;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_event_detector(&det, 0x7, 14000, 15000, 100, 0, NULL));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_ABOVE_HIGH, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Ta, 15500));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_BELOW_LOW, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Tobj2, 100));
+    /* Each channel keeps its own zone. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_IN_RANGE, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Tobj1, 14000));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_NONE, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Ta, 15500));
+}
+
+static void test_delta_is_measured_from_the_last_reported_raw_value(void)
+{
+    MLX90614_Event_Detector det;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_event_detector(&det, 0x7, 0, 0x7FFF, 0, 200, NULL));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_IN_RANGE, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Ta, 14000));
+    /* A slow drift is accumulated against the last reported Raw Value instead of against the previous one. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_NONE, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Ta, 14100));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_NONE, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Ta, 14199));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_DELTA, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Ta, 14200));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_NONE, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Ta, 14001));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_DELTA, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Ta, 14000));
+
+    /* The delta is raised together with a threshold crossing. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_event_detector(&det, 0x7, 14000, 15000, 0, 200, NULL));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_IN_RANGE, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Ta, 14900));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_ABOVE_HIGH | MLX90614_EVENT_DELTA, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Ta, 15100));
+}
+
+static void test_channels_outside_the_mask_are_ignored(void)
+{
+    MLX90614_Event_Detector det;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_event_detector(&det, 1U << MLX90614_Ch_Tobj2, 14000, 15000, 0, 1, NULL));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_NONE, update_mlx90614_event_detector(&det, NULL, MLX90614_Ch_Ta, 20000));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_NONE, update_mlx90614_event_detector(&det, NULL, (MLX90614_Channel_t) 3, 20000));
+    UNIT_TEST_ASSERT_EQUAL(0, det.raised);
+    UNIT_TEST_ASSERT_EQUAL(0, det.suppressed);
+}
+
+static void test_attached_detector_evaluates_the_async_readings(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Event_Detector det;
+
+    callback_calls = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_event_detector(&det, 1U << MLX90614_Ch_Tobj1, 14000, 15000, 50, 0, count_event));
+    set_mlx90614_handle_event_detector(&hmlx, &det);
+
+    const uint16_t readings[] = {14500, 14600, 15100, 0x8000 | 14000, 14980, 14900};
+    for (uint8_t i=0; i<sizeof(readings)/sizeof(readings[0]); i++)
+    {
+        dev->ram[0x07] = readings[i];
+        UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature_async(&hmlx, NULL));
+        mock_hal_advance(1);
+    }
+    UNIT_TEST_ASSERT_EQUAL(3, callback_calls);  // 14500, 15100 and 14900, where the flagged Raw Value is not evaluated.
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_Ch_Tobj1, callback_channel);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EVENT_IN_RANGE, callback_events);
+    UNIT_TEST_ASSERT_EQUAL(14900, callback_raw);
+    UNIT_TEST_ASSERT_EQUAL(2, det.suppressed);
+}
+
+void run_event_detector_tests(void)
+{
+    UNIT_TEST_RUN(test_event_detector_rejects_invalid_thresholds);
+    UNIT_TEST_RUN(test_threshold_crossings_are_debounced_by_the_hysteresis);
+    UNIT_TEST_RUN(test_first_raw_value_outside_the_thresholds_is_reported);
+    UNIT_TEST_RUN(test_delta_is_measured_from_the_last_reported_raw_value);
+    UNIT_TEST_RUN(test_channels_outside_the_mask_are_ignored);
+    UNIT_TEST_RUN(test_attached_detector_evaluates_the_async_readings);
+}
@@ -0,0 +1,132 @@
+/**@file
+ * @brief	Tests of the Exponential Moving Average, Boxcar and Median Filters of a @ref MLX90614_Filter , both on
+ *          their own and while attached to a temperature channel of a @ref MLX90614_Handle .
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+static void test_filter_rejects_invalid_lengths(void)
+{
+    MLX90614_Filter filter;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_filter(&filter, MLX90614_FILTER_EMA, 0));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_filter(&filter, MLX90614_FILTER_EMA, MLX90614_FILTER_MAX_EMA_SHIFT + 1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_filter(&filter, MLX90614_FILTER_BOXCAR, 0));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_filter(&filter, MLX90614_FILTER_MEDIAN, MLX90614_FILTER_MAX_WINDOW + 1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_filter(&filter, (MLX90614_Filter_Type) 4, 1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_filter(&filter, MLX90614_FILTER_NONE, 255));
+    UNIT_TEST_ASSERT_EQUAL(12345, update_mlx90614_filter(&filter, 12345));
+}
+
+static void test_ema_filter_starts_from_its_first_sample_and_converges(void)
+{
+    MLX90614_Filter filter;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_filter(&filter, MLX90614_FILTER_EMA, 2));
+    UNIT_TEST_ASSERT_EQUAL(1000, update_mlx90614_filter(&filter, 1000));
+    UNIT_TEST_ASSERT_EQUAL(1250, update_mlx90614_filter(&filter, 2000));    // 1000*3/4 + 2000/4
+    UNIT_TEST_ASSERT_EQUAL(1438, update_mlx90614_filter(&filter, 2000));    // 1250*3/4 + 2000/4 = 1437.5
+    for (uint8_t i=0; i<100; i++)
+    {
+        update_mlx90614_filter(&filter, 2000);
+    }
+    UNIT_TEST_ASSERT_EQUAL(2000, update_mlx90614_filter(&filter, 2000));
+
+    /* The widest shift must not overflow its accumulator with the largest Raw Value. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_filter(&filter, MLX90614_FILTER_EMA, MLX90614_FILTER_MAX_EMA_SHIFT));
+    for (uint16_t i=0; i<3000; i++)
+    {
+        update_mlx90614_filter(&filter, 0x7FFF);
+    }
+    UNIT_TEST_ASSERT_EQUAL(0x7FFF, update_mlx90614_filter(&filter, 0x7FFF));
+
+    reset_mlx90614_filter(&filter);
+    UNIT_TEST_ASSERT_EQUAL(10, update_mlx90614_filter(&filter, 10));
+}
+
+static void test_boxcar_filter_averages_its_window(void)
+{
+    MLX90614_Filter filter;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_filter(&filter, MLX90614_FILTER_BOXCAR, 4));
+    UNIT_TEST_ASSERT_EQUAL(10, update_mlx90614_filter(&filter, 10));
+    UNIT_TEST_ASSERT_EQUAL(15, update_mlx90614_filter(&filter, 20));
+    UNIT_TEST_ASSERT_EQUAL(20, update_mlx90614_filter(&filter, 30));
+    UNIT_TEST_ASSERT_EQUAL(25, update_mlx90614_filter(&filter, 40));
+    UNIT_TEST_ASSERT_EQUAL(35, update_mlx90614_filter(&filter, 50));        // The 10 has left the window.
+    UNIT_TEST_ASSERT_EQUAL(45, update_mlx90614_filter(&filter, 60));
+
+    /* The average is rounded to the nearest integer. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_filter(&filter, MLX90614_FILTER_BOXCAR, 2));
+    UNIT_TEST_ASSERT_EQUAL(1, update_mlx90614_filter(&filter, 1));
+    UNIT_TEST_ASSERT_EQUAL(2, update_mlx90614_filter(&filter, 2));          // 1.5
+    UNIT_TEST_ASSERT_EQUAL(2, update_mlx90614_filter(&filter, 2));
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_filter(&filter, MLX90614_FILTER_BOXCAR, MLX90614_FILTER_MAX_WINDOW));
+    for (uint16_t i=0; i<3*MLX90614_FILTER_MAX_WINDOW; i++)
+    {
+        update_mlx90614_filter(&filter, 0x7FFF);
+    }
+    UNIT_TEST_ASSERT_EQUAL(0x7FFF, update_mlx90614_filter(&filter, 0x7FFF));
+}
+
+static void test_median_filter_rejects_spikes(void)
+{
+    MLX90614_Filter filter;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_filter(&filter, MLX90614_FILTER_MEDIAN, 5));
+    UNIT_TEST_ASSERT_EQUAL(100, update_mlx90614_filter(&filter, 100));
+    UNIT_TEST_ASSERT_EQUAL(100, update_mlx90614_filter(&filter, 9000));     // The lower median of 100 and 9000.
+    UNIT_TEST_ASSERT_EQUAL(101, update_mlx90614_filter(&filter, 101));
+    UNIT_TEST_ASSERT_EQUAL(100, update_mlx90614_filter(&filter, 0));        // The lower median of 0, 100, 101 and 9000.
+    UNIT_TEST_ASSERT_EQUAL(101, update_mlx90614_filter(&filter, 102));      // Window: 100, 9000, 101, 0, 102.
+    UNIT_TEST_ASSERT_EQUAL(102, update_mlx90614_filter(&filter, 103));      // Window: 9000, 101, 0, 102, 103.
+    UNIT_TEST_ASSERT_EQUAL(102, update_mlx90614_filter(&filter, 104));      // Window: 101, 0, 102, 103, 104.
+    UNIT_TEST_ASSERT_EQUAL(103, update_mlx90614_filter(&filter, 105));      // Window: 0, 102, 103, 104, 105.
+}
+
+static void test_attached_filter_smooths_the_readings_of_its_channel(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Filter filter;
+    int32_t centi;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_filter(&filter, MLX90614_FILTER_BOXCAR, 2));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, set_mlx90614_handle_filter(&hmlx, (MLX90614_Channel_t) 3, &filter));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_filter(&hmlx, MLX90614_Ch_Tobj1, &filter));
+
+    dev->ram[0x07] = 14000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_centi_temperature(&hmlx, &centi));
+    UNIT_TEST_ASSERT_EQUAL(14000*2 - 27315, centi);
+    dev->ram[0x07] = 15000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_centi_temperature(&hmlx, &centi));
+    UNIT_TEST_ASSERT_EQUAL(14500*2 - 27315, centi);
+
+    /* The other channels are left untouched, and so is the Filter by the readings that raised the Error Flag. */
+    dev->ram[0x06] = 15000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_ambient_centi_temperature(&hmlx, &centi));
+    UNIT_TEST_ASSERT_EQUAL(15000*2 - 27315, centi);
+    dev->ram[0x07] = 0x8000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_object1_centi_temperature(&hmlx, &centi));
+    UNIT_TEST_ASSERT_EQUAL(2, filter.count);
+    UNIT_TEST_ASSERT_EQUAL(29000, filter.accumulator);
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_filter(&hmlx, MLX90614_Ch_Tobj1, NULL));
+    dev->ram[0x07] = 16000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_centi_temperature(&hmlx, &centi));
+    UNIT_TEST_ASSERT_EQUAL(16000*2 - 27315, centi);
+}
+
+void run_filter_tests(void)
+{
+    UNIT_TEST_RUN(test_filter_rejects_invalid_lengths);
+    UNIT_TEST_RUN(test_ema_filter_starts_from_its_first_sample_and_converges);
+    UNIT_TEST_RUN(test_boxcar_filter_averages_its_window);
+    UNIT_TEST_RUN(test_median_filter_rejects_spikes);
+    UNIT_TEST_RUN(test_attached_filter_smooths_the_readings_of_its_channel);
+}
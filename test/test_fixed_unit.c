@@ -0,0 +1,102 @@
+/**@file
+ * @brief	Tests of the Temperature Types that the @ref mlx90614 accepts, which are all of them unless the build is
+ *          specialized into a single one via @ref MLX90614_FIXED_UNIT .
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+/**@brief	Tells whether this build accepts the given Temperature Type. */
+static uint8_t is_temperature_type_compiled(MLX90614_Temp_t temp_t)
+{
+    return (MLX90614_FIXED_UNIT == MLX90614_FIXED_UNIT_NONE) || (MLX90614_FIXED_UNIT == (int) temp_t);
+}
+
+/**@brief	Converts a Raw Value into the given Temperature Type as stated in the MLX90614 Datasheet. */
+static float convert_raw_temperature(uint16_t raw, MLX90614_Temp_t temp_t)
+{
+    switch (temp_t)
+    {
+        case MLX90614_Temp_K:
+            return ((float) raw)*0.02f;
+        case MLX90614_Temp_C:
+            return ((float) raw)*0.02f - 273.15f;
+        default:
+            return ((float) raw)*0.036f - 459.67f;
+    }
+}
+
+static void test_only_the_compiled_temperature_types_are_accepted(void)
+{
+    mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_PWM pwm;
+    static TIM_HandleTypeDef htim;
+
+    for (uint8_t t=MLX90614_Temp_K; t<=MLX90614_Temp_F; t++)
+    {
+        /** <b>Local uint8_t variable expected:</b> @ref MLX90614_Status Exception Code that every function has to give back for the current Temperature Type. */
+        uint8_t expected = is_temperature_type_compiled((MLX90614_Temp_t) t) ? MLX90614_EC_OK : MLX90614_EC_ERR;
+        UNIT_TEST_ASSERT_EQUAL(expected, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, (MLX90614_Temp_t) t));
+        UNIT_TEST_ASSERT_EQUAL(expected, init_mlx90614_pwm(&pwm, &htim, TIM_CHANNEL_1, TIM_CHANNEL_2, 39315, 25315, (MLX90614_Temp_t) t));
+        UNIT_TEST_ASSERT_EQUAL(expected, set_mlx90614_temperature_type((MLX90614_Temp_t) t));
+    }
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_temperature_type(MLX90614_Temp_C)); // The Module Handle outlives this test.
+
+    /* A rejected Temperature Type leaves the one of the Handle as it was. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, set_mlx90614_handle_temperature_type(&hmlx, (MLX90614_Temp_t) 3));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_Temp_C, hmlx.temperature_type);
+#if (MLX90614_FIXED_UNIT == 1)
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, set_mlx90614_handle_temperature_type(&hmlx, MLX90614_Temp_F));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_Temp_C, hmlx.temperature_type);
+#endif
+}
+
+static void test_readings_are_converted_as_in_the_datasheet(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    /** <b>Local constant uint16_t array raws:</b> Raw Values over the whole range of the MLX90614 Device. */
+    static const uint16_t raws[] = {0x0000, 0x2DE4, 13658, 14908, 0x7FFF};
+    MLX90614_Handle hmlx;
+    MLX90614_Sample sample;
+    float temperature;
+
+    for (uint8_t t=MLX90614_Temp_K; t<=MLX90614_Temp_F; t++)
+    {
+        if (!is_temperature_type_compiled((MLX90614_Temp_t) t))
+        {
+            continue;
+        }
+        UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, (MLX90614_Temp_t) t));
+        for (uint8_t i=0; i<sizeof(raws)/sizeof(raws[0]); i++)
+        {
+            /** <b>Local float variable expected:</b> Temperature that stands for the current Raw Value. */
+            float expected = convert_raw_temperature(raws[i], (MLX90614_Temp_t) t);
+            dev->ram[0x06] = raws[i];
+            dev->ram[0x07] = raws[i];
+            UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature(&hmlx, &temperature));
+            UNIT_TEST_ASSERT_FLOAT(expected, temperature, 0.0001);
+            UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_all_temperatures(&hmlx, &sample));
+            UNIT_TEST_ASSERT_FLOAT(expected, sample.temperature[MLX90614_Ch_Ta], 0.0001);
+
+            /* The Asynchronous readings are converted in the same way. */
+            UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature_async(&hmlx, NULL));
+            while (mock_hal_pending() != 0)
+            {
+                mock_hal_advance(1);
+            }
+            UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_async_temperature(&hmlx, &temperature));
+            UNIT_TEST_ASSERT_FLOAT(expected, temperature, 0.0001);
+        }
+    }
+}
+
+void run_fixed_unit_tests(void)
+{
+    UNIT_TEST_RUN(test_only_the_compiled_temperature_types_are_accepted);
+    UNIT_TEST_RUN(test_readings_are_converted_as_in_the_datasheet);
+}
@@ -0,0 +1,130 @@
+/**@file
+ * @brief	Tests of the Freshness Cache of a @ref MLX90614_Handle , which serves the readings requested faster than
+ *          the MLX90614 Device refreshes its RAM without any I2C transaction.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+static void test_cache_serves_readings_within_its_window(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    uint16_t raw;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    mock_hal_tick_step = 0;
+
+    /* The Freshness Cache is disabled by default. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 0, &raw));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 0, &raw));
+    UNIT_TEST_ASSERT_EQUAL(2, dev->reads);
+
+    set_mlx90614_handle_freshness_window(&hmlx, 50);
+    dev->reads = 0;
+    dev->ram[0x07] = 15000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 0, &raw));
+    dev->ram[0x07] = 15100;
+    mock_hal_advance(49);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 0, &raw));
+    UNIT_TEST_ASSERT_EQUAL(15000, raw);
+    UNIT_TEST_ASSERT_EQUAL(1, dev->reads);
+
+    /* Each temperature channel is cached on its own. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Ta, 0, &raw));
+    UNIT_TEST_ASSERT_EQUAL(14908, raw);
+    UNIT_TEST_ASSERT_EQUAL(2, dev->reads);
+
+    /* Once the Freshness Window has elapsed, the MLX90614 Device is read again. */
+    mock_hal_advance(1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 0, &raw));
+    UNIT_TEST_ASSERT_EQUAL(15100, raw);
+    UNIT_TEST_ASSERT_EQUAL(3, dev->reads);
+
+    /* A forced reading bypasses the Freshness Cache, but it still refreshes it. */
+    dev->ram[0x07] = 15200;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(15200, raw);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 0, &raw));
+    UNIT_TEST_ASSERT_EQUAL(4, dev->reads);
+#if (MLX90614_ENABLE_STATS)
+    MLX90614_Stats stats;
+    get_mlx90614_stats(&stats);
+    UNIT_TEST_ASSERT(stats.cache_hits >= 2);
+#endif
+}
+
+static void test_cache_is_invalidated_and_skips_failed_readings(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    uint16_t raw;
+
+    mock_hal_add_device(&test_hi2c1, 0x5B)->ram[0x07] = 16000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    mock_hal_tick_step = 0;
+    set_mlx90614_handle_freshness_window(&hmlx, 100);
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 0, &raw));
+    invalidate_mlx90614_handle_cache(&hmlx);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 0, &raw));
+    set_mlx90614_handle_freshness_window(&hmlx, 100);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 0, &raw));
+    UNIT_TEST_ASSERT_EQUAL(3, dev->reads);
+
+    /* Another slave address is another MLX90614 Device, whose Raw Values were never cached. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_slave_address(&hmlx, 0x5B));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 0, &raw));
+    UNIT_TEST_ASSERT_EQUAL(16000, raw);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_slave_address(&hmlx, 0x5A));
+
+    /* An Error Flag is never cached. */
+    dev->ram[0x07] = 0x8000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 0, &raw));
+    dev->ram[0x07] = 15300;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 0, &raw));
+    UNIT_TEST_ASSERT_EQUAL(15300, raw);
+    UNIT_TEST_ASSERT_EQUAL(5, dev->reads);
+
+    /* A slave address that is found invalidates it too, even if it happens to be the current one. */
+    dev->ram[0x07] = 15400;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, find_mlx90614_handle_slave_address(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(0x5A, hmlx.slave_address);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 0, &raw));
+    UNIT_TEST_ASSERT_EQUAL(15400, raw);
+    UNIT_TEST_ASSERT_EQUAL(6, dev->reads);
+}
+
+static void test_cache_is_filled_by_asynchronous_readings(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Sample sample;
+    uint16_t raw;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    mock_hal_tick_step = 0;
+    set_mlx90614_handle_freshness_window(&hmlx, 100);
+    dev->ram[0x08] = 14000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_all_temperatures_async(&hmlx, &sample, NULL));
+    while (mock_hal_pending() != 0)
+    {
+        mock_hal_advance(1);
+    }
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_CPLT, get_mlx90614_handle_async_state(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(3, dev->reads);
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj2, 0, &raw));
+    UNIT_TEST_ASSERT_EQUAL(14000, raw);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_all_temperatures(&hmlx, &sample));
+    UNIT_TEST_ASSERT_EQUAL(3, dev->reads);
+}
+
+void run_freshness_cache_tests(void)
+{
+    UNIT_TEST_RUN(test_cache_serves_readings_within_its_window);
+    UNIT_TEST_RUN(test_cache_is_invalidated_and_skips_failed_readings);
+    UNIT_TEST_RUN(test_cache_is_filled_by_asynchronous_readings);
+}
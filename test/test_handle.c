@@ -0,0 +1,101 @@
+/**@file
+ * @brief	Tests of the @ref MLX90614_Handle instances of the @ref mlx90614 , which must each keep their own MLX90614
+ *          Device and configurations apart from the ones of the other Handles and of the Module Handle.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+static void test_handles_on_the_same_bus_read_their_own_device(void)
+{
+    Mock_MLX90614 *dev1 = mock_hal_add_device(&test_hi2c1, 0x5A);
+    Mock_MLX90614 *dev2 = mock_hal_add_device(&test_hi2c1, 0x5B);
+    MLX90614_Handle hmlx1, hmlx2;
+    uint16_t raw;
+
+    dev1->ram[0x07] = 15000;
+    dev2->ram[0x07] = 16000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx1, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx2, &test_hi2c1, 0x5B, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx1, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(15000, raw);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx2, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(16000, raw);
+    UNIT_TEST_ASSERT_EQUAL(1, dev1->reads);
+    UNIT_TEST_ASSERT_EQUAL(1, dev2->reads);
+
+    /* Moving one Handle to another slave address leaves the other one as it was. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_slave_address(&hmlx2, 0x5A));
+    UNIT_TEST_ASSERT_EQUAL(0x5A, get_mlx90614_handle_slave_address(&hmlx2));
+    UNIT_TEST_ASSERT_EQUAL(0x5A, get_mlx90614_handle_slave_address(&hmlx1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_slave_address(&hmlx1, 0x5B));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx1, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(16000, raw);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx2, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(15000, raw);
+}
+
+static void test_handles_keep_their_own_configuration(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx1, hmlx2;
+    uint16_t raw;
+
+    dev->ram[0x07] = 14908;     // 25°C.
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx1, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx2, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+
+    /* The PEC validation of one Handle does not reach the other one. */
+    dev->is_pec_corrupted = 1;
+    set_mlx90614_handle_pec_check(&hmlx1, 1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx1, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx2, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(0, hmlx2.is_pec_check_enabled);
+    dev->is_pec_corrupted = 0;
+
+#if (MLX90614_FIXED_UNIT == MLX90614_FIXED_UNIT_NONE)
+    float temperature;
+
+    /* Each Handle converts its readings into its own Temperature Type. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_temperature_type(&hmlx2, MLX90614_Temp_K));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature(&hmlx1, &temperature));
+    UNIT_TEST_ASSERT_FLOAT(25.01, temperature, 0.001);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature(&hmlx2, &temperature));
+    UNIT_TEST_ASSERT_FLOAT(298.16, temperature, 0.001);
+#endif
+}
+
+static void test_module_handle_is_one_more_instance(void)
+{
+#if ((MLX90614_FIXED_UNIT == MLX90614_FIXED_UNIT_NONE) || (MLX90614_FIXED_UNIT == 1))
+    Mock_MLX90614 *dev1 = mock_hal_add_device(&test_hi2c1, 0x5A);
+    Mock_MLX90614 *dev2 = mock_hal_add_device(&test_hi2c2, 0x5A);
+    MLX90614_Handle hmlx;
+    float temperature;
+
+    dev1->ram[0x07] = 14908;    // 25°C.
+    dev2->ram[0x07] = 15658;    // 40°C.
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_module(&test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c2, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT(get_mlx90614_module_handle() != &hmlx);
+    UNIT_TEST_ASSERT(get_mlx90614_module_handle()->hi2c == &test_hi2c1);
+
+    /* The functions without a Handle work with the Module Handle only. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_object1_temperature(&temperature));
+    UNIT_TEST_ASSERT_FLOAT(25.01, temperature, 0.001);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature(&hmlx, &temperature));
+    UNIT_TEST_ASSERT_FLOAT(40.01, temperature, 0.001);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature(get_mlx90614_module_handle(), &temperature));
+    UNIT_TEST_ASSERT_FLOAT(25.01, temperature, 0.001);
+    UNIT_TEST_ASSERT_EQUAL(1, dev2->reads);
+#endif
+}
+
+void run_handle_tests(void)
+{
+    UNIT_TEST_RUN(test_handles_on_the_same_bus_read_their_own_device);
+    UNIT_TEST_RUN(test_handles_keep_their_own_configuration);
+    UNIT_TEST_RUN(test_module_handle_is_one_more_instance);
+}
@@ -0,0 +1,101 @@
+/**@file
+ * @brief	Tests of the @ref MLX90614_TRANSPORT_LL Transport of the @ref mlx90614 , which are only compiled whenever it
+ *          is the one selected via @ref MLX90614_TRANSPORT .
+ *
+ * @details The registers of the I2C Peripherals of the @ref mock_hal are plain memory that no I2C Peripheral drives.
+ *          Therefore, these tests raise the status flags of interest beforehand and then check how the Transport
+ *          reacts to them and in which state it leaves the \c CR1 register. Note that, with every flag raised, the
+ *          bytes received are whatever was last written into \c DR , which is the slave address with the read bit.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+#if (MLX90614_TRANSPORT == MLX90614_TRANSPORT_LL)
+#define TEST_SLAVE_ADDRESS  (0x1A)  /**< @brief Slave address whose byte with the read bit (i.e., \c 0x35 ) gives a valid Raw Value when it is received twice (i.e., \c 0x3535 ). */
+#define TEST_ALL_SR1_FLAGS  (I2C_SR1_SB | I2C_SR1_ADDR | I2C_SR1_BTF | I2C_SR1_RXNE)   /**< @brief Every status flag of the \c SR1 register that the Transport waits for. */
+
+/**@brief	Initializes a @ref MLX90614_Handle towards a MLX90614 Device at @ref TEST_SLAVE_ADDRESS on @ref test_hi2c1 . */
+static void setup_ll_handle(MLX90614_Handle *hmlx)
+{
+    mock_hal_add_device(&test_hi2c1, TEST_SLAVE_ADDRESS);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(hmlx, &test_hi2c1, TEST_SLAVE_ADDRESS, MLX90614_Temp_C));
+}
+#endif
+
+static void test_ll_read_follows_the_status_flags(void)
+{
+#if (MLX90614_TRANSPORT == MLX90614_TRANSPORT_LL)
+    MLX90614_Handle hmlx;
+    uint16_t raw;
+
+    setup_ll_handle(&hmlx);
+    test_hi2c1.Instance->SR1 = TEST_ALL_SR1_FLAGS;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(0x3535, raw);
+    UNIT_TEST_ASSERT_EQUAL((TEST_SLAVE_ADDRESS << 1) | 1, test_hi2c1.Instance->DR);
+
+    /* The STOP condition is requested, and both the ACK and POS bits are left cleared for the next transaction. */
+    UNIT_TEST_ASSERT((test_hi2c1.Instance->CR1 & I2C_CR1_STOP) != 0);
+    UNIT_TEST_ASSERT_EQUAL(0, test_hi2c1.Instance->CR1 & (I2C_CR1_ACK | I2C_CR1_POS));
+    UNIT_TEST_ASSERT_EQUAL(HAL_I2C_STATE_READY, test_hi2c1.State);
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_primask);
+
+    /* With the PEC validation enabled, the third byte is received too, which does not match the PEC of the others. */
+    test_hi2c1.Instance->CR1 = 0;
+    set_mlx90614_handle_pec_check(&hmlx, 1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT((test_hi2c1.Instance->CR1 & I2C_CR1_STOP) != 0);
+    UNIT_TEST_ASSERT_EQUAL(0, test_hi2c1.Instance->CR1 & I2C_CR1_ACK);
+    UNIT_TEST_ASSERT_EQUAL(HAL_I2C_STATE_READY, test_hi2c1.State);
+#endif
+}
+
+static void test_ll_read_aborts_on_busy_nack_and_timeout(void)
+{
+#if (MLX90614_TRANSPORT == MLX90614_TRANSPORT_LL)
+    MLX90614_Handle hmlx;
+    uint16_t raw;
+
+    setup_ll_handle(&hmlx);
+
+    /* A busy bus is reported without generating any START condition. */
+    test_hi2c1.Instance->SR1 = TEST_ALL_SR1_FLAGS;
+    test_hi2c1.Instance->SR2 = I2C_SR2_BUSY;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(0, test_hi2c1.Instance->CR1);
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_primask);
+    test_hi2c1.Instance->SR2 = 0;
+
+    /* So is an I2C Peripheral that the HAL is using, which is left in its state. */
+    test_hi2c1.State = HAL_I2C_STATE_BUSY_RX;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(0, test_hi2c1.Instance->CR1);
+    UNIT_TEST_ASSERT_EQUAL(HAL_I2C_STATE_BUSY_RX, test_hi2c1.State);
+    test_hi2c1.State = HAL_I2C_STATE_READY;
+
+    /* A NACK is cleared from SR1 and recorded as a HAL Error, after which the bus is released. */
+    test_hi2c1.Instance->SR1 = I2C_SR1_AF;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(0, test_hi2c1.Instance->SR1 & I2C_SR1_AF);
+    UNIT_TEST_ASSERT((test_hi2c1.ErrorCode & HAL_I2C_ERROR_AF) != 0);
+    UNIT_TEST_ASSERT((test_hi2c1.Instance->CR1 & I2C_CR1_STOP) != 0);
+    UNIT_TEST_ASSERT_EQUAL(HAL_I2C_STATE_READY, test_hi2c1.State);
+
+    /* A flag that never rises ends the transaction once the poll limit is reached. */
+    test_hi2c1.Instance->CR1 = 0;
+    test_hi2c1.Instance->SR1 = I2C_SR1_SB;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT((test_hi2c1.Instance->CR1 & I2C_CR1_STOP) != 0);
+    UNIT_TEST_ASSERT_EQUAL(0, test_hi2c1.Instance->CR1 & I2C_CR1_POS);
+    UNIT_TEST_ASSERT_EQUAL(HAL_I2C_STATE_READY, test_hi2c1.State);
+#endif
+}
+
+void run_ll_transport_tests(void)
+{
+    UNIT_TEST_RUN(test_ll_read_follows_the_status_flags);
+    UNIT_TEST_RUN(test_ll_read_aborts_on_busy_nack_and_timeout);
+}
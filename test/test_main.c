@@ -0,0 +1,81 @@
+/**@file
+ * @brief	Runner of the host-side unit tests of the MLX90614 Infra Red Thermometer's driver.
+ *
+ * @details This program runs the tests of every feature of the @ref mlx90614 over the @ref mock_hal , and it exits
+ *          with a non zero code whenever any of their assertions failed, so that it can be run in a CI.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+unsigned int unit_test_checks;
+unsigned int unit_test_failures;
+I2C_HandleTypeDef test_hi2c1;
+I2C_HandleTypeDef test_hi2c2;
+I2C_HandleTypeDef test_hi2c3;
+static I2C_TypeDef i2c1_registers;  /**< @brief Registers of the I2C Peripheral of @ref test_hi2c1 . */
+static I2C_TypeDef i2c2_registers;  /**< @brief Registers of the I2C Peripheral of @ref test_hi2c2 . */
+static I2C_TypeDef i2c3_registers;  /**< @brief Registers of the I2C Peripheral of @ref test_hi2c3 . */
+
+/* The application forwards the I2C callbacks of the HAL to the @ref mlx90614 , as stated in its documentation. */
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    mlx90614_i2c_mem_rx_cplt_callback(hi2c);
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+    mlx90614_i2c_error_callback(hi2c);
+}
+
+void setup_unit_test(void)
+{
+    mock_hal_reset();
+    mock_hal_init_i2c(&test_hi2c1, &i2c1_registers);
+    mock_hal_init_i2c(&test_hi2c2, &i2c2_registers);
+    mock_hal_init_i2c(&test_hi2c3, &i2c3_registers);
+}
+
+int main(void)
+{
+#if (MLX90614_TRANSPORT == MLX90614_TRANSPORT_LL)
+    /* NOTE: The blocking readings of this Transport do not reach the simulated MLX90614 Devices, so only its own tests are run. */
+    run_ll_transport_tests();
+#else
+    run_mock_hal_tests();
+    run_reading_tests();
+    run_pec_tests();
+    run_centi_conversion_tests();
+    run_ring_buffer_tests();
+    run_scheduler_tests();
+    run_filter_tests();
+    run_batch_conversion_tests();
+    run_retry_policy_tests();
+    run_event_detector_tests();
+    run_sample_log_tests();
+    run_emissivity_tests();
+    run_aggregate_tests();
+    run_address_validation_tests();
+    run_freshness_cache_tests();
+    run_config_register_tests();
+    run_eeprom_write_tests();
+    run_bus_scan_tests();
+    run_eeprom_shadow_tests();
+    run_stats_tests();
+    run_bus_recovery_tests();
+    run_multi_bus_tests();
+    run_duty_cycle_tests();
+    run_rtos_tests();
+    run_pwm_tests();
+    run_benchmark_tests();
+    run_fixed_unit_tests();
+    run_async_reading_tests();
+    run_handle_tests();
+    run_burst_read_tests();
+#endif
+
+    printf("%u checks, %u failures\n", unit_test_checks, unit_test_failures);
+    return (unit_test_failures == 0) ? 0 : 1;
+}
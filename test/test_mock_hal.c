@@ -0,0 +1,149 @@
+/**@file
+ * @brief	Tests of the @ref mock_hal itself, so that the rest of the tests can rely on how it simulates the
+ *          MLX90614 Devices.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+static void test_reference_pec_matches_known_vectors(void)
+{
+    /* NOTE: 0xF4 is the check value of the CRC-8 with the x^8+x^2+x+1 polynomial over the ASCII string "123456789". */
+    const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    UNIT_TEST_ASSERT_EQUAL(0xF4, mock_hal_calculate_pec(check, sizeof(check)));
+    UNIT_TEST_ASSERT_EQUAL(0x00, mock_hal_calculate_pec(check, 0));
+}
+
+static void test_device_answers_with_its_ram_and_pec(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    dev->ram[0x07] = 0x3AF7;
+    uint8_t data[3];
+
+    UNIT_TEST_ASSERT_EQUAL(HAL_OK, HAL_I2C_Mem_Read(&test_hi2c1, 0x5A << 1, 0x07, 1, data, 3, 10));
+    UNIT_TEST_ASSERT_EQUAL(0xF7, data[0]);
+    UNIT_TEST_ASSERT_EQUAL(0x3A, data[1]);
+    const uint8_t frame[] = {0xB4, 0x07, 0xB5, 0xF7, 0x3A};
+    UNIT_TEST_ASSERT_EQUAL(mock_hal_calculate_pec(frame, sizeof(frame)), data[2]);
+    UNIT_TEST_ASSERT_EQUAL(1, dev->reads);
+
+    /* A device on another bus or under another slave address must not answer. */
+    UNIT_TEST_ASSERT_EQUAL(HAL_ERROR, HAL_I2C_Mem_Read(&test_hi2c2, 0x5A << 1, 0x07, 1, data, 3, 10));
+    UNIT_TEST_ASSERT_EQUAL(HAL_I2C_ERROR_AF, HAL_I2C_GetError(&test_hi2c2));
+    UNIT_TEST_ASSERT_EQUAL(HAL_ERROR, HAL_I2C_Mem_Read(&test_hi2c1, 0x5B << 1, 0x07, 1, data, 3, 10));
+    UNIT_TEST_ASSERT_EQUAL(HAL_OK, HAL_I2C_Mem_Read(&test_hi2c1, 0x00, 0x2E, 1, data, 3, 10));
+    UNIT_TEST_ASSERT_EQUAL(0x5A, data[0]);
+}
+
+static void test_device_latency_nacks_and_busy(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    uint8_t data[3];
+
+    dev->latency_ms = 7;
+    UNIT_TEST_ASSERT_EQUAL(HAL_OK, HAL_I2C_Mem_Read(&test_hi2c1, 0x5A << 1, 0x06, 1, data, 3, 10));
+    UNIT_TEST_ASSERT_EQUAL(7, mock_hal_tick);
+    UNIT_TEST_ASSERT_EQUAL(HAL_TIMEOUT, HAL_I2C_Mem_Read(&test_hi2c1, 0x5A << 1, 0x06, 1, data, 3, 5));
+    UNIT_TEST_ASSERT_EQUAL(12, mock_hal_tick);
+
+    dev->latency_ms = 0;
+    dev->nacks_left = 2;
+    UNIT_TEST_ASSERT_EQUAL(HAL_ERROR, HAL_I2C_IsDeviceReady(&test_hi2c1, 0x5A << 1, 1, 10));
+    UNIT_TEST_ASSERT_EQUAL(HAL_ERROR, HAL_I2C_Mem_Read(&test_hi2c1, 0x5A << 1, 0x06, 1, data, 3, 10));
+    UNIT_TEST_ASSERT_EQUAL(HAL_OK, HAL_I2C_Mem_Read(&test_hi2c1, 0x5A << 1, 0x06, 1, data, 3, 10));
+
+    dev->busy_left = 1;
+    UNIT_TEST_ASSERT_EQUAL(HAL_BUSY, HAL_I2C_Mem_Read(&test_hi2c1, 0x5A << 1, 0x06, 1, data, 3, 10));
+    UNIT_TEST_ASSERT_EQUAL(HAL_OK, HAL_I2C_Mem_Read(&test_hi2c1, 0x5A << 1, 0x06, 1, data, 3, 10));
+}
+
+static void test_device_checks_the_pec_of_writes(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    uint8_t erase[4] = {0x24, 0x00, 0x00, 0};
+    const uint8_t frame[] = {0xB4, 0x24, 0x00, 0x00};
+
+    erase[3] = mock_hal_calculate_pec(frame, sizeof(frame)) ^ 0x01;
+    UNIT_TEST_ASSERT_EQUAL(HAL_ERROR, HAL_I2C_Master_Transmit(&test_hi2c1, 0x5A << 1, erase, sizeof(erase), 10));
+    UNIT_TEST_ASSERT_EQUAL(0xFFFF, dev->eeprom[0x04]);
+    erase[3] ^= 0x01;
+    UNIT_TEST_ASSERT_EQUAL(HAL_OK, HAL_I2C_Master_Transmit(&test_hi2c1, 0x5A << 1, erase, sizeof(erase), 10));
+    UNIT_TEST_ASSERT_EQUAL(0x0000, dev->eeprom[0x04]);
+    UNIT_TEST_ASSERT_EQUAL(1, dev->writes);
+    UNIT_TEST_ASSERT_EQUAL(0, dev->writes_without_erase);
+}
+
+static void test_async_transfer_concludes_after_its_latency(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Sample sample;
+    uint8_t data[3];
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    dev->latency_ms = 5;
+    mock_hal_tick_step = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_all_temperatures_async(&hmlx, &sample, NULL));
+    UNIT_TEST_ASSERT_EQUAL(1, mock_hal_pending());
+    UNIT_TEST_ASSERT_EQUAL(HAL_BUSY, HAL_I2C_Mem_Read_IT(&test_hi2c1, 0x5A << 1, 0x06, 1, data, 2));
+    mock_hal_advance(4);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_BUSY, get_mlx90614_handle_async_state(&hmlx));
+    mock_hal_advance(1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_BUSY, get_mlx90614_handle_async_state(&hmlx)); // The other two channels follow.
+    mock_hal_advance(5);
+    mock_hal_advance(5);
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_pending());
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_CPLT, get_mlx90614_handle_async_state(&hmlx));
+    UNIT_TEST_ASSERT_EQUAL(14908, sample.raw[MLX90614_Ch_Ta]);
+
+    /* A lost completion keeps the transfer in process until it is aborted. */
+    dev->is_completion_lost = 1;
+    UNIT_TEST_ASSERT_EQUAL(HAL_OK, HAL_I2C_Mem_Read_IT(&test_hi2c1, 0x5A << 1, 0x06, 1, data, 2));
+    mock_hal_advance(1000);
+    UNIT_TEST_ASSERT_EQUAL(1, mock_hal_pending());
+    UNIT_TEST_ASSERT_EQUAL(HAL_OK, HAL_I2C_Master_Abort_IT(&test_hi2c1, 0x5A << 1));
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_pending());
+}
+
+static void test_sleep_and_wake_up_pulse(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    uint8_t sleep[2] = {0xFF, 0};
+    const uint8_t frame[] = {0xB4, 0xFF};
+    uint8_t data[3];
+    GPIO_TypeDef port;
+
+    sleep[1] = mock_hal_calculate_pec(frame, sizeof(frame));
+    UNIT_TEST_ASSERT_EQUAL(HAL_OK, HAL_I2C_Master_Transmit(&test_hi2c1, 0x5A << 1, sleep, sizeof(sleep), 10));
+    UNIT_TEST_ASSERT(dev->is_asleep);
+    UNIT_TEST_ASSERT_EQUAL(HAL_ERROR, HAL_I2C_Mem_Read(&test_hi2c1, 0x5A << 1, 0x06, 1, data, 3, 10));
+
+    /* A pulse shorter than the t_DDQ of the MLX90614 Datasheet must not wake it up. */
+    HAL_GPIO_WritePin(&port, MOCK_HAL_SDA_PIN, GPIO_PIN_RESET);
+    mock_hal_advance(10);
+    HAL_GPIO_WritePin(&port, MOCK_HAL_SDA_PIN, GPIO_PIN_SET);
+    UNIT_TEST_ASSERT(dev->is_asleep);
+
+    /* Neither does releasing SCL after having held it low during the Sleep Mode. */
+    HAL_GPIO_WritePin(&port, GPIO_PIN_6, GPIO_PIN_RESET);
+    mock_hal_advance(MOCK_HAL_WAKE_PULSE_TIME);
+    HAL_GPIO_WritePin(&port, GPIO_PIN_6, GPIO_PIN_SET);
+    UNIT_TEST_ASSERT(dev->is_asleep);
+    HAL_GPIO_WritePin(&port, MOCK_HAL_SDA_PIN, GPIO_PIN_RESET);
+    mock_hal_advance(MOCK_HAL_WAKE_PULSE_TIME);
+    HAL_GPIO_WritePin(&port, MOCK_HAL_SDA_PIN, GPIO_PIN_SET);
+    UNIT_TEST_ASSERT(!dev->is_asleep);
+    UNIT_TEST_ASSERT_EQUAL(HAL_OK, HAL_I2C_Mem_Read(&test_hi2c1, 0x5A << 1, 0x06, 1, data, 3, 10));
+}
+
+void run_mock_hal_tests(void)
+{
+    UNIT_TEST_RUN(test_reference_pec_matches_known_vectors);
+    UNIT_TEST_RUN(test_device_answers_with_its_ram_and_pec);
+    UNIT_TEST_RUN(test_device_latency_nacks_and_busy);
+    UNIT_TEST_RUN(test_device_checks_the_pec_of_writes);
+    UNIT_TEST_RUN(test_async_transfer_concludes_after_its_latency);
+    UNIT_TEST_RUN(test_sleep_and_wake_up_pulse);
+}
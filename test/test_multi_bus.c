@@ -0,0 +1,227 @@
+/**@file
+ * @brief	Tests of the @ref MLX90614_Multi_Bus , which reads the MLX90614 Devices of several I2C Peripherals in
+ *          parallel and those of each one of them in a round-robin fashion.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+#define TEST_MAX_CALLS  (16)    /**< @brief Maximum number of calls of @ref record_sample that are recorded. */
+
+static MLX90614_Handle *called_handles[TEST_MAX_CALLS];    /**< @brief MLX90614 Handles passed to @ref record_sample , in the order of its calls. */
+static MLX90614_Status called_statuses[TEST_MAX_CALLS];    /**< @brief Exception Codes passed to @ref record_sample , in the order of its calls. */
+static uint8_t calls;                                      /**< @brief Number of calls made to @ref record_sample . */
+
+/**@brief	@ref MLX90614_Sample_Callback that records the order in which the readings of a Multi Bus conclude. */
+static void record_sample(MLX90614_Handle *hmlx, MLX90614_Status status, MLX90614_Sample *sample)
+{
+    (void) sample;
+    if (calls < TEST_MAX_CALLS)
+    {
+        called_handles[calls] = hmlx;
+        called_statuses[calls] = status;
+    }
+    calls++;
+}
+
+static void test_lanes_are_validated(void)
+{
+    /** <b>Local I2C_TypeDef variable i2c4_registers:</b> Registers of the I2C Peripheral of \c hi2c4 . */
+    static I2C_TypeDef i2c4_registers;
+    /** <b>Local I2C_HandleTypeDef variable hi2c4:</b> I2C Handle of a fourth I2C Peripheral. */
+    static I2C_HandleTypeDef hi2c4;
+    MLX90614_Handle hmlx[5];
+    MLX90614_Handle *mixed[2] = {&hmlx[0], &hmlx[1]};
+    MLX90614_Handle *lanes[4][1] = {{&hmlx[0]}, {&hmlx[1]}, {&hmlx[2]}, {&hmlx[3]}};
+    MLX90614_Handle *same_bus[1] = {&hmlx[4]};
+    MLX90614_Sample samples[2];
+    MLX90614_Multi_Bus mb;
+
+    mock_hal_init_i2c(&hi2c4, &i2c4_registers);
+    mock_hal_add_device(&test_hi2c1, 0x5A);
+    mock_hal_add_device(&test_hi2c1, 0x5B);
+    mock_hal_add_device(&test_hi2c2, 0x5A);
+    mock_hal_add_device(&test_hi2c3, 0x5A);
+    mock_hal_add_device(&hi2c4, 0x5A);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx[0], &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx[1], &test_hi2c2, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx[2], &test_hi2c3, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx[3], &hi2c4, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx[4], &test_hi2c1, 0x5B, MLX90614_Temp_C));
+
+    init_mlx90614_multi_bus(&mb, NULL);
+    UNIT_TEST_ASSERT_EQUAL(0, pump_mlx90614_multi_bus(&mb));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, add_mlx90614_multi_bus_lane(&mb, lanes[0], samples, 0));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, add_mlx90614_multi_bus_lane(&mb, lanes[0], samples, 33)); // A Lane holds up to 32 MLX90614 Handles.
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, add_mlx90614_multi_bus_lane(&mb, mixed, samples, 2));
+    UNIT_TEST_ASSERT_EQUAL(0, mb.lane_count);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, add_mlx90614_multi_bus_lane(&mb, lanes[0], samples, 1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, add_mlx90614_multi_bus_lane(&mb, same_bus, samples, 1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, add_mlx90614_multi_bus_lane(&mb, lanes[1], samples, 1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, add_mlx90614_multi_bus_lane(&mb, lanes[2], samples, 1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, add_mlx90614_multi_bus_lane(&mb, lanes[3], samples, 1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_MAX_NUMBER_OF_ASYNC_I2C, mb.lane_count);
+}
+
+static void test_lanes_transfer_in_parallel_and_in_round_robin(void)
+{
+    Mock_MLX90614 *dev1 = mock_hal_add_device(&test_hi2c1, 0x5A);
+    Mock_MLX90614 *dev2 = mock_hal_add_device(&test_hi2c1, 0x5B);
+    Mock_MLX90614 *dev3 = mock_hal_add_device(&test_hi2c2, 0x5A);
+    MLX90614_Handle hmlx[3];
+    MLX90614_Handle *lane1[2] = {&hmlx[0], &hmlx[1]};
+    MLX90614_Handle *lane2[1] = {&hmlx[2]};
+    MLX90614_Sample samples1[2], samples2[1];
+    MLX90614_Multi_Bus mb;
+
+    dev1->ram[0x07] = 15000;
+    dev2->ram[0x07] = 15100;
+    dev3->ram[0x07] = 15200;
+    dev1->latency_ms = 1;
+    dev2->latency_ms = 1;
+    dev3->latency_ms = 2;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx[0], &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx[1], &test_hi2c1, 0x5B, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx[2], &test_hi2c2, 0x5A, MLX90614_Temp_C));
+    mock_hal_tick_step = 0;
+    calls = 0;
+    init_mlx90614_multi_bus(&mb, record_sample);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, add_mlx90614_multi_bus_lane(&mb, lane1, samples1, 2));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, add_mlx90614_multi_bus_lane(&mb, lane2, samples2, 1));
+
+    /* Both Lanes are transferring at the same time, where each reading is made of three transactions. */
+    UNIT_TEST_ASSERT_EQUAL(2, pump_mlx90614_multi_bus(&mb));
+    UNIT_TEST_ASSERT_EQUAL(2, mock_hal_pending());
+    for (uint8_t ms=0; ms<6; ms++)
+    {
+        mock_hal_advance(1);
+        pump_mlx90614_multi_bus(&mb);
+    }
+    UNIT_TEST_ASSERT_EQUAL(3, calls);
+    UNIT_TEST_ASSERT(called_handles[0] == &hmlx[0]);
+    UNIT_TEST_ASSERT(called_handles[1] == &hmlx[1]);
+    UNIT_TEST_ASSERT(called_handles[2] == &hmlx[2]);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, called_statuses[2]);
+    UNIT_TEST_ASSERT_EQUAL(15000, samples1[0].raw[MLX90614_Ch_Tobj1]);
+    UNIT_TEST_ASSERT_EQUAL(15100, samples1[1].raw[MLX90614_Ch_Tobj1]);
+    UNIT_TEST_ASSERT_EQUAL(15200, samples2[0].raw[MLX90614_Ch_Tobj1]);
+    UNIT_TEST_ASSERT_EQUAL(1, mb.lane[0].sweeps);
+    UNIT_TEST_ASSERT_EQUAL(1, mb.lane[1].sweeps);
+    UNIT_TEST_ASSERT_EQUAL(0x3, mb.lane[0].valid_mask);
+    UNIT_TEST_ASSERT_EQUAL(0x1, mb.lane[1].valid_mask);
+    UNIT_TEST_ASSERT_EQUAL(3, mb.completed);
+    UNIT_TEST_ASSERT_EQUAL(0, mb.failed);
+
+    /* The Lanes keep going around their MLX90614 Devices, where a NACKed reading only clears its own sample. */
+    dev2->nacks_left = 1;
+    for (uint8_t ms=0; ms<6; ms++)
+    {
+        mock_hal_advance(1);
+        pump_mlx90614_multi_bus(&mb);
+    }
+    UNIT_TEST_ASSERT_EQUAL(6, calls);
+    UNIT_TEST_ASSERT(called_handles[4] == &hmlx[1]);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, called_statuses[4]);
+    UNIT_TEST_ASSERT_EQUAL(0x1, mb.lane[0].valid_mask);
+    UNIT_TEST_ASSERT_EQUAL(2, mb.lane[0].sweeps);
+    UNIT_TEST_ASSERT_EQUAL(2, mb.lane[1].sweeps);
+    UNIT_TEST_ASSERT_EQUAL(5, mb.completed);
+    UNIT_TEST_ASSERT_EQUAL(1, mb.failed);
+
+    /* Conclude the readings in process so that no Asynchronous reading is left behind. */
+    while (mock_hal_pending() != 0)
+    {
+        mock_hal_advance(1);
+    }
+}
+
+static void test_reading_that_cannot_be_requested_is_skipped(void)
+{
+    mock_hal_add_device(&test_hi2c1, 0x5A);
+    mock_hal_add_device(&test_hi2c1, 0x5B);
+    MLX90614_Handle hmlx[2];
+    MLX90614_Handle *lane[2] = {&hmlx[0], &hmlx[1]};
+    MLX90614_Sample samples[2], other;
+    MLX90614_Multi_Bus mb;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx[0], &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx[1], &test_hi2c1, 0x5B, MLX90614_Temp_C));
+    init_mlx90614_multi_bus(&mb, NULL);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, add_mlx90614_multi_bus_lane(&mb, lane, samples, 2));
+
+    /* Another Asynchronous reading keeps the I2C Peripheral of the Lane busy. */
+    mock_hal_tick_step = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_all_temperatures_async(&hmlx[1], &other, NULL));
+    UNIT_TEST_ASSERT_EQUAL(0, pump_mlx90614_multi_bus(&mb));
+    UNIT_TEST_ASSERT_EQUAL(1, mb.failed);
+    UNIT_TEST_ASSERT_EQUAL(1, mb.lane[0].next);
+    UNIT_TEST_ASSERT_EQUAL(0, mb.lane[0].valid_mask);
+    while (mock_hal_pending() != 0)
+    {
+        mock_hal_advance(1);
+    }
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_CPLT, get_mlx90614_handle_async_state(&hmlx[1]));
+
+    UNIT_TEST_ASSERT_EQUAL(1, pump_mlx90614_multi_bus(&mb));
+    while (mock_hal_pending() != 0)
+    {
+        mock_hal_advance(1);
+    }
+    UNIT_TEST_ASSERT_EQUAL(1, pump_mlx90614_multi_bus(&mb));
+    UNIT_TEST_ASSERT_EQUAL(1, mb.completed);
+    UNIT_TEST_ASSERT_EQUAL(0x2, mb.lane[0].valid_mask);
+    UNIT_TEST_ASSERT_EQUAL(1, mb.lane[0].sweeps);
+    while (mock_hal_pending() != 0)
+    {
+        mock_hal_advance(1);
+    }
+}
+
+static void test_reading_that_cannot_be_requested_is_reported(void)
+{
+    mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Handle *lane[1] = {&hmlx};
+    MLX90614_Sample samples[1];
+    MLX90614_Multi_Bus mb;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    calls = 0;
+    init_mlx90614_multi_bus(&mb, record_sample);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, add_mlx90614_multi_bus_lane(&mb, lane, samples, 1));
+
+    /* The callback gets the Exception Code of the request, just as it gets the one of a concluded reading. */
+    test_hi2c1.State = HAL_I2C_STATE_BUSY_RX;
+    UNIT_TEST_ASSERT_EQUAL(0, pump_mlx90614_multi_bus(&mb));
+    UNIT_TEST_ASSERT_EQUAL(1, calls);
+    UNIT_TEST_ASSERT(called_handles[0] == &hmlx);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, called_statuses[0]);
+    UNIT_TEST_ASSERT_EQUAL(1, mb.failed);
+    UNIT_TEST_ASSERT_EQUAL(1, mb.lane[0].sweeps);
+    UNIT_TEST_ASSERT_EQUAL(0, mb.lane[0].valid_mask);
+    test_hi2c1.State = HAL_I2C_STATE_READY;
+
+    UNIT_TEST_ASSERT_EQUAL(1, pump_mlx90614_multi_bus(&mb));
+    while (mock_hal_pending() != 0)
+    {
+        mock_hal_advance(1);
+    }
+    UNIT_TEST_ASSERT_EQUAL(1, pump_mlx90614_multi_bus(&mb));
+    UNIT_TEST_ASSERT_EQUAL(2, calls);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, called_statuses[1]);
+    UNIT_TEST_ASSERT_EQUAL(1, mb.completed);
+    while (mock_hal_pending() != 0)
+    {
+        mock_hal_advance(1);
+    }
+}
+
+void run_multi_bus_tests(void)
+{
+    UNIT_TEST_RUN(test_lanes_are_validated);
+    UNIT_TEST_RUN(test_lanes_transfer_in_parallel_and_in_round_robin);
+    UNIT_TEST_RUN(test_reading_that_cannot_be_requested_is_skipped);
+    UNIT_TEST_RUN(test_reading_that_cannot_be_requested_is_reported);
+}
@@ -0,0 +1,86 @@
+/**@file
+ * @brief	Tests of the PEC implementation selected via @ref MLX90614_PEC_IMPLEMENTATION , which the Makefile builds
+ *          once per implementation so that the bitwise one, the Nibble Table and the Byte Table all get checked
+ *          against the same reference.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+#include "mlx90614_whitebox.h"
+
+/**@brief	Calculates the PEC byte of the given data byte by shifting one bit at a time through the x^8+x^2+x+1
+ *          polynomial, independently of the @ref mlx90614 . */
+static uint8_t calculate_reference_pec(uint8_t init_pec, uint8_t new_data)
+{
+    /** <b>Local uint8_t variable data:</b> PEC byte being calculated. */
+    uint8_t data = init_pec ^ new_data;
+    for (uint8_t i=0; i<8; i++)
+    {
+        data = (data & 0x80) ? (uint8_t) ((data << 1) ^ 0x07) : (uint8_t) (data << 1);
+    }
+    return data;
+}
+
+static void test_pec_matches_the_bitwise_reference_exhaustively(void)
+{
+    /** <b>Local unsigned int variable mismatches:</b> Number of init_pec and new_data pairs that gave a wrong PEC byte. */
+    unsigned int mismatches = 0;
+    for (uint16_t init_pec=0; init_pec<256; init_pec++)
+    {
+        for (uint16_t new_data=0; new_data<256; new_data++)
+        {
+            if (whitebox_calculate_pec((uint8_t) init_pec, (uint8_t) new_data) != calculate_reference_pec((uint8_t) init_pec, (uint8_t) new_data))
+            {
+                mismatches++;
+            }
+        }
+    }
+    UNIT_TEST_ASSERT_EQUAL(0, mismatches);
+}
+
+static void test_pec_of_the_datasheet_frame(void)
+{
+    /* NOTE: This is the example of the "Read Word" SMBus frame given in the MLX90614 Datasheet, whose PEC is 0x30. */
+    const uint8_t frame[] = {0xB4, 0x07, 0xB5, 0xD2, 0x3A};
+    /** <b>Local uint8_t variable pec:</b> PEC byte calculated so far. */
+    uint8_t pec = 0;
+    for (uint8_t i=0; i<sizeof(frame); i++)
+    {
+        pec = whitebox_calculate_pec(pec, frame[i]);
+    }
+    UNIT_TEST_ASSERT_EQUAL(0x30, pec);
+    UNIT_TEST_ASSERT_EQUAL(0x30, mock_hal_calculate_pec(frame, sizeof(frame)));
+}
+
+static void test_pec_check_accepts_every_valid_reading(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5B);
+    MLX90614_Handle hmlx;
+    uint16_t raw;
+    /** <b>Local unsigned int variable rejections:</b> Number of valid readings that the PEC check rejected. */
+    unsigned int rejections = 0;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5B, MLX90614_Temp_C));
+    set_mlx90614_handle_pec_check(&hmlx, 1);
+    for (uint32_t value=0; value<0x8000; value+=7)
+    {
+        dev->ram[0x08] = (uint16_t) value;
+        if ((get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj2, 1, &raw) != MLX90614_EC_OK) || (raw != value))
+        {
+            rejections++;
+        }
+    }
+    UNIT_TEST_ASSERT_EQUAL(0, rejections);
+
+    dev->is_pec_corrupted = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj2, 1, &raw));
+}
+
+void run_pec_tests(void)
+{
+    UNIT_TEST_RUN(test_pec_matches_the_bitwise_reference_exhaustively);
+    UNIT_TEST_RUN(test_pec_of_the_datasheet_frame);
+    UNIT_TEST_RUN(test_pec_check_accepts_every_valid_reading);
+}
@@ -0,0 +1,106 @@
+/**@file
+ * @brief	Tests of the @ref MLX90614_PWM Reader, which measures the temperature that a MLX90614 Device outputs
+ *          through its PWM output via the Input Capture of a Hardware Timer.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+#define TEST_TO_MAX         (39315) /**< @brief \f$T_{O,MAX}\f$ of the factory default settings in hundredths of Kelvin (i.e., \f$120^{\circ}C\f$ ). */
+#define TEST_TO_MIN         (25315) /**< @brief \f$T_{O,MIN}\f$ of the factory default settings in hundredths of Kelvin (i.e., \f$-20^{\circ}C\f$ ). */
+#define TEST_PERIOD         (1024)  /**< @brief PWM period of the factory default settings in ticks of a 1MHz Hardware Timer. */
+#define TEST_START_MARK     (TEST_PERIOD / 8)   /**< @brief Start mark of each PWM cycle in ticks of the Hardware Timer. */
+
+static TIM_HandleTypeDef htim;  /**< @brief Hardware Timer Handle under test. */
+
+/**@brief	Sets the period and the high time that the Hardware Timer captured in the latest PWM cycle. */
+static void capture_pwm_cycle(uint32_t period, uint32_t high_time)
+{
+    mock_hal_tim_capture[0] = period;
+    mock_hal_tim_capture[1] = high_time;
+}
+
+static void test_pwm_reader_is_validated(void)
+{
+    MLX90614_PWM pwm;
+    uint16_t raw;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_pwm(&pwm, &htim, TIM_CHANNEL_1, TIM_CHANNEL_2, TEST_TO_MIN, TEST_TO_MIN, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_pwm(&pwm, &htim, TIM_CHANNEL_1, TIM_CHANNEL_2, TEST_TO_MIN, TEST_TO_MAX, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_pwm(&pwm, &htim, TIM_CHANNEL_1, TIM_CHANNEL_2, TEST_TO_MAX, TEST_TO_MIN, (MLX90614_Temp_t) 3));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_pwm(&pwm, &htim, TIM_CHANNEL_1, TIM_CHANNEL_2, TEST_TO_MAX, TEST_TO_MIN, MLX90614_Temp_C));
+
+    /* Nothing is measured until a whole PWM cycle has been captured. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, get_mlx90614_pwm_raw_temperature(&pwm, &raw));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, stop_mlx90614_pwm(&pwm));
+}
+
+static void test_high_time_is_converted_into_a_raw_value(void)
+{
+    MLX90614_PWM pwm;
+    uint16_t raw;
+    float temperature;
+    int32_t centi_temperature;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_pwm(&pwm, &htim, TIM_CHANNEL_1, TIM_CHANNEL_2, TEST_TO_MAX, TEST_TO_MIN, MLX90614_Temp_C));
+
+    /* The start mark stands for T_O,MIN and half of the period after it stands for T_O,MAX . */
+    capture_pwm_cycle(TEST_PERIOD, TEST_START_MARK);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_pwm_raw_temperature(&pwm, &raw));
+    UNIT_TEST_ASSERT_EQUAL((TEST_TO_MIN + 1) / 2, raw);
+    capture_pwm_cycle(TEST_PERIOD, TEST_START_MARK + TEST_PERIOD/2);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_pwm_raw_temperature(&pwm, &raw));
+    UNIT_TEST_ASSERT_EQUAL((TEST_TO_MAX + 1) / 2, raw);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_pwm_temperature(&pwm, &temperature));
+    UNIT_TEST_ASSERT_FLOAT(120.01, temperature, 0.001);
+
+    /* A quarter of the period after the start mark stands for the middle of the range, whatever the period is. */
+    capture_pwm_cycle(8 * TEST_PERIOD, 8 * (TEST_START_MARK + TEST_PERIOD/4));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_pwm_raw_temperature(&pwm, &raw));
+    UNIT_TEST_ASSERT_EQUAL(16158, raw);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_pwm_centi_temperature(&pwm, &centi_temperature));
+    UNIT_TEST_ASSERT_EQUAL(5001, centi_temperature);
+
+    /* A high time that the PWM output cannot give is rejected. */
+    capture_pwm_cycle(TEST_PERIOD, TEST_START_MARK - 1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_pwm_raw_temperature(&pwm, &raw));
+    capture_pwm_cycle(TEST_PERIOD, TEST_START_MARK + TEST_PERIOD/2 + 1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_pwm_temperature(&pwm, &temperature));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_pwm_centi_temperature(&pwm, &centi_temperature));
+}
+
+static void test_pwm_readings_go_through_the_filter(void)
+{
+    MLX90614_PWM pwm;
+    MLX90614_Filter filter;
+    uint16_t raw;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_pwm(&pwm, &htim, TIM_CHANNEL_1, TIM_CHANNEL_2, TEST_TO_MAX, TEST_TO_MIN, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_filter(&filter, MLX90614_FILTER_MEDIAN, 3));
+    set_mlx90614_pwm_filter(&pwm, &filter);
+    capture_pwm_cycle(TEST_PERIOD, TEST_START_MARK + TEST_PERIOD/4);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_pwm_raw_temperature(&pwm, &raw));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_pwm_raw_temperature(&pwm, &raw));
+
+    /* Neither a spike nor a rejected high time get through the Median Filter. */
+    capture_pwm_cycle(TEST_PERIOD, TEST_START_MARK + TEST_PERIOD/2);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_pwm_raw_temperature(&pwm, &raw));
+    UNIT_TEST_ASSERT_EQUAL(16158, raw);
+    capture_pwm_cycle(TEST_PERIOD, 0);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_pwm_raw_temperature(&pwm, &raw));
+    UNIT_TEST_ASSERT_EQUAL(3, filter.count);
+
+    set_mlx90614_pwm_filter(&pwm, NULL);
+    capture_pwm_cycle(TEST_PERIOD, TEST_START_MARK + TEST_PERIOD/2);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_pwm_raw_temperature(&pwm, &raw));
+    UNIT_TEST_ASSERT_EQUAL((TEST_TO_MAX + 1) / 2, raw);
+}
+
+void run_pwm_tests(void)
+{
+    UNIT_TEST_RUN(test_pwm_reader_is_validated);
+    UNIT_TEST_RUN(test_high_time_is_converted_into_a_raw_value);
+    UNIT_TEST_RUN(test_pwm_readings_go_through_the_filter);
+}
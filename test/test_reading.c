@@ -0,0 +1,137 @@
+/**@file
+ * @brief	Tests of the temperature readings of the @ref mlx90614 , in both Polling and Asynchronous Modes, over
+ *          simulated MLX90614 Devices that respond, that NACK, that are slow, that raise Error Flags or that corrupt
+ *          their PEC.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+static void test_module_reads_every_channel(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    dev->ram[0x06] = 14908;     // 25°C.
+    dev->ram[0x07] = 15658;     // 40°C.
+    dev->ram[0x08] = 13658;     // 0°C.
+    float temperature;
+    MLX90614_Sample sample;
+
+#if ((MLX90614_FIXED_UNIT == MLX90614_FIXED_UNIT_NONE) || (MLX90614_FIXED_UNIT == 1))
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_module(&test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_ambient_temperature(&temperature));
+    UNIT_TEST_ASSERT_FLOAT(25.01, temperature, 0.001);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_object1_temperature(&temperature));
+    UNIT_TEST_ASSERT_FLOAT(40.01, temperature, 0.001);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_object2_temperature(&temperature));
+    UNIT_TEST_ASSERT_FLOAT(0.01, temperature, 0.001);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_all_temperatures(&sample));
+    UNIT_TEST_ASSERT_EQUAL(14908, sample.raw[MLX90614_Ch_Ta]);
+    UNIT_TEST_ASSERT_EQUAL(15658, sample.raw[MLX90614_Ch_Tobj1]);
+    UNIT_TEST_ASSERT_EQUAL(13658, sample.raw[MLX90614_Ch_Tobj2]);
+    UNIT_TEST_ASSERT_FLOAT(40.01, sample.temperature[MLX90614_Ch_Tobj1], 0.001);
+#else
+    (void) temperature;
+    (void) sample;
+#endif
+}
+
+static void test_init_rejects_missing_devices_and_invalid_arguments(void)
+{
+    MLX90614_Handle hmlx;
+
+    mock_hal_add_device(&test_hi2c1, 0x5A);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x80, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, (MLX90614_Temp_t) 7));
+#if (MLX90614_DEFAULT_ADDRESS_VALIDATION == MLX90614_ADDRESS_VALIDATION_PROBE)
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, init_mlx90614_handle(&hmlx, &test_hi2c2, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5B, MLX90614_Temp_C));
+#endif
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+}
+
+static void test_reading_reports_nacks_timeouts_and_error_flags(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    uint16_t raw;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(14908, raw);
+
+    /* A NACK under a slave address that has already been verified is a HAL Error. */
+    dev->nacks_left = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    dev->latency_ms = MLX90614_I2C_TIMEOUT + 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    dev->latency_ms = 0;
+    dev->busy_left = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+
+    dev->ram[0x07] = 0x8000 | 14908;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Ta, 1, &raw));
+}
+
+static void test_pec_check_rejects_corrupted_readings(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    uint16_t raw;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    dev->is_pec_corrupted = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    set_mlx90614_handle_pec_check(&hmlx, 1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    dev->is_pec_corrupted = 0;
+    for (uint16_t value=0; value<0x8000; value+=0x0101)
+    {
+        dev->ram[0x07] = value;
+        UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+        UNIT_TEST_ASSERT_EQUAL(value, raw);
+    }
+}
+
+static void test_devices_on_several_buses_are_read_asynchronously(void)
+{
+    Mock_MLX90614 *dev1 = mock_hal_add_device(&test_hi2c1, 0x5A);
+    Mock_MLX90614 *dev2 = mock_hal_add_device(&test_hi2c2, 0x5A);
+    MLX90614_Handle hmlx1, hmlx2;
+    MLX90614_Sample sample1, sample2;
+
+    dev1->ram[0x07] = 15000;
+    dev2->ram[0x07] = 16000;
+    dev2->latency_ms = 3;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx1, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx2, &test_hi2c2, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_all_temperatures_async(&hmlx1, &sample1, NULL));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_all_temperatures_async(&hmlx2, &sample2, NULL));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_all_temperatures_async(&hmlx1, &sample1, NULL));
+    UNIT_TEST_ASSERT_EQUAL(2, mock_hal_pending());
+    while (mock_hal_pending() != 0)
+    {
+        mock_hal_advance(1);
+    }
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_CPLT, get_mlx90614_handle_async_state(&hmlx1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_CPLT, get_mlx90614_handle_async_state(&hmlx2));
+    UNIT_TEST_ASSERT_EQUAL(15000, sample1.raw[MLX90614_Ch_Tobj1]);
+    UNIT_TEST_ASSERT_EQUAL(16000, sample2.raw[MLX90614_Ch_Tobj1]);
+
+    /* A device that NACKs its Asynchronous reading concludes it with an error. */
+    dev2->nacks_left = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature_async(&hmlx2, NULL));
+    mock_hal_advance(10);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_ERR, get_mlx90614_handle_async_state(&hmlx2));
+}
+
+void run_reading_tests(void)
+{
+    UNIT_TEST_RUN(test_module_reads_every_channel);
+    UNIT_TEST_RUN(test_init_rejects_missing_devices_and_invalid_arguments);
+    UNIT_TEST_RUN(test_reading_reports_nacks_timeouts_and_error_flags);
+    UNIT_TEST_RUN(test_pec_check_rejects_corrupted_readings);
+    UNIT_TEST_RUN(test_devices_on_several_buses_are_read_asynchronously);
+}
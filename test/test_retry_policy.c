@@ -0,0 +1,114 @@
+/**@file
+ * @brief	Tests of the @ref MLX90614_Retry_Policy , whose backoff must double on every retry up to its maximum, and
+ *          which must bound the number of attempts of every blocking I2C transaction.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+#include "mlx90614_whitebox.h"
+
+static void test_backoff_doubles_up_to_its_maximum(void)
+{
+    const MLX90614_Retry_Policy policy = {.timeout_ms = 10, .retries = 5, .backoff_ms = 3, .max_backoff_ms = 20, .is_fail_fast = 0};
+    const uint32_t expected_backoffs[] = {3, 6, 12, 20, 20};
+
+    for (uint8_t attempt=0; attempt<policy.retries; attempt++)
+    {
+        mock_hal_delayed_ms = 0;
+        UNIT_TEST_ASSERT_EQUAL(1, whitebox_wait_mlx90614_retry(&policy, attempt));
+        UNIT_TEST_ASSERT_EQUAL(expected_backoffs[attempt], mock_hal_delayed_ms);
+    }
+    mock_hal_delayed_ms = 0;
+    UNIT_TEST_ASSERT_EQUAL(0, whitebox_wait_mlx90614_retry(&policy, policy.retries));
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_delayed_ms);
+}
+
+static void test_backoff_neither_wraps_around_nor_waits_when_disabled(void)
+{
+    MLX90614_Retry_Policy policy = {.timeout_ms = 10, .retries = 255, .backoff_ms = 0x40000000, .max_backoff_ms = UINT32_MAX, .is_fail_fast = 0};
+
+    /* A doubling past 2^32 must saturate instead of wrapping around towards a backoff of zero. */
+    for (uint8_t attempt=0; attempt<40; attempt++)
+    {
+        mock_hal_delayed_ms = 0;
+        UNIT_TEST_ASSERT_EQUAL(1, whitebox_wait_mlx90614_retry(&policy, attempt));
+        UNIT_TEST_ASSERT(mock_hal_delayed_ms >= 0x40000000);
+    }
+
+    policy.backoff_ms = 0;
+    mock_hal_delayed_ms = 0;
+    UNIT_TEST_ASSERT_EQUAL(1, whitebox_wait_mlx90614_retry(&policy, 7));
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_delayed_ms);
+
+    policy.backoff_ms = 5;
+    policy.is_fail_fast = 1;
+    UNIT_TEST_ASSERT_EQUAL(0, whitebox_wait_mlx90614_retry(&policy, 0));
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_delayed_ms);
+}
+
+static void test_readings_are_retried_according_to_the_policy(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Retry_Policy policy = {.timeout_ms = 5, .retries = 2, .backoff_ms = 2, .max_backoff_ms = 16, .is_fail_fast = 0};
+    MLX90614_Retry_Policy current;
+    uint16_t raw;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    get_mlx90614_handle_retry_policy(&hmlx, &current);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_I2C_TIMEOUT, current.timeout_ms);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_DEFAULT_RETRIES, current.retries);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_retry_policy(&hmlx, &policy));
+
+    /* Two NACKs are absorbed by the two retries, after having waited 2ms and then 4ms. */
+    dev->nacks_left = 2;
+    dev->reads = 0;
+    mock_hal_delayed_ms = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(6, mock_hal_delayed_ms);
+    UNIT_TEST_ASSERT_EQUAL(1, dev->reads);
+
+    /* A third one is not. */
+    dev->nacks_left = 3;
+    mock_hal_delayed_ms = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(6, mock_hal_delayed_ms);
+    UNIT_TEST_ASSERT_EQUAL(0, dev->nacks_left);
+
+    /* The timeout of the policy is the one given to the HAL, and so a slower device is not waited for. */
+    dev->latency_ms = policy.timeout_ms + 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    dev->latency_ms = policy.timeout_ms;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    dev->latency_ms = 0;
+
+    /* A PEC mismatch is retried as well. */
+    set_mlx90614_handle_pec_check(&hmlx, 1);
+    dev->is_pec_corrupted = 1;
+    dev->reads = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(3, dev->reads);
+    dev->is_pec_corrupted = 0;
+
+    /* The fail-fast option overrides the retries. */
+    policy.is_fail_fast = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, set_mlx90614_handle_retry_policy(&hmlx, &policy));
+    dev->nacks_left = 1;
+    mock_hal_delayed_ms = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(0, mock_hal_delayed_ms);
+
+    policy.timeout_ms = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, set_mlx90614_handle_retry_policy(&hmlx, &policy));
+    get_mlx90614_handle_retry_policy(&hmlx, &current);
+    UNIT_TEST_ASSERT_EQUAL(5, current.timeout_ms);
+}
+
+void run_retry_policy_tests(void)
+{
+    UNIT_TEST_RUN(test_backoff_doubles_up_to_its_maximum);
+    UNIT_TEST_RUN(test_backoff_neither_wraps_around_nor_waits_when_disabled);
+    UNIT_TEST_RUN(test_readings_are_retried_according_to_the_policy);
+}
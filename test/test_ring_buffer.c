@@ -0,0 +1,123 @@
+/**@file
+ * @brief	Tests of the @ref MLX90614_Ring_Buffer , both on its own and while being fed by the Asynchronous readings of
+ *          a @ref MLX90614_Handle .
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+static MLX90614_Ring_Buffer rb;                                 /**< @brief Ring Buffer under test. */
+static MLX90614_Ring_Entry entries[MLX90614_RING_BUFFER_CAPACITY];  /**< @brief Entries popped from @ref rb . */
+
+static void test_ring_buffer_keeps_the_push_order_and_timestamps(void)
+{
+    init_mlx90614_ring_buffer(&rb);
+    UNIT_TEST_ASSERT_EQUAL(0, get_mlx90614_ring_buffer_count(&rb));
+    UNIT_TEST_ASSERT_EQUAL(0, pop_mlx90614_ring_buffer(&rb, entries, MLX90614_RING_BUFFER_CAPACITY));
+
+    mock_hal_tick_step = 0;
+    for (uint16_t i=0; i<5; i++)
+    {
+        mock_hal_tick = 100 + i;
+        UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, push_mlx90614_ring_buffer(&rb, 0x5A, MLX90614_Ch_Tobj1, (uint16_t) (14000 + i)));
+    }
+    UNIT_TEST_ASSERT_EQUAL(5, get_mlx90614_ring_buffer_count(&rb));
+    UNIT_TEST_ASSERT_EQUAL(2, pop_mlx90614_ring_buffer(&rb, entries, 2));
+    UNIT_TEST_ASSERT_EQUAL(14000, entries[0].raw);
+    UNIT_TEST_ASSERT_EQUAL(14001, entries[1].raw);
+    UNIT_TEST_ASSERT_EQUAL(101, entries[1].timestamp);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_Ch_Tobj1, entries[1].channel);
+    UNIT_TEST_ASSERT_EQUAL(0x5A, entries[1].slave_address);
+    UNIT_TEST_ASSERT_EQUAL(3, pop_mlx90614_ring_buffer(&rb, entries, MLX90614_RING_BUFFER_CAPACITY));
+    UNIT_TEST_ASSERT_EQUAL(14004, entries[2].raw);
+    UNIT_TEST_ASSERT_EQUAL(0, get_mlx90614_ring_buffer_count(&rb));
+}
+
+static void test_ring_buffer_drops_whatever_does_not_fit(void)
+{
+    init_mlx90614_ring_buffer(&rb);
+    for (uint16_t i=0; i<MLX90614_RING_BUFFER_CAPACITY; i++)
+    {
+        UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, push_mlx90614_ring_buffer(&rb, 0x5A, MLX90614_Ch_Ta, i));
+    }
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, push_mlx90614_ring_buffer(&rb, 0x5A, MLX90614_Ch_Ta, 1000));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, push_mlx90614_ring_buffer(&rb, 0x5A, MLX90614_Ch_Ta, 1001));
+    UNIT_TEST_ASSERT_EQUAL(2, get_mlx90614_ring_buffer_dropped(&rb));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_RING_BUFFER_CAPACITY, get_mlx90614_ring_buffer_count(&rb));
+
+    /* The oldest entries are kept, and popping a single one makes room for exactly one more. */
+    UNIT_TEST_ASSERT_EQUAL(1, pop_mlx90614_ring_buffer(&rb, entries, 1));
+    UNIT_TEST_ASSERT_EQUAL(0, entries[0].raw);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, push_mlx90614_ring_buffer(&rb, 0x5A, MLX90614_Ch_Ta, 1002));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, push_mlx90614_ring_buffer(&rb, 0x5A, MLX90614_Ch_Ta, 1003));
+    UNIT_TEST_ASSERT_EQUAL(3, get_mlx90614_ring_buffer_dropped(&rb));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_RING_BUFFER_CAPACITY, pop_mlx90614_ring_buffer(&rb, entries, MLX90614_RING_BUFFER_CAPACITY));
+    UNIT_TEST_ASSERT_EQUAL(1, entries[0].raw);
+    UNIT_TEST_ASSERT_EQUAL(1002, entries[MLX90614_RING_BUFFER_CAPACITY - 1].raw);
+}
+
+static void test_ring_buffer_survives_the_wrap_around_of_its_counters(void)
+{
+    init_mlx90614_ring_buffer(&rb);
+    rb.head = 0xFFFFFFFEU;
+    rb.tail = 0xFFFFFFFEU;
+    for (uint16_t i=0; i<MLX90614_RING_BUFFER_CAPACITY; i++)
+    {
+        UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, push_mlx90614_ring_buffer(&rb, 0x5A, MLX90614_Ch_Tobj2, i));
+    }
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, push_mlx90614_ring_buffer(&rb, 0x5A, MLX90614_Ch_Tobj2, 0));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_RING_BUFFER_CAPACITY, get_mlx90614_ring_buffer_count(&rb));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_RING_BUFFER_CAPACITY, pop_mlx90614_ring_buffer(&rb, entries, MLX90614_RING_BUFFER_CAPACITY));
+    /** <b>Local unsigned int variable out_of_order:</b> Number of entries that were not popped in their push order. */
+    unsigned int out_of_order = 0;
+    for (uint16_t i=0; i<MLX90614_RING_BUFFER_CAPACITY; i++)
+    {
+        out_of_order += (entries[i].raw != i);
+    }
+    UNIT_TEST_ASSERT_EQUAL(0, out_of_order);
+}
+
+static void test_async_readings_feed_the_attached_ring_buffer(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Sample sample;
+
+    init_mlx90614_ring_buffer(&rb);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    set_mlx90614_handle_ring_buffer(&hmlx, &rb);
+    dev->ram[0x07] = 15000;
+    dev->ram[0x08] = 0x8000 | 15000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature_async(&hmlx, NULL));
+    mock_hal_advance(1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object2_temperature_async(&hmlx, NULL));
+    mock_hal_advance(1);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_all_temperatures_async(&hmlx, &sample, NULL));
+    for (uint8_t i=0; i<5; i++)
+    {
+        mock_hal_advance(1);
+    }
+
+    /* The Raw Values that raised the Error Flag must not be pushed. */
+    UNIT_TEST_ASSERT_EQUAL(3, pop_mlx90614_ring_buffer(&rb, entries, MLX90614_RING_BUFFER_CAPACITY));
+    UNIT_TEST_ASSERT_EQUAL(15000, entries[0].raw);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_Ch_Tobj1, entries[0].channel);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_Ch_Ta, entries[1].channel);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_Ch_Tobj1, entries[2].channel);
+    UNIT_TEST_ASSERT_EQUAL(0, get_mlx90614_ring_buffer_dropped(&rb));
+
+    set_mlx90614_handle_ring_buffer(&hmlx, NULL);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature_async(&hmlx, NULL));
+    mock_hal_advance(1);
+    UNIT_TEST_ASSERT_EQUAL(0, get_mlx90614_ring_buffer_count(&rb));
+}
+
+void run_ring_buffer_tests(void)
+{
+    UNIT_TEST_RUN(test_ring_buffer_keeps_the_push_order_and_timestamps);
+    UNIT_TEST_RUN(test_ring_buffer_drops_whatever_does_not_fit);
+    UNIT_TEST_RUN(test_ring_buffer_survives_the_wrap_around_of_its_counters);
+    UNIT_TEST_RUN(test_async_readings_feed_the_attached_ring_buffer);
+}
@@ -0,0 +1,170 @@
+/**@file
+ * @brief	Tests of the RTOS Port Layer of the @ref mlx90614 (see @ref MLX90614_RTOS_Bus ), which are only compiled
+ *          whenever @ref MLX90614_ENABLE_RTOS is enabled.
+ *
+ * @details There is no RTOS in these tests, so the @ref MLX90614_RTOS_Port under test takes the place of the
+ *          scheduler: a task that waits on its notification lets the bus-owner task run, which services the
+ *          Requests of the RTOS Bus right there.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+#if (MLX90614_ENABLE_RTOS)
+#define TEST_QUEUE_SIZE     (2)     /**< @brief Number of Request pointers that fit in @ref fake_queue . */
+
+static MLX90614_RTOS_Request *fake_queue[TEST_QUEUE_SIZE];  /**< @brief Queue of the RTOS Bus under test. */
+static uint8_t queued;                                      /**< @brief Number of Request pointers held in @ref fake_queue . */
+static MLX90614_RTOS_Bus bus;                               /**< @brief RTOS Bus under test. */
+static uint8_t current_task;                                /**< @brief Stands for the handle of the only task of these tests. */
+static void *notified_task;                                 /**< @brief Task passed to the last call of @ref notify_task . */
+static uint8_t waits;                                       /**< @brief Number of calls made to @ref wait_notification . */
+static uint8_t spurious_wakeups;                            /**< @brief Number of calls of @ref wait_notification that will give back before the bus-owner task runs. */
+
+static MLX90614_Status queue_send(void *queue, MLX90614_RTOS_Request *request, uint32_t timeout)
+{
+    (void) queue;
+    (void) timeout;
+    if (queued == TEST_QUEUE_SIZE)
+    {
+        return MLX90614_EC_NR;
+    }
+    fake_queue[queued++] = request;
+    return MLX90614_EC_OK;
+}
+
+static MLX90614_Status queue_receive(void *queue, MLX90614_RTOS_Request **request, uint32_t timeout)
+{
+    (void) queue;
+    (void) timeout;
+    if (queued == 0)
+    {
+        return MLX90614_EC_NR;
+    }
+    *request = fake_queue[0];
+    queued--;
+    for (uint8_t i=0; i<queued; i++)
+    {
+        fake_queue[i] = fake_queue[i + 1];
+    }
+    return MLX90614_EC_OK;
+}
+
+static void *get_current_task(void)
+{
+    return &current_task;
+}
+
+static void notify_task(void *task)
+{
+    notified_task = task;
+}
+
+static MLX90614_Status wait_notification(uint32_t timeout)
+{
+    (void) timeout;
+    waits++;
+    if (spurious_wakeups > 0)
+    {
+        spurious_wakeups--;
+        return MLX90614_EC_OK;
+    }
+    return service_mlx90614_rtos_bus(&bus, 0);
+}
+
+static const MLX90614_RTOS_Port port = {queue_send, queue_receive, get_current_task, notify_task, wait_notification}; /**< @brief RTOS primitives of these tests. */
+
+/**@brief	@ref MLX90614_RTOS_Operation that gives back the Exception Code pointed by its argument. */
+static MLX90614_Status give_back_status(MLX90614_Handle *hmlx, void *arg)
+{
+    (void) hmlx;
+    return *((MLX90614_Status *) arg);
+}
+
+/**@brief	Initializes @ref bus with an empty queue. */
+static void setup_rtos_bus(void)
+{
+    queued = 0;
+    waits = 0;
+    spurious_wakeups = 0;
+    notified_task = NULL;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_rtos_bus(&bus, &port, fake_queue));
+}
+#endif
+
+static void test_rtos_bus_is_validated(void)
+{
+#if (MLX90614_ENABLE_RTOS)
+    MLX90614_RTOS_Port incomplete = port;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_rtos_bus(&bus, NULL, fake_queue));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_rtos_bus(&bus, &port, NULL));
+    incomplete.p_wait_notification = NULL;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_rtos_bus(&bus, &incomplete, fake_queue));
+    incomplete = port;
+    incomplete.p_notify_task = NULL;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_rtos_bus(&bus, &incomplete, fake_queue));
+    setup_rtos_bus();
+    UNIT_TEST_ASSERT_EQUAL(0, bus.serviced);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, service_mlx90614_rtos_bus(&bus, 0));
+    UNIT_TEST_ASSERT_EQUAL(0, bus.serviced);
+#endif
+}
+
+static void test_requests_are_serviced_by_the_bus_owner(void)
+{
+#if (MLX90614_ENABLE_RTOS)
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Sample sample;
+
+    dev->ram[0x06] = 14000;
+    dev->ram[0x07] = 15000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    setup_rtos_bus();
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_rtos_all_temperatures(&bus, &hmlx, &sample, MLX90614_RTOS_WAIT_FOREVER));
+    UNIT_TEST_ASSERT_EQUAL(14000, sample.raw[MLX90614_Ch_Ta]);
+    UNIT_TEST_ASSERT_EQUAL(15000, sample.raw[MLX90614_Ch_Tobj1]);
+    UNIT_TEST_ASSERT_EQUAL(1, bus.serviced);
+    UNIT_TEST_ASSERT_EQUAL(1, waits);
+    UNIT_TEST_ASSERT(notified_task == &current_task);
+    UNIT_TEST_ASSERT_EQUAL(0, queued);
+
+    /* The Exception Code of the operation is the one given back to the requesting task. */
+    dev->nacks_left = MLX90614_NUMBER_OF_CHANNELS;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_rtos_all_temperatures(&bus, &hmlx, &sample, MLX90614_RTOS_WAIT_FOREVER));
+    MLX90614_Status status = MLX90614_EC_NA;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NA, submit_mlx90614_rtos_request(&bus, give_back_status, &hmlx, &status, 0));
+    UNIT_TEST_ASSERT_EQUAL(3, bus.serviced);
+#endif
+}
+
+static void test_requesting_task_waits_for_its_own_request(void)
+{
+#if (MLX90614_ENABLE_RTOS)
+    MLX90614_Handle hmlx;
+    MLX90614_Status status = MLX90614_EC_OK;
+
+    /* A notification that is not the one of the Request does not let it leave the stack of its task. */
+    setup_rtos_bus();
+    spurious_wakeups = 2;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, submit_mlx90614_rtos_request(&bus, give_back_status, &hmlx, &status, 0));
+    UNIT_TEST_ASSERT_EQUAL(3, waits);
+    UNIT_TEST_ASSERT_EQUAL(1, bus.serviced);
+
+    /* A Request that does not fit in the queue is never executed. */
+    queued = TEST_QUEUE_SIZE;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, submit_mlx90614_rtos_request(&bus, give_back_status, &hmlx, &status, 0));
+    UNIT_TEST_ASSERT_EQUAL(3, waits);
+    UNIT_TEST_ASSERT_EQUAL(1, bus.serviced);
+#endif
+}
+
+void run_rtos_tests(void)
+{
+    UNIT_TEST_RUN(test_rtos_bus_is_validated);
+    UNIT_TEST_RUN(test_requests_are_serviced_by_the_bus_owner);
+    UNIT_TEST_RUN(test_requesting_task_waits_for_its_own_request);
+}
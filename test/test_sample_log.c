@@ -0,0 +1,165 @@
+/**@file
+ * @brief	Tests of the Sample Log of a @ref MLX90614_Log_Writer , from its zig-zag varints and CRC-8 up to whole
+ *          Sample Logs that are decoded back after having been truncated or corrupted.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include <string.h> // Library from which "memcmp" is located at.
+#include "unit_test.h"
+#include "mlx90614_whitebox.h"
+
+#define TEST_LOG_CAPACITY   (512)   /**< @brief Size in bytes of the buffer of the Sample Logs under test. */
+#define TEST_LOG_SAMPLES    (40)    /**< @brief Number of samples that the Sample Logs under test are made of. */
+
+static uint8_t buffer[TEST_LOG_CAPACITY];               /**< @brief Buffer into which the Sample Logs under test are written. */
+static MLX90614_Sample samples[TEST_LOG_SAMPLES];       /**< @brief Samples written into the Sample Logs under test. */
+static MLX90614_Sample decoded[TEST_LOG_SAMPLES];       /**< @brief Samples decoded back from the Sample Logs under test. */
+
+static void test_varint_round_trips_over_the_whole_int32_range(void)
+{
+    const int32_t deltas[] = {0, -1, 1, -64, 63, 64, -65, 0x7FFF, -0x7FFF, 0x10000, -0x10000, INT32_MAX, INT32_MIN, INT32_MIN + 1, INT32_MAX - 1};
+    const uint8_t sizes[] = {1, 1, 1, 1, 1, 2, 2, 3, 3, 3, 3, 5, 5, 5, 5};
+    uint8_t varint[8];
+    int32_t delta;
+
+    for (uint8_t i=0; i<sizeof(deltas)/sizeof(deltas[0]); i++)
+    {
+        UNIT_TEST_ASSERT_EQUAL(sizes[i], whitebox_write_mlx90614_log_varint(varint, deltas[i]));
+        delta = 0x5A5A5A5A;
+        UNIT_TEST_ASSERT_EQUAL(sizes[i], whitebox_read_mlx90614_log_varint(varint, sizeof(varint), &delta));
+        UNIT_TEST_ASSERT_EQUAL(deltas[i], delta);
+    }
+
+    /* The zig-zag encoding of INT32_MIN and INT32_MAX are 0xFFFFFFFF and 0xFFFFFFFE respectively. */
+    const uint8_t min_varint[] = {0xFF, 0xFF, 0xFF, 0xFF, 0x0F};
+    const uint8_t max_varint[] = {0xFE, 0xFF, 0xFF, 0xFF, 0x0F};
+    UNIT_TEST_ASSERT_EQUAL(5, whitebox_write_mlx90614_log_varint(varint, INT32_MIN));
+    UNIT_TEST_ASSERT(memcmp(varint, min_varint, sizeof(min_varint)) == 0);
+    UNIT_TEST_ASSERT_EQUAL(5, whitebox_write_mlx90614_log_varint(varint, INT32_MAX));
+    UNIT_TEST_ASSERT(memcmp(varint, max_varint, sizeof(max_varint)) == 0);
+
+    /* Every difference between two Raw Values must fit into @ref MLX90614_LOG_MAX_RECORD_SIZE . */
+    /** <b>Local unsigned int variable mismatches:</b> Number of differences that did not round trip within three bytes. */
+    unsigned int mismatches = 0;
+    for (int32_t d=-0x7FFF; d<=0x7FFF; d++)
+    {
+        uint8_t n = whitebox_write_mlx90614_log_varint(varint, d);
+        mismatches += (n > 3) || (whitebox_read_mlx90614_log_varint(varint, n, &delta) != n) || (delta != d);
+    }
+    UNIT_TEST_ASSERT_EQUAL(0, mismatches);
+}
+
+static void test_varint_rejects_truncated_and_overlong_encodings(void)
+{
+    const uint8_t truncated[] = {0x80, 0x80};
+    const uint8_t overlong[] = {0x80, 0x80, 0x80, 0x80, 0x80, 0x00};
+    const uint8_t overflowing[] = {0xFF, 0xFF, 0xFF, 0xFF, 0x10};
+    uint8_t varint[5];
+    int32_t delta;
+
+    UNIT_TEST_ASSERT_EQUAL(0, whitebox_read_mlx90614_log_varint(truncated, sizeof(truncated), &delta));
+    UNIT_TEST_ASSERT_EQUAL(0, whitebox_read_mlx90614_log_varint(overlong, sizeof(overlong), &delta));
+    UNIT_TEST_ASSERT_EQUAL(0, whitebox_read_mlx90614_log_varint(overflowing, sizeof(overflowing), &delta));
+    UNIT_TEST_ASSERT_EQUAL(0, whitebox_read_mlx90614_log_varint(varint, 0, &delta));
+    whitebox_write_mlx90614_log_varint(varint, INT32_MIN);
+    UNIT_TEST_ASSERT_EQUAL(0, whitebox_read_mlx90614_log_varint(varint, 4, &delta));
+}
+
+static void test_log_crc_is_the_smbus_pec(void)
+{
+    const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    UNIT_TEST_ASSERT_EQUAL(0xF4, whitebox_calculate_mlx90614_log_crc(check, sizeof(check)));
+    UNIT_TEST_ASSERT_EQUAL(0x00, whitebox_calculate_mlx90614_log_crc(check, 0));
+}
+
+/**@brief	Writes a Sample Log of @ref TEST_LOG_SAMPLES samples into @ref buffer , including full swings of every
+ *          Raw Value, and gives back its length. */
+static size_t write_test_log(MLX90614_Handle *hmlx, uint8_t keyframe_interval)
+{
+    MLX90614_Log_Writer log;
+
+    for (uint16_t i=0; i<TEST_LOG_SAMPLES; i++)
+    {
+        samples[i].raw[MLX90614_Ch_Ta] = (uint16_t) (14908 + i);
+        samples[i].raw[MLX90614_Ch_Tobj1] = (i & 1) ? 0x7FFF : 0;
+        samples[i].raw[MLX90614_Ch_Tobj2] = (uint16_t) (15000 - 37*i);
+    }
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_log_writer(&log, buffer, sizeof(buffer), hmlx, 0x12345678, keyframe_interval));
+    for (uint16_t i=0; i<TEST_LOG_SAMPLES; i++)
+    {
+        UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, append_mlx90614_log_sample(&log, &samples[i]));
+    }
+    close_mlx90614_log_block(&log);
+    return get_mlx90614_log_length(&log);
+}
+
+static void test_log_round_trips_and_discards_corrupted_blocks(void)
+{
+    MLX90614_Handle hmlx;
+    MLX90614_Log_Header header;
+    size_t n_samples;
+
+    mock_hal_add_device(&test_hi2c1, 0x5A);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    size_t length = write_test_log(&hmlx, 16);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, decode_mlx90614_log(buffer, length, &header, decoded, TEST_LOG_SAMPLES, &n_samples));
+    UNIT_TEST_ASSERT_EQUAL(TEST_LOG_SAMPLES, n_samples);
+    UNIT_TEST_ASSERT_EQUAL(0x5A, header.slave_address);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_Temp_C, header.temperature_type);
+    UNIT_TEST_ASSERT_EQUAL(0x12345678, header.start_tick);
+    /** <b>Local unsigned int variable mismatches:</b> Number of Raw Values that were not decoded back as written. */
+    unsigned int mismatches = 0;
+    for (uint16_t i=0; i<TEST_LOG_SAMPLES; i++)
+    {
+        for (uint8_t channel=0; channel<MLX90614_NUMBER_OF_CHANNELS; channel++)
+        {
+            mismatches += (decoded[i].raw[channel] != samples[i].raw[channel]);
+        }
+    }
+    UNIT_TEST_ASSERT_EQUAL(0, mismatches);
+    UNIT_TEST_ASSERT_FLOAT(25.01, decoded[0].temperature[MLX90614_Ch_Ta], 0.001);
+
+    /* Running out of room stops at a block boundary. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_STOP, decode_mlx90614_log(buffer, length, &header, decoded, 20, &n_samples));
+    UNIT_TEST_ASSERT_EQUAL(16, n_samples);
+
+    /* A truncated or a corrupted block only loses its own samples and those after it. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, decode_mlx90614_log(buffer, length - 1, &header, decoded, TEST_LOG_SAMPLES, &n_samples));
+    UNIT_TEST_ASSERT_EQUAL(32, n_samples);
+    buffer[length - 3] ^= 0x01;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, decode_mlx90614_log(buffer, length, &header, decoded, TEST_LOG_SAMPLES, &n_samples));
+    UNIT_TEST_ASSERT_EQUAL(32, n_samples);
+    buffer[length - 3] ^= 0x01;
+    buffer[1] ^= 0x01;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, decode_mlx90614_log(buffer, length, &header, decoded, TEST_LOG_SAMPLES, &n_samples));
+    UNIT_TEST_ASSERT_EQUAL(0, n_samples);
+}
+
+static void test_log_writer_rejects_what_does_not_fit(void)
+{
+    MLX90614_Handle hmlx;
+    MLX90614_Log_Writer log;
+    MLX90614_Sample sample = {0};
+
+    mock_hal_add_device(&test_hi2c1, 0x5A);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_log_writer(&log, buffer, MLX90614_LOG_HEADER_SIZE - 1, &hmlx, 0, 8));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_log_writer(&log, buffer, sizeof(buffer), &hmlx, 0, 0));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_log_writer(&log, buffer, MLX90614_LOG_HEADER_SIZE + MLX90614_LOG_MAX_RECORD_SIZE, &hmlx, 0, 8));
+    sample.raw[MLX90614_Ch_Tobj1] = 0x8000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, append_mlx90614_log_sample(&log, &sample));
+    sample.raw[MLX90614_Ch_Tobj1] = 0;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, append_mlx90614_log_sample(&log, &sample));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, append_mlx90614_log_sample(&log, &sample));
+}
+
+void run_sample_log_tests(void)
+{
+    UNIT_TEST_RUN(test_varint_round_trips_over_the_whole_int32_range);
+    UNIT_TEST_RUN(test_varint_rejects_truncated_and_overlong_encodings);
+    UNIT_TEST_RUN(test_log_crc_is_the_smbus_pec);
+    UNIT_TEST_RUN(test_log_round_trips_and_discards_corrupted_blocks);
+    UNIT_TEST_RUN(test_log_writer_rejects_what_does_not_fit);
+}
@@ -0,0 +1,92 @@
+/**@file
+ * @brief	Tests of the @ref MLX90614_Scheduler , whose sampling period must be clamped to the settling time of the
+ *          IIR and FIR Filters configured in the MLX90614 Device.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+
+static void test_scheduler_period_is_clamped_to_the_filter_settling_time(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Scheduler sched;
+
+    /* The default IIR of 100% and FIR of 1024 settle within a single output, so only the minimum period applies. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_scheduler(&sched, &hmlx, MLX90614_Ch_Tobj1, 10, 1));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_MIN_SAMPLING_PERIOD/10, get_mlx90614_scheduler_period(&sched));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_scheduler(&sched, &hmlx, MLX90614_Ch_Tobj1, 7, 1000));
+    UNIT_TEST_ASSERT_EQUAL(143, get_mlx90614_scheduler_period(&sched)); // 1000ms rounded up to a multiple of 7ms.
+
+    /* An IIR of 50% needs five outputs of the FIR of 1024 to settle. */
+    dev->eeprom[0x05] = (uint16_t) ((dev->eeprom[0x05] & ~0x0707) | (MLX90614_FIR_1024 << 8) | MLX90614_IIR_50);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(get_mlx90614_settling_time(MLX90614_IIR_50, MLX90614_FIR_1024), 500);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_scheduler(&sched, &hmlx, MLX90614_SCHEDULER_ALL_CHANNELS, 10, 100));
+    UNIT_TEST_ASSERT_EQUAL(50, get_mlx90614_scheduler_period(&sched));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_scheduler(&sched, &hmlx, MLX90614_SCHEDULER_ALL_CHANNELS, 10, 2000));
+    UNIT_TEST_ASSERT_EQUAL(200, get_mlx90614_scheduler_period(&sched));
+}
+
+static void test_scheduler_rejects_invalid_arguments_and_missing_devices(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Scheduler sched;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_scheduler(&sched, &hmlx, MLX90614_Ch_Tobj1, 0, 100));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, init_mlx90614_scheduler(&sched, &hmlx, 3, 10, 100));
+    dev->is_present = 0;
+    UNIT_TEST_ASSERT(init_mlx90614_scheduler(&sched, &hmlx, MLX90614_Ch_Tobj1, 10, 100) != MLX90614_EC_OK);
+}
+
+static void test_scheduler_issues_a_reading_per_period_and_counts_the_missed_ones(void)
+{
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Scheduler sched;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_scheduler(&sched, &hmlx, MLX90614_Ch_Tobj1, 10, 100));
+    mlx90614_scheduler_tick_handler(&sched);
+    UNIT_TEST_ASSERT_EQUAL(0, sched.issued); // A stopped Scheduler must not request anything.
+
+    mock_hal_tick_step = 0;
+    start_mlx90614_scheduler(&sched);
+    for (uint32_t tick=0; tick<30; tick++)
+    {
+        mlx90614_scheduler_tick_handler(&sched);
+        mock_hal_advance(10);
+    }
+    UNIT_TEST_ASSERT_EQUAL(3, sched.issued);
+    UNIT_TEST_ASSERT_EQUAL(0, sched.missed);
+
+    /* A reading that has not concluded by the end of the period makes the next one be missed. */
+    dev->latency_ms = 150;
+    for (uint32_t tick=0; tick<20; tick++)
+    {
+        mlx90614_scheduler_tick_handler(&sched);
+        mock_hal_advance(10);
+    }
+    UNIT_TEST_ASSERT_EQUAL(4, sched.issued);
+    UNIT_TEST_ASSERT_EQUAL(1, sched.missed);
+
+    stop_mlx90614_scheduler(&sched);
+    for (uint32_t tick=0; tick<20; tick++)
+    {
+        mlx90614_scheduler_tick_handler(&sched);
+        mock_hal_advance(10);
+    }
+    UNIT_TEST_ASSERT_EQUAL(4, sched.issued);
+}
+
+void run_scheduler_tests(void)
+{
+    UNIT_TEST_RUN(test_scheduler_period_is_clamped_to_the_filter_settling_time);
+    UNIT_TEST_RUN(test_scheduler_rejects_invalid_arguments_and_missing_devices);
+    UNIT_TEST_RUN(test_scheduler_issues_a_reading_per_period_and_counts_the_missed_ones);
+}
@@ -0,0 +1,141 @@
+/**@file
+ * @brief	Tests of the execution statistics of the @ref mlx90614 , which are only recorded whenever
+ *          @ref MLX90614_ENABLE_STATS is enabled.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#include "unit_test.h"
+#include "mlx90614_whitebox.h"
+
+static void test_cycle_stats_track_count_min_max_and_total(void)
+{
+#if (MLX90614_ENABLE_STATS)
+    MLX90614_Stats stats;
+
+    reset_mlx90614_stats();
+    get_mlx90614_stats(&stats);
+    for (uint8_t op=0; op<MLX90614_STATS_NUMBER_OF_OPS; op++)
+    {
+        UNIT_TEST_ASSERT_EQUAL(0, stats.cycles[op].count);
+        UNIT_TEST_ASSERT_EQUAL(0, stats.cycles[op].total);
+    }
+
+    /* The first record sets the minimum regardless of the zero that the reset left on it. */
+    whitebox_record_mlx90614_cycles(MLX90614_STATS_OP_GET_ALL, 50);
+    whitebox_record_mlx90614_cycles(MLX90614_STATS_OP_GET_ALL, 20);
+    whitebox_record_mlx90614_cycles(MLX90614_STATS_OP_GET_ALL, 80);
+    get_mlx90614_stats(&stats);
+    UNIT_TEST_ASSERT_EQUAL(3, stats.cycles[MLX90614_STATS_OP_GET_ALL].count);
+    UNIT_TEST_ASSERT_EQUAL(20, stats.cycles[MLX90614_STATS_OP_GET_ALL].min);
+    UNIT_TEST_ASSERT_EQUAL(80, stats.cycles[MLX90614_STATS_OP_GET_ALL].max);
+    UNIT_TEST_ASSERT_EQUAL(150, stats.cycles[MLX90614_STATS_OP_GET_ALL].total);
+    UNIT_TEST_ASSERT_EQUAL(0, stats.cycles[MLX90614_STATS_OP_GET_AMBIENT].count);
+
+    /* A total beyond 32 bits is kept whole. */
+    whitebox_record_mlx90614_cycles(MLX90614_STATS_OP_GET_AMBIENT, 0xFFFFFFFF);
+    whitebox_record_mlx90614_cycles(MLX90614_STATS_OP_GET_AMBIENT, 0xFFFFFFFF);
+    get_mlx90614_stats(&stats);
+    UNIT_TEST_ASSERT(stats.cycles[MLX90614_STATS_OP_GET_AMBIENT].total == 2ULL*0xFFFFFFFFULL);
+
+    reset_mlx90614_stats();
+    get_mlx90614_stats(&stats);
+    UNIT_TEST_ASSERT_EQUAL(0, stats.cycles[MLX90614_STATS_OP_GET_ALL].count);
+    UNIT_TEST_ASSERT_EQUAL(0, stats.cycles[MLX90614_STATS_OP_GET_ALL].max);
+#endif
+}
+
+static void test_instrumented_operations_are_recorded(void)
+{
+#if (MLX90614_ENABLE_STATS)
+    mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Sample sample;
+    MLX90614_Stats stats;
+    float temperature;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    reset_mlx90614_stats();
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature(&hmlx, &temperature));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature(&hmlx, &temperature));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_all_temperatures(&hmlx, &sample));
+    get_mlx90614_stats(&stats);
+    UNIT_TEST_ASSERT_EQUAL(2, stats.cycles[MLX90614_STATS_OP_GET_OBJECT1].count);
+    UNIT_TEST_ASSERT_EQUAL(1, stats.cycles[MLX90614_STATS_OP_GET_ALL].count);
+    UNIT_TEST_ASSERT_EQUAL(0, stats.cycles[MLX90614_STATS_OP_GET_AMBIENT].count);
+    UNIT_TEST_ASSERT_EQUAL(2 + MLX90614_NUMBER_OF_CHANNELS, stats.cycles[MLX90614_STATS_OP_HAL_MEM_READ].count);
+    for (uint8_t op=0; op<MLX90614_STATS_NUMBER_OF_OPS; op++)
+    {
+        UNIT_TEST_ASSERT(stats.cycles[op].min <= stats.cycles[op].max);
+        UNIT_TEST_ASSERT(stats.cycles[op].total >= stats.cycles[op].max);
+    }
+
+    /* An Asynchronous reading records only its requests. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_all_temperatures_async(&hmlx, &sample, NULL));
+    while (mock_hal_pending() != 0)
+    {
+        mock_hal_advance(1);
+    }
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_CPLT, get_mlx90614_handle_async_state(&hmlx));
+    get_mlx90614_stats(&stats);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_NUMBER_OF_CHANNELS, stats.cycles[MLX90614_STATS_OP_HAL_MEM_READ_ASYNC].count);
+    UNIT_TEST_ASSERT_EQUAL(2 + MLX90614_NUMBER_OF_CHANNELS, stats.cycles[MLX90614_STATS_OP_HAL_MEM_READ].count);
+#endif
+}
+
+static void test_failures_are_counted_by_their_cause(void)
+{
+#if (MLX90614_ENABLE_STATS)
+    Mock_MLX90614 *dev = mock_hal_add_device(&test_hi2c1, 0x5A);
+    MLX90614_Handle hmlx;
+    MLX90614_Stats stats;
+    uint16_t raw;
+
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, init_mlx90614_handle(&hmlx, &test_hi2c1, 0x5A, MLX90614_Temp_C));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    reset_mlx90614_stats();
+
+    dev->busy_left = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    dev->latency_ms = MLX90614_I2C_TIMEOUT + 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_NR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    dev->latency_ms = 0;
+    dev->nacks_left = 2;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    dev->ram[0x07] = 0x8000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    dev->ram[0x07] = 15000;
+    set_mlx90614_handle_pec_check(&hmlx, 1);
+    dev->is_pec_corrupted = 1;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_ERR, get_mlx90614_handle_raw_temperature(&hmlx, MLX90614_Ch_Tobj1, 1, &raw));
+    get_mlx90614_stats(&stats);
+    UNIT_TEST_ASSERT_EQUAL(1, stats.hal_busy);
+    UNIT_TEST_ASSERT_EQUAL(1, stats.hal_timeout);
+    UNIT_TEST_ASSERT_EQUAL(2, stats.hal_error);
+    UNIT_TEST_ASSERT_EQUAL(1, stats.error_flags);
+    UNIT_TEST_ASSERT_EQUAL(1, stats.pec_errors);
+    UNIT_TEST_ASSERT_EQUAL(0, stats.cache_hits);
+
+    /* Asynchronous readings count their corrupted PECs and Error Flags too. */
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature_async(&hmlx, NULL));
+    mock_hal_advance(10);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_ERR, get_mlx90614_handle_async_state(&hmlx));
+    dev->is_pec_corrupted = 0;
+    dev->ram[0x07] = 0x8000;
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_EC_OK, get_mlx90614_handle_object1_temperature_async(&hmlx, NULL));
+    mock_hal_advance(10);
+    UNIT_TEST_ASSERT_EQUAL(MLX90614_ASYNC_ERR, get_mlx90614_handle_async_state(&hmlx));
+    get_mlx90614_stats(&stats);
+    UNIT_TEST_ASSERT_EQUAL(2, stats.error_flags);
+    UNIT_TEST_ASSERT_EQUAL(2, stats.pec_errors);
+#endif
+}
+
+void run_stats_tests(void)
+{
+    UNIT_TEST_RUN(test_cycle_stats_track_count_min_max_and_total);
+    UNIT_TEST_RUN(test_instrumented_operations_are_recorded);
+    UNIT_TEST_RUN(test_failures_are_counted_by_their_cause);
+}
@@ -0,0 +1,124 @@
+/**@file
+ * @brief	Minimal unit test framework of the host-side tests of the MLX90614 Infra Red Thermometer's driver.
+ *
+ * @defgroup unit_test Unit Test module
+ * @{
+ *
+ * @brief   This module provides the assertion macros with which the tests of the @ref mlx90614 check their
+ *          expectations, where a failed assertion is reported with its file and line but does not stop the rest of
+ *          the tests from running.
+ *
+ * @details Each test is a \c void(void) function that is run via @ref UNIT_TEST_RUN , which first resets the
+ *          @ref mock_hal and initializes the I2C Handles @ref test_hi2c1 , @ref test_hi2c2 and @ref test_hi2c3 . The
+ *          tests of each feature of the @ref mlx90614 are grouped into a "test_<feature>.c" file, whose
+ *          \c run_<feature>_tests function is declared in this file and is called by the "test_main.c" file.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 14, 2026.
+ */
+
+#ifndef UNIT_TEST_H_
+#define UNIT_TEST_H_
+
+#include <stdio.h> // Library from which "printf" is located at.
+#include "mock_hal.h"
+#include "mlx90614_ir_thermometer_driver.h"
+
+extern unsigned int unit_test_checks;       /**< @brief Number of assertions that have been evaluated. */
+extern unsigned int unit_test_failures;     /**< @brief Number of assertions that have failed. */
+extern I2C_HandleTypeDef test_hi2c1;        /**< @brief First I2C Handle available to the tests. */
+extern I2C_HandleTypeDef test_hi2c2;        /**< @brief Second I2C Handle available to the tests. */
+extern I2C_HandleTypeDef test_hi2c3;        /**< @brief Third I2C Handle available to the tests. */
+
+/**@brief	Resets the @ref mock_hal and the I2C Handles available to the tests, which @ref UNIT_TEST_RUN calls before
+ *          every test.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 14, 2026.
+ */
+void setup_unit_test(void);
+
+/**@brief	Checks that the given condition holds. */
+#define UNIT_TEST_ASSERT(condition)                                                                 \
+    do                                                                                              \
+    {                                                                                               \
+        unit_test_checks++;                                                                         \
+        if (!(condition))                                                                           \
+        {                                                                                           \
+            unit_test_failures++;                                                                   \
+            printf("%s:%d: FAILED: %s\n", __FILE__, __LINE__, #condition);                          \
+        }                                                                                           \
+    } while (0)
+
+/**@brief	Checks that the given integer values are equal, which reports both of them whenever they are not. */
+#define UNIT_TEST_ASSERT_EQUAL(expected, actual)                                                    \
+    do                                                                                              \
+    {                                                                                               \
+        long long unit_test_expected = (long long) (expected);                                      \
+        long long unit_test_actual = (long long) (actual);                                          \
+        unit_test_checks++;                                                                         \
+        if (unit_test_expected != unit_test_actual)                                                 \
+        {                                                                                           \
+            unit_test_failures++;                                                                   \
+            printf("%s:%d: FAILED: %s == %s (expected %lld, got %lld)\n", __FILE__, __LINE__,       \
+                   #expected, #actual, unit_test_expected, unit_test_actual);                       \
+        }                                                                                           \
+    } while (0)
+
+/**@brief	Checks that the given float values differ by at most the given tolerance. */
+#define UNIT_TEST_ASSERT_FLOAT(expected, actual, tolerance)                                         \
+    do                                                                                              \
+    {                                                                                               \
+        double unit_test_difference = (double) (expected) - (double) (actual);                     \
+        unit_test_checks++;                                                                         \
+        if ((unit_test_difference > (tolerance)) || (unit_test_difference < -(tolerance)))         \
+        {                                                                                           \
+            unit_test_failures++;                                                                   \
+            printf("%s:%d: FAILED: %s == %s (expected %f, got %f)\n", __FILE__, __LINE__,           \
+                   #expected, #actual, (double) (expected), (double) (actual));                     \
+        }                                                                                           \
+    } while (0)
+
+/**@brief	Runs the given test function on a freshly reset @ref mock_hal . */
+#define UNIT_TEST_RUN(test_function)                                                                \
+    do                                                                                              \
+    {                                                                                               \
+        setup_unit_test();                                                                          \
+        test_function();                                                                            \
+    } while (0)
+
+void run_mock_hal_tests(void);
+void run_reading_tests(void);
+void run_pec_tests(void);
+void run_centi_conversion_tests(void);
+void run_ring_buffer_tests(void);
+void run_scheduler_tests(void);
+void run_filter_tests(void);
+void run_batch_conversion_tests(void);
+void run_retry_policy_tests(void);
+void run_event_detector_tests(void);
+void run_sample_log_tests(void);
+void run_emissivity_tests(void);
+void run_aggregate_tests(void);
+void run_address_validation_tests(void);
+void run_freshness_cache_tests(void);
+void run_config_register_tests(void);
+void run_eeprom_write_tests(void);
+void run_bus_scan_tests(void);
+void run_eeprom_shadow_tests(void);
+void run_stats_tests(void);
+void run_bus_recovery_tests(void);
+void run_multi_bus_tests(void);
+void run_duty_cycle_tests(void);
+void run_rtos_tests(void);
+void run_pwm_tests(void);
+void run_benchmark_tests(void);
+void run_fixed_unit_tests(void);
+void run_async_reading_tests(void);
+void run_handle_tests(void);
+void run_burst_read_tests(void);
+void run_ll_transport_tests(void);
+
+#endif /* UNIT_TEST_H_ */
+
+/** @} */